@@ -31,34 +31,68 @@
 #define _GFXCONF_H
 
 /* The operating system to use - one of these must be defined */
-#define GFX_USE_OS_CHIBIOS		TRUE
-#define GFX_USE_OS_WIN32		FALSE
-#define GFX_USE_OS_POSIX		FALSE
+//#define GFX_USE_OS_CHIBIOS		TRUE
+//#define GFX_USE_OS_WIN32		TRUE
+//#define GFX_USE_OS_LINUX		TRUE
+//#define GFX_USE_OS_OSX		TRUE
 
 /* GFX sub-systems to turn on */
-#define GFX_USE_GDISP                   TRUE
+#define GFX_USE_GDISP			TRUE
+#define GFX_USE_GWIN			TRUE
+#define GFX_USE_GEVENT			TRUE
+#define GFX_USE_GTIMER			TRUE
+#define GFX_USE_GINPUT			TRUE
 
 /* Features for the GDISP sub-system. */
-#define GDISP_NEED_VALIDATION           FALSE
-#define GDISP_NEED_CLIP                 FALSE
-#define GDISP_NEED_TEXT                 TRUE
-#define GDISP_NEED_CIRCLE               FALSE
-#define GDISP_NEED_ELLIPSE              FALSE
-#define GDISP_NEED_ARC                  FALSE
-#define GDISP_NEED_SCROLL               FALSE
-#define GDISP_NEED_PIXELREAD            FALSE
-#define GDISP_NEED_CONTROL              TRUE
-#define GDISP_NEED_MULTITHREAD          FALSE
-#define GDISP_NEED_ASYNC                FALSE
-#define GDISP_NEED_MSGAPI               FALSE
+#define GDISP_NEED_VALIDATION		TRUE
+#define GDISP_NEED_CLIP				TRUE
+#define GDISP_NEED_TEXT				TRUE
+#define GDISP_NEED_ANTIALIAS		TRUE
+#define GDISP_NEED_CIRCLE			TRUE
+#define GDISP_NEED_ELLIPSE			TRUE
+#define GDISP_NEED_ARC				TRUE
+#define GDISP_NEED_CONVEX_POLYGON	TRUE
+#define GDISP_NEED_SCROLL			TRUE
+#define GDISP_NEED_PIXELREAD		TRUE
+#define GDISP_NEED_CONTROL			FALSE
+#define GDISP_NEED_IMAGE			TRUE
+#define GDISP_NEED_MULTITHREAD		TRUE
+#define GDISP_NEED_ASYNC			FALSE
+#define GDISP_NEED_MSGAPI			FALSE
+
+/* The display size for the TestStub and Framebuffer drivers. Every test fits on a 320x240 display.
+ * Change or remove these to match a display driver that uses them for the real panel size.
+ */
+#define GDISP_SCREEN_WIDTH			320
+#define GDISP_SCREEN_HEIGHT			240
 
 /* Builtin Fonts */
-#define GDISP_INCLUDE_FONT_SMALL        FALSE
-#define GDISP_INCLUDE_FONT_LARGER       FALSE
-#define GDISP_INCLUDE_FONT_UI1          FALSE
-#define GDISP_INCLUDE_FONT_UI2          FALSE
-#define GDISP_INCLUDE_FONT_LARGENUMBERS FALSE
-#define GDISP_INCLUDE_FONT_DEJAVUSANS10 TRUE
+#define GDISP_INCLUDE_FONT_UI1				TRUE
+#define GDISP_INCLUDE_FONT_UI2				TRUE
+#define GDISP_INCLUDE_FONT_DEJAVUSANS12		TRUE
+#define GDISP_INCLUDE_FONT_DEJAVUSANS12_AA	TRUE
+#define GDISP_INCLUDE_FONT_DEJAVUSANS24		TRUE
+#define GDISP_INCLUDE_FONT_DEJAVUSANS24_AA	TRUE
+#define GDISP_INCLUDE_FONT_FIXED_7X14		TRUE
 
-#endif /* _GFXCONF_H */
+/* GDISP image decoders */
+#define GDISP_NEED_IMAGE_NATIVE		TRUE
+#define GDISP_NEED_IMAGE_GIF		TRUE
+#define GDISP_NEED_IMAGE_BMP		TRUE
+#define GDISP_NEED_IMAGE_JPG		FALSE
+#define GDISP_NEED_IMAGE_PNG		FALSE
 
+/* Features for the GWIN sub-system. */
+#define GWIN_NEED_WINDOWMANAGER		TRUE
+#define GWIN_NEED_WIDGET			TRUE
+#define GWIN_NEED_BUTTON			TRUE
+#define GWIN_NEED_SLIDER			TRUE
+#define GWIN_NEED_CHECKBOX			TRUE
+#define GWIN_NEED_LABEL				TRUE
+
+/* Features for the GINPUT sub-system. No input is needed to benchmark the widgets. */
+#define GINPUT_NEED_MOUSE			FALSE
+#define GINPUT_NEED_TOGGLE			FALSE
+#define GINPUT_NEED_DIAL			FALSE
+
+#endif /* _GFXCONF_H */
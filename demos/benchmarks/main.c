@@ -27,123 +27,676 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "stdlib.h"
-#include "string.h"
+#include <string.h>
 #include "gfx.h"
 
-#define SCB_DEMCR (*(volatile unsigned *)0xE000EDFC)
-#define CPU_RESET_CYCLECOUNTER do { SCB_DEMCR = SCB_DEMCR | 0x01000000; \
-DWT_CYCCNT = 0; \
-DWT_CTRL = DWT_CTRL | 1 ; } while(0)
-
-static int uitoa(unsigned int value, char * buf, int max) {
-    int n = 0;
-    int i = 0;
-    unsigned int tmp = 0;
-
-    if (NULL == buf)
-        return -3;
-
-    if (2 > max)
-        return -4;
-
-    i=1;
-    tmp = value;
-    if (0 > tmp) {
-        tmp *= -1;
-        i++;
-    }
-    for (;;) {
-        tmp /= 10;
-        if (0 >= tmp)
-            break;
-        i++;
-    }
-    if (i >= max) {
-        buf[0] = '?';
-        buf[1] = 0x0;
-        return 2;
-    }
-
-    n = i;
-    tmp = value;
-    if (0 > tmp) {
-        tmp *= -1;
-    }
-    buf[i--] = 0x0;
-    for (;;) {
-        buf[i--] = (tmp % 10) + '0';
-        tmp /= 10;
-        if (0 >= tmp) {
-            break;
-        }
-    }
-    if (-1 != i) {
-        buf[i--] = '-';
-    }
-
-    return n;
-}
+/**
+ * This demo times the drawing primitives, text, images, scrolling and widget
+ * redraws. See readme.txt for how to build it and the format of the results.
+ *
+ * All the random numbers come from our own generator with a fixed seed so that
+ * every run (and every library version) draws exactly the same things.
+ */
 
-void benchmark(void) {
-    uint32_t i, pixels, ms, pps;
-    char pps_str[25];
-	coord_t height, width, rx, ry, rcx, rcy;
-    color_t random_color;
-	font_t font;
+#if GFX_USE_OS_LINUX || GFX_USE_OS_OSX || GFX_USE_OS_WIN32
+	#include <stdio.h>
+	#define BENCH_USE_STDIO		TRUE
+#else
+	#define BENCH_USE_STDIO		FALSE
+#endif
 
-    gdispSetOrientation(GDISP_ROTATE_90);
+#define BENCH_TEST_TIME			500					// Milliseconds to repeat each test for
+#define BENCH_MAX_RESULTS		64
+#define BENCH_NAME_SIZE			32
+#define BENCH_BLIT_SIZE			32
+#define BENCH_IMAGE_WIDTH		64
+#define BENCH_IMAGE_HEIGHT		40
 
-	width = gdispGetWidth();
-	height = gdispGetHeight();
-    font = gdispOpenFont("UI2 Double");
+#if GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_GIF
+	#include "testanim.h"
+#endif
 
-	gdispDrawStringBox(0, 0, width, 30, "ChibiOS/GFX - Benchmark", font, White, justifyCenter);
+typedef struct benchResult {
+	char		name[BENCH_NAME_SIZE];
+	uint32_t	ops;
+	uint32_t	ms;
+	float		pixels;
+} benchResult;
 
-	font = gdispOpenFont("UI2");
-	gdispDrawStringBox(0, height/2, width, 30, "5000 random rectangles", font, White, justifyCenter);
-	
-	gfxSleepMilliseconds(3000);
-	
-	/* seed for the rand() */
-	srand(DWT_CYCCNT);
-	pixels = 0;
+/* A test draws operation number n and returns how many pixels it covered */
+typedef uint32_t (*benchTest)(uint32_t n);
 
-	CPU_RESET_CYCLECOUNTER;
+static benchResult		results[BENCH_MAX_RESULTS];
+static unsigned			numResults;
+static coord_t			width, height;
+static uint32_t			seed;
+static pixel_t			blitBuffer[BENCH_BLIT_SIZE*BENCH_BLIT_SIZE];
 
-	for (i = 0; i < 5000; i++) {
-		random_color = (rand() % 65535);
-		rx = (rand() % (width-10));
-		ry = (rand() % (height-10));
-		rcx = (rand() % ((width-rx)-10))+10;
-		rcy = (rand() % ((height-ry)-10))+10;
+static uint32_t rnd(uint32_t range) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 8) % range;
+}
 
-		gdispFillArea(rx, ry, rcx, rcy, random_color);
-		pixels += (rcx+1)*(rcy+1);
-	}
+static color_t rndColor(void) {
+	return RGB2COLOR(rnd(256), rnd(256), rnd(256));
+}
+
+static uint32_t maxDelta(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+	coord_t		dx, dy;
 
-	ms = DWT_CYCCNT / 168000;
-	pps = (float)pixels/((float)ms/1000.0f);
+	dx = x1 > x0 ? x1 - x0 : x0 - x1;
+	dy = y1 > y0 ? y1 - y0 : y0 - y1;
+	return (dx > dy ? dx : dy) + 1;
+}
+
+static void benchReport(const benchResult *r) {
+	#if BENCH_USE_STDIO
+		printf("%s,%lu,%.0f,%lu,%.0f,%.0f\n", r->name, (unsigned long)r->ops, r->pixels, (unsigned long)r->ms,
+			(float)r->ops * 1000.0f / r->ms, r->pixels * 1000.0f / r->ms);
+		fflush(stdout);
+	#else
+		(void) r;
+	#endif
+}
+
+/* Report a test that could not be run so that result files still line up */
+static void benchSkip(const char *name, const char *subname, const char *reason) {
+	#if BENCH_USE_STDIO
+		printf("# %s%s skipped - %s\n", name, subname ? subname : "", reason);
+		fflush(stdout);
+	#else
+		(void) name; (void) subname; (void) reason;
+	#endif
+}
 
-	memset (pps_str, 0, sizeof(pps_str));
-	uitoa(pps, pps_str, sizeof(pps_str));
-	strcat(pps_str, " Pixels/s");
+/**
+ * Repeat a test in batches until BENCH_TEST_TIME has passed.
+ * The time for each batch includes any queued (GDISP_NEED_ASYNC) or
+ * deferred (GDISP_NEED_AUTOFLUSH) drawing so the results are comparable.
+ */
+static void bench(const char *name, const char *subname, benchTest fn, unsigned batch) {
+	benchResult *	r;
+	systemticks_t	start, limit, elapsed;
+	uint32_t		pixels;
+	unsigned		i;
+
+	if (numResults >= BENCH_MAX_RESULTS) {
+		benchSkip(name, subname, "BENCH_MAX_RESULTS is too small");
+		return;
+	}
+	r = &results[numResults++];
+	strncpy(r->name, name, BENCH_NAME_SIZE-1);
+	r->name[BENCH_NAME_SIZE-1] = 0;
+	if (subname) {
+		i = strlen(r->name);
+		strncpy(r->name+i, subname, BENCH_NAME_SIZE-1-i);
+	}
+	r->ops = 0;
+	r->pixels = 0;
 
-	font = gdispOpenFont("UI2 Double");
+	seed = 1;
 	gdispClear(Black);
-	gdispDrawStringBox(0, 0, width, 30, "ChibiOS/GFX - Benchmark", font, White, justifyCenter);
-	gdispDrawStringBox(0, height/2, width, 30, pps_str, font, White, justifyCenter);
-	//gdispDrawString(20, height/2, pps_str, font, White);
+	gdispFlush();
+	gdispSync();
+
+	limit = gfxMillisecondsToTicks(BENCH_TEST_TIME);
+	start = gfxSystemTicks();
+	do {
+		for (pixels = 0, i = 0; i < batch; i++)
+			pixels += fn(r->ops++);
+		r->pixels += pixels;
+		gdispFlush();
+		gdispSync();
+		elapsed = gfxSystemTicks() - start;
+	} while (elapsed < limit);
+	r->ms = (uint32_t)((float)elapsed * 1000.0f / gfxMillisecondsToTicks(1000));
+	if (!r->ms)
+		r->ms = 1;
+
+	benchReport(r);
 }
 
+/*
+ * The primitive tests
+ */
+
+static uint32_t testPixel(uint32_t n) {
+	(void) n;
+	gdispDrawPixel(rnd(width), rnd(height), rndColor());
+	return 1;
+}
+
+static uint32_t testLineH(uint32_t n) {
+	coord_t		x, y, len;
+	(void) n;
+
+	len = rnd(width) + 1;
+	x = rnd(width - len + 1);
+	y = rnd(height);
+	gdispDrawLine(x, y, x+len-1, y, rndColor());
+	return len;
+}
+
+static uint32_t testLineV(uint32_t n) {
+	coord_t		x, y, len;
+	(void) n;
+
+	len = rnd(height) + 1;
+	x = rnd(width);
+	y = rnd(height - len + 1);
+	gdispDrawLine(x, y, x, y+len-1, rndColor());
+	return len;
+}
+
+static uint32_t testLine(uint32_t n) {
+	coord_t		x0, y0, x1, y1;
+	(void) n;
+
+	x0 = rnd(width); y0 = rnd(height);
+	x1 = rnd(width); y1 = rnd(height);
+	gdispDrawLine(x0, y0, x1, y1, rndColor());
+	return maxDelta(x0, y0, x1, y1);
+}
+
+static uint32_t testFillSmall(uint32_t n) {
+	(void) n;
+	gdispFillArea(rnd(width-8), rnd(height-8), 8, 8, rndColor());
+	return 8*8;
+}
+
+static uint32_t testFill(uint32_t n) {
+	coord_t		x, y, cx, cy;
+	(void) n;
+
+	cx = rnd(width) + 1;
+	cy = rnd(height) + 1;
+	x = rnd(width - cx + 1);
+	y = rnd(height - cy + 1);
+	gdispFillArea(x, y, cx, cy, rndColor());
+	return (uint32_t)cx * cy;
+}
+
+static uint32_t testClear(uint32_t n) {
+	(void) n;
+	gdispClear(rndColor());
+	return (uint32_t)width * height;
+}
+
+static uint32_t testBlit(uint32_t n) {
+	(void) n;
+	gdispBlitAreaEx(rnd(width-BENCH_BLIT_SIZE), rnd(height-BENCH_BLIT_SIZE), BENCH_BLIT_SIZE, BENCH_BLIT_SIZE, 0, 0, BENCH_BLIT_SIZE, blitBuffer);
+	return BENCH_BLIT_SIZE*BENCH_BLIT_SIZE;
+}
+
+#if GDISP_NEED_CIRCLE || GDISP_NEED_ELLIPSE || GDISP_NEED_ARC
+	/* Circles are kept on screen so clipping doesn't distort the results */
+	static coord_t rndRadius(coord_t *px, coord_t *py) {
+		coord_t		r;
+
+		r = rnd((width < height ? width : height) / 2 - 1) + 1;
+		*px = r + rnd(width - 2*r);
+		*py = r + rnd(height - 2*r);
+		return r;
+	}
+#endif
+
+#if GDISP_NEED_CIRCLE
+	static uint32_t testCircle(uint32_t n) {
+		coord_t		x, y, r;
+		(void) n;
+
+		r = rndRadius(&x, &y);
+		gdispDrawCircle(x, y, r, rndColor());
+		return (uint32_t)r * 710 / 113;				// 2 * pi * r
+	}
+
+	static uint32_t testFillCircle(uint32_t n) {
+		coord_t		x, y, r;
+		(void) n;
+
+		r = rndRadius(&x, &y);
+		gdispFillCircle(x, y, r, rndColor());
+		return (uint32_t)r * r * 355 / 113;			// pi * r * r
+	}
+#endif
+
+#if GDISP_NEED_ELLIPSE
+	static uint32_t testFillEllipse(uint32_t n) {
+		coord_t		x, y, a, b;
+		(void) n;
+
+		a = rndRadius(&x, &y);
+		b = rnd(a) + 1;
+		gdispFillEllipse(x, y, a, b, rndColor());
+		return (uint32_t)a * b * 355 / 113;
+	}
+#endif
+
+#if GDISP_NEED_ARC
+	static uint32_t testArc(uint32_t n) {
+		coord_t		x, y, r, start, sweep;
+		(void) n;
+
+		r = rndRadius(&x, &y);
+		start = rnd(360);
+		sweep = rnd(359) + 1;
+		gdispDrawArc(x, y, r, start, start+sweep, rndColor());
+		return (uint32_t)r * sweep * 71 / 4068;		// 2 * pi * r * sweep / 360
+	}
+
+	static uint32_t testFillArc(uint32_t n) {
+		coord_t		x, y, r, start, sweep;
+		(void) n;
+
+		r = rndRadius(&x, &y);
+		start = rnd(360);
+		sweep = rnd(359) + 1;
+		gdispFillArc(x, y, r, start, start+sweep, rndColor());
+		return (uint32_t)r * r * sweep * 71 / 8136;	// pi * r * r * sweep / 360
+	}
+#endif
+
+#if GDISP_NEED_CONVEX_POLYGON
+	static const point benchPoly[] = { {0, -30}, {28, -9}, {18, 24}, {-18, 24}, {-28, -9} };	// Pentagon
+	#define BENCH_POLY_AREA		2106
+	#define BENCH_POLY_EDGE		158
+
+	static uint32_t testPoly(uint32_t n) {
+		(void) n;
+		gdispDrawPoly(30 + rnd(width-60), 30 + rnd(height-60), benchPoly, sizeof(benchPoly)/sizeof(benchPoly[0]), rndColor());
+		return BENCH_POLY_EDGE;
+	}
+
+	static uint32_t testFillPoly(uint32_t n) {
+		(void) n;
+		gdispFillConvexPoly(30 + rnd(width-60), 30 + rnd(height-60), benchPoly, sizeof(benchPoly)/sizeof(benchPoly[0]), rndColor());
+		return BENCH_POLY_AREA;
+	}
+#endif
+
+#if GDISP_NEED_ALPHA
+	static uint32_t testFillAlpha(uint32_t n) {
+		coord_t		x, y, cx, cy;
+		(void) n;
+
+		cx = rnd(width) + 1;
+		cy = rnd(height) + 1;
+		x = rnd(width - cx + 1);
+		y = rnd(height - cy + 1);
+		gdispFillAreaAlpha(x, y, cx, cy, rndColor(), rnd(256));
+		return (uint32_t)cx * cy;
+	}
+
+	static uint32_t testLineAA(uint32_t n) {
+		coord_t		x0, y0, x1, y1;
+		(void) n;
+
+		x0 = rnd(width); y0 = rnd(height);
+		x1 = rnd(width); y1 = rnd(height);
+		gdispDrawLineAA(x0, y0, x1, y1, rndColor());
+		return maxDelta(x0, y0, x1, y1);
+	}
+
+	#if GDISP_NEED_CIRCLE
+		static uint32_t testCircleAA(uint32_t n) {
+			coord_t		x, y, r;
+			(void) n;
+
+			r = rndRadius(&x, &y);
+			gdispDrawCircleAA(x, y, r, rndColor());
+			return (uint32_t)r * 710 / 113;
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_SCROLL
+	static uint32_t testScroll(uint32_t n) {
+		(void) n;
+		gdispVerticalScroll(0, 0, width, height, rnd(16)+1, Black);
+		return (uint32_t)width * height;
+	}
+#endif
+
+/*
+ * The text tests - run for each built in font
+ */
+
+#if GDISP_NEED_TEXT
+	static const char *benchFontNames[] = {
+		"UI1", "UI2", "LargeNumbers", "fixed_5x8", "fixed_7x14", "fixed_10x20",
+		"DejaVuSans10", "DejaVuSans12", "DejaVuSans12_aa", "DejaVuSans16", "DejaVuSans16_aa",
+		"DejaVuSans24", "DejaVuSans24_aa", "DejaVuSans32", "DejaVuSans32_aa",
+		"DejaVuSansBold12", "DejaVuSansBold12_aa",
+	};
+	static const char	benchText[] = "The quick brown fox 0123";
+	static font_t		benchFont;
+	static coord_t		benchTextWidth, benchTextHeight;
+
+	static uint32_t testDrawString(uint32_t n) {
+		(void) n;
+		gdispDrawString(rnd(width - benchTextWidth + 1), rnd(height - benchTextHeight + 1), benchText, benchFont, rndColor());
+		return (uint32_t)benchTextWidth * benchTextHeight;
+	}
+
+	static uint32_t testFillString(uint32_t n) {
+		(void) n;
+		gdispFillString(rnd(width - benchTextWidth + 1), rnd(height - benchTextHeight + 1), benchText, benchFont, rndColor(), rndColor());
+		return (uint32_t)benchTextWidth * benchTextHeight;
+	}
+
+	static void benchFonts(void) {
+		unsigned	i;
+
+		for (i = 0; i < sizeof(benchFontNames)/sizeof(benchFontNames[0]); i++) {
+			benchFont = gdispOpenFont(benchFontNames[i]);
+
+			// gdispOpenFont() returns the default font if the font isn't compiled in
+			if (strcmp(gdispGetFontName(benchFont), benchFontNames[i]))
+				continue;
+
+			benchTextWidth = gdispGetStringWidth(benchText, benchFont);
+			benchTextHeight = gdispGetFontMetric(benchFont, fontHeight);
+			if (benchTextWidth <= width && benchTextHeight <= height) {
+				bench("text_draw_", benchFontNames[i], testDrawString, 16);
+				bench("text_fill_", benchFontNames[i], testFillString, 16);
+			} else
+				benchSkip("text_", benchFontNames[i], "text is larger than the display");
+			gdispCloseFont(benchFont);
+		}
+	}
+#endif
+
+/*
+ * The image tests - the BMP and native images are generated in memory
+ */
+
+#if GDISP_NEED_IMAGE
+	static const void *	benchImageData;
+	static gdispImage	benchImage;
+
+	#if GDISP_NEED_IMAGE_BMP
+		static uint8_t	bmp8[54 + 256*4 + BENCH_IMAGE_WIDTH*BENCH_IMAGE_HEIGHT];
+		static uint8_t	bmp24[54 + BENCH_IMAGE_WIDTH*3*BENCH_IMAGE_HEIGHT];
+
+		static uint8_t *putLE(uint8_t *p, uint32_t v, unsigned len) {
+			while(len--) {
+				*p++ = (uint8_t)v;
+				v >>= 8;
+			}
+			return p;
+		}
+
+		static void makeBMP(uint8_t *buf, unsigned bpp) {
+			uint8_t *	p;
+			uint32_t	palsize, imgsize;
+			unsigned	x, y;
+
+			palsize = bpp == 8 ? 256*4 : 0;
+			imgsize = BENCH_IMAGE_WIDTH * (bpp/8) * BENCH_IMAGE_HEIGHT;	// Rows are already a multiple of 4 bytes
+
+			p = buf;
+			*p++ = 'B'; *p++ = 'M';
+			p = putLE(p, 54 + palsize + imgsize, 4);
+			p = putLE(p, 0, 4);
+			p = putLE(p, 54 + palsize, 4);
+			p = putLE(p, 40, 4);						// BITMAPINFOHEADER
+			p = putLE(p, BENCH_IMAGE_WIDTH, 4);
+			p = putLE(p, BENCH_IMAGE_HEIGHT, 4);
+			p = putLE(p, 1, 2);
+			p = putLE(p, bpp, 2);
+			p = putLE(p, 0, 4);							// BI_RGB
+			p = putLE(p, imgsize, 4);
+			p = putLE(p, 2835, 4);
+			p = putLE(p, 2835, 4);
+			p = putLE(p, palsize ? 256 : 0, 4);
+			p = putLE(p, 0, 4);
+			for (x = 0; x < palsize/4; x++)
+				p = putLE(p, ((uint32_t)x << 16) | ((255-x) << 8) | ((x * 7) & 0xFF), 4);
+			for (y = 0; y < BENCH_IMAGE_HEIGHT; y++) {
+				for (x = 0; x < BENCH_IMAGE_WIDTH; x++) {
+					if (bpp == 8)
+						*p++ = (uint8_t)(x * 4 + y);
+					else
+						p = putLE(p, ((uint32_t)(x*4) << 16) | ((uint32_t)(y*6) << 8) | ((x+y) * 2), 3);
+				}
+			}
+		}
+	#endif
+
+	#if GDISP_NEED_IMAGE_NATIVE
+		static uint8_t	native[8 + BENCH_IMAGE_WIDTH*BENCH_IMAGE_HEIGHT*sizeof(pixel_t)];
+
+		static void makeNative(void) {
+			pixel_t *	p;
+			unsigned	x, y;
+
+			native[0] = 'N'; native[1] = 'I';
+			native[2] = (uint8_t)(BENCH_IMAGE_WIDTH >> 8); native[3] = (uint8_t)BENCH_IMAGE_WIDTH;
+			native[4] = (uint8_t)(BENCH_IMAGE_HEIGHT >> 8); native[5] = (uint8_t)BENCH_IMAGE_HEIGHT;
+			native[6] = (uint8_t)(GDISP_PIXELFORMAT >> 8); native[7] = (uint8_t)GDISP_PIXELFORMAT;
+			p = (pixel_t *)(native+8);
+			for (y = 0; y < BENCH_IMAGE_HEIGHT; y++)
+				for (x = 0; x < BENCH_IMAGE_WIDTH; x++)
+					*p++ = RGB2COLOR(x*4, y*6, (x+y)*2);
+		}
+	#endif
+
+	/* Decode - open, draw and close the image */
+	static uint32_t testImageDecode(uint32_t n) {
+		static gdispImage	img;
+		(void) n;
+
+		gdispImageSetMemoryReader(&img, benchImageData);
+		if (gdispImageOpen(&img) != GDISP_IMAGE_ERR_OK)
+			return 0;
+		gdispImageDraw(&img, rnd(width - img.width + 1), rnd(height - img.height + 1), img.width, img.height, 0, 0);
+		gdispImageClose(&img);
+		return (uint32_t)img.width * img.height;
+	}
+
+	/* Draw - draw the already opened and cached image */
+	static uint32_t testImageDraw(uint32_t n) {
+		(void) n;
+		gdispImageDraw(&benchImage, rnd(width - benchImage.width + 1), rnd(height - benchImage.height + 1), benchImage.width, benchImage.height, 0, 0);
+		return (uint32_t)benchImage.width * benchImage.height;
+	}
+
+	static void benchImageFile(const char *name, const void *data) {
+		benchImageData = data;
+		gdispImageSetMemoryReader(&benchImage, data);
+		if (gdispImageOpen(&benchImage) != GDISP_IMAGE_ERR_OK) {
+			benchSkip("image_", name, "the image could not be opened");
+			return;
+		}
+		if (benchImage.width <= width && benchImage.height <= height) {
+			bench("image_decode_", name, testImageDecode, 1);
+			if (gdispImageCache(&benchImage) == GDISP_IMAGE_ERR_OK)
+				bench("image_cached_", name, testImageDraw, 4);
+			else
+				benchSkip("image_cached_", name, "the image could not be cached");
+		} else
+			benchSkip("image_", name, "the image is larger than the display");
+		gdispImageClose(&benchImage);
+	}
+
+	static void benchImages(void) {
+		#if GDISP_NEED_IMAGE_NATIVE
+			makeNative();
+			benchImageFile("native", native);
+		#endif
+		#if GDISP_NEED_IMAGE_BMP
+			makeBMP(bmp8, 8);
+			benchImageFile("bmp8", bmp8);
+			makeBMP(bmp24, 24);
+			benchImageFile("bmp24", bmp24);
+		#endif
+		#if GDISP_NEED_IMAGE_GIF
+			benchImageFile("gif", testanim);
+		#endif
+	}
+#endif
+
+/*
+ * The widget tests
+ */
+
+#if GFX_USE_GWIN && GWIN_NEED_WIDGET
+	static GHandle		benchWidget;
+
+	static uint32_t testWidgetRedraw(uint32_t n) {
+		(void) n;
+		gwinRedraw(benchWidget);
+		return (uint32_t)benchWidget->width * benchWidget->height;
+	}
+
+	static void benchWidgets(void) {
+		GWidgetInit		wi;
+
+		gwinSetDefaultFont(gdispOpenFont("UI2"));
+		wi.customDraw = 0; wi.customParam = 0; wi.customStyle = 0;
+		wi.g.show = TRUE; wi.g.x = 10; wi.g.y = 10;
+
+		#if GWIN_NEED_BUTTON
+			wi.g.width = 100; wi.g.height = 30; wi.text = "Button";
+			benchWidget = gwinButtonCreate(0, &wi);
+			bench("widget_button", 0, testWidgetRedraw, 4);
+			gwinDestroy(benchWidget);
+		#endif
+		#if GWIN_NEED_SLIDER
+			wi.g.width = 150; wi.g.height = 20; wi.text = "Slider";
+			benchWidget = gwinSliderCreate(0, &wi);
+			gwinSliderSetPosition(benchWidget, 30);
+			bench("widget_slider", 0, testWidgetRedraw, 4);
+			gwinDestroy(benchWidget);
+		#endif
+		#if GWIN_NEED_CHECKBOX
+			wi.g.width = 100; wi.g.height = 20; wi.text = "Checkbox";
+			benchWidget = gwinCheckboxCreate(0, &wi);
+			gwinCheckboxCheck(benchWidget, TRUE);
+			bench("widget_checkbox", 0, testWidgetRedraw, 4);
+			gwinDestroy(benchWidget);
+		#endif
+		#if GWIN_NEED_LABEL
+			wi.g.width = 100; wi.g.height = 20; wi.text = "Label";
+			benchWidget = gwinLabelCreate(0, &wi);
+			bench("widget_label", 0, testWidgetRedraw, 4);
+			gwinDestroy(benchWidget);
+		#endif
+	}
+#endif
+
+/*
+ * Showing the results when there is no console
+ */
+
+#if !BENCH_USE_STDIO
+	static char *benchUtoa(char *p, uint32_t v) {
+		char		tmp[10];
+		unsigned	i;
+
+		i = 0;
+		do {
+			tmp[i++] = '0' + (v % 10);
+			v /= 10;
+		} while (v);
+		while(i)
+			*p++ = tmp[--i];
+		*p = 0;
+		return p;
+	}
+
+	static void showResults(void) {
+		font_t		font;
+		coord_t		y, fh;
+		unsigned	i;
+		char		buf[BENCH_NAME_SIZE + 32];
+		char *		p;
+
+		font = gdispOpenFont("UI1");
+		fh = gdispGetFontMetric(font, fontHeight);
+		gdispClear(Black);
+		for (y = 0, i = 0; i < numResults; i++, y += fh) {
+			if (y + fh > height) {
+				gfxSleepMilliseconds(5000);
+				gdispClear(Black);
+				y = 0;
+			}
+			strcpy(buf, results[i].name);
+			p = buf + strlen(buf);
+			*p++ = ' ';
+			p = benchUtoa(p, (uint32_t)((float)results[i].ops * 1000.0f / results[i].ms));
+			strcpy(p, " ops/s ");
+			p = benchUtoa(p + 7, (uint32_t)(results[i].pixels * 1000.0f / results[i].ms));
+			strcpy(p, " px/s");
+			gdispDrawString(0, y, buf, font, White);
+		}
+		gdispCloseFont(font);
+	}
+#endif
+
 int main(void) {
+	unsigned	i;
+
 	gfxInit();
-	
-	benchmark();
-    
-	while(TRUE) {
-		gfxSleepMilliseconds(500);
-	}
+
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+	for (i = 0; i < BENCH_BLIT_SIZE*BENCH_BLIT_SIZE; i++)
+		blitBuffer[i] = RGB2COLOR(i & 0xFF, (i >> 2) & 0xFF, (i >> 4) & 0xFF);
+
+	#if BENCH_USE_STDIO
+		printf("# uGFX benchmark - %dx%d display, %d bits per pixel\n", width, height, (int)(sizeof(pixel_t)*8));
+		printf("# test,ops,pixels,ms,ops/s,pixels/s\n");
+	#endif
+
+	bench("pixel", 0, testPixel, 256);
+	bench("line_horizontal", 0, testLineH, 64);
+	bench("line_vertical", 0, testLineV, 64);
+	bench("line", 0, testLine, 64);
+	bench("fill_8x8", 0, testFillSmall, 64);
+	bench("fill", 0, testFill, 16);
+	bench("clear", 0, testClear, 1);
+	bench("blit", 0, testBlit, 16);
+	#if GDISP_NEED_CIRCLE
+		bench("circle", 0, testCircle, 16);
+		bench("circle_fill", 0, testFillCircle, 16);
+	#endif
+	#if GDISP_NEED_ELLIPSE
+		bench("ellipse_fill", 0, testFillEllipse, 16);
+	#endif
+	#if GDISP_NEED_ARC
+		bench("arc", 0, testArc, 16);
+		bench("arc_fill", 0, testFillArc, 16);
+	#endif
+	#if GDISP_NEED_CONVEX_POLYGON
+		bench("polygon", 0, testPoly, 16);
+		bench("polygon_fill", 0, testFillPoly, 16);
+	#endif
+	#if GDISP_NEED_ALPHA
+		bench("fill_alpha", 0, testFillAlpha, 16);
+		bench("line_aa", 0, testLineAA, 64);
+		#if GDISP_NEED_CIRCLE
+			bench("circle_aa", 0, testCircleAA, 16);
+		#endif
+	#endif
+	#if GDISP_NEED_SCROLL
+		bench("scroll", 0, testScroll, 1);
+	#endif
+	#if GDISP_NEED_TEXT
+		benchFonts();
+	#endif
+	#if GDISP_NEED_IMAGE
+		benchImages();
+	#endif
+	#if GFX_USE_GWIN && GWIN_NEED_WIDGET
+		benchWidgets();
+	#endif
+
+	#if !BENCH_USE_STDIO
+		showResults();
+		while(TRUE)
+			gfxSleepMilliseconds(500);
+	#endif
 
 	return 0;
 }
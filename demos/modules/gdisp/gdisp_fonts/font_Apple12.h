@@ -145,6 +145,7 @@ const struct mf_rlefont_s mf_rlefont_phpoXxi1Y = {
     75, /* total dict count */
     1, /* char range count */
     mf_rlefont_phpoXxi1Y_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
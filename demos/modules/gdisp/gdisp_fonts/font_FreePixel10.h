@@ -128,6 +128,7 @@ const struct mf_bwfont_s mf_bwfont_phpdxISdS = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_phpdxISdS_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -123,6 +123,7 @@ const struct mf_rlefont_s mf_rlefont_phppBNCNS = {
     49, /* total dict count */
     1, /* char range count */
     mf_rlefont_phppBNCNS_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
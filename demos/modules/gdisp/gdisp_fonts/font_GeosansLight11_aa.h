@@ -187,6 +187,7 @@ const struct mf_rlefont_s mf_rlefont_phpTJ5Kmd = {
     83, /* total dict count */
     1, /* char range count */
     mf_rlefont_phpTJ5Kmd_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -188,6 +188,7 @@ const struct mf_rlefont_s mf_rlefont_phptTISF3 = {
     99, /* total dict count */
     1, /* char range count */
     mf_rlefont_phptTISF3_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -133,6 +133,7 @@ const struct mf_rlefont_s mf_rlefont_phptWBvQt = {
     69, /* total dict count */
     1, /* char range count */
     mf_rlefont_phptWBvQt_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -184,6 +184,7 @@ const struct mf_rlefont_s mf_rlefont_phpMM3UuI = {
     97, /* total dict count */
     1, /* char range count */
     mf_rlefont_phpMM3UuI_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -169,6 +169,7 @@ const struct mf_rlefont_s mf_rlefont_phpMbOYHb = {
     80, /* total dict count */
     1, /* char range count */
     mf_rlefont_phpMbOYHb_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -0,0 +1,724 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * @file    drivers/gdisp/Framebuffer/gdisp_lld.c
+ * @brief   GDISP Graphics Driver subsystem low level driver source for an in-memory framebuffer.
+ *
+ * @details	This driver renders into RAM only. It needs no display hardware
+ * 			and no window system which makes it suitable for automated testing,
+ * 			benchmarking and off-screen rendering.
+ *
+ * @addtogroup GDISP
+ * @{
+ */
+
+#include "gfx.h"
+
+#if GFX_USE_GDISP /*|| defined(__DOXYGEN__)*/
+
+/* Include the emulation code for things we don't support */
+#include "gdisp/lld/emulation.c"
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief   The header placed at the start of the shared memory segment.
+ * @note	Only used if GDISP_FRAMEBUFFER_SHM_NAME is defined.
+ * @note	The pixel data immediately follows the header.
+ */
+typedef struct fbShmHeader {
+	uint32_t			magic;				// GDISP_FRAMEBUFFER_SHM_MAGIC
+	uint32_t			pixelformat;		// GDISP_PIXELFORMAT
+	uint16_t			width;				// GDISP_SCREEN_WIDTH
+	uint16_t			height;				// GDISP_SCREEN_HEIGHT
+	uint16_t			bytesperpixel;		// sizeof(pixel_t)
+	uint16_t			orientation;		// The current gdisp_orientation_t
+	volatile uint32_t	frame;				// Incremented by GDISP_CONTROL_LLD_FLUSH or gdispFlush()
+} fbShmHeader;
+
+#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#ifndef GDISP_SCREEN_WIDTH
+	#define GDISP_SCREEN_WIDTH		640
+#endif
+#ifndef GDISP_SCREEN_HEIGHT
+	#define GDISP_SCREEN_HEIGHT		480
+#endif
+
+/*===========================================================================*/
+/* Driver local variables.                                                   */
+/*===========================================================================*/
+
+#define FB_SIZE		((size_t)GDISP_SCREEN_WIDTH * (size_t)GDISP_SCREEN_HEIGHT)
+
+#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+	static fbShmHeader *	fbHeader;
+	static pixel_t *		fbuf;
+#else
+	static pixel_t			fbStatic[FB_SIZE];
+	#define fbuf			fbStatic
+#endif
+
+/* The framebuffer offset for moving one logical pixel across */
+static int	fbXStep;
+
+/*===========================================================================*/
+/* Driver local routines.                                                    */
+/*===========================================================================*/
+
+/**
+ * @brief   Return the framebuffer address of a logical (ie rotated) pixel position.
+ *
+ * @notapi
+ */
+static pixel_t *fbpos(coord_t x, coord_t y) {
+	#if GDISP_NEED_CONTROL
+		switch(GDISP.Orientation) {
+		case GDISP_ROTATE_90:
+			return fbuf + (size_t)x*GDISP_SCREEN_WIDTH + (GDISP.Height - 1 - y);
+		case GDISP_ROTATE_180:
+			return fbuf + (size_t)(GDISP.Height - 1 - y)*GDISP_SCREEN_WIDTH + (GDISP.Width - 1 - x);
+		case GDISP_ROTATE_270:
+			return fbuf + (size_t)(GDISP.Width - 1 - x)*GDISP_SCREEN_WIDTH + y;
+		default:
+			break;
+		}
+	#endif
+	return fbuf + (size_t)y*GDISP_SCREEN_WIDTH + x;
+}
+
+/**
+ * @brief   Set the pixel step to match the current orientation.
+ *
+ * @notapi
+ */
+static void fbsetsteps(void) {
+	#if GDISP_NEED_CONTROL
+		switch(GDISP.Orientation) {
+		case GDISP_ROTATE_90:
+			fbXStep = GDISP_SCREEN_WIDTH;
+			return;
+		case GDISP_ROTATE_180:
+			fbXStep = -1;
+			return;
+		case GDISP_ROTATE_270:
+			fbXStep = -GDISP_SCREEN_WIDTH;
+			return;
+		default:
+			break;
+		}
+	#endif
+	fbXStep = 1;
+}
+
+#if GDISP_NEED_CONTROL
+	/* Calculate a PNG chunk CRC */
+	static uint32_t crc32update(uint32_t crc, const uint8_t *p, size_t len) {
+		unsigned	k;
+
+		crc = ~crc;
+		while (len--) {
+			crc ^= *p++;
+			for (k = 0; k < 8; k++)
+				crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+		return ~crc;
+	}
+
+	static void putbe32(uint8_t *p, uint32_t v) {
+		p[0] = (uint8_t)(v >> 24);
+		p[1] = (uint8_t)(v >> 16);
+		p[2] = (uint8_t)(v >> 8);
+		p[3] = (uint8_t)v;
+	}
+
+	static void pngchunk(FILE *f, const char *type, const uint8_t *data, uint32_t len) {
+		uint8_t		hdr[8];
+		uint32_t	crc;
+
+		putbe32(hdr, len);
+		memcpy(hdr+4, type, 4);
+		crc = crc32update(0, hdr+4, 4);
+		crc = crc32update(crc, data, len);
+		fwrite(hdr, 1, 8, f);
+		if (len)
+			fwrite(data, 1, len, f);
+		putbe32(hdr, crc);
+		fwrite(hdr, 1, 4, f);
+	}
+
+	/**
+	 * @brief   Write the current frame (in the current orientation) to a file.
+	 * @return	TRUE on success
+	 * @note	PNG files are written using stored (uncompressed) deflate blocks
+	 * 			so that no compression library is required.
+	 *
+	 * @param[in] fname		The file to write
+	 * @param[in] isPNG		TRUE for a PNG file, FALSE for a binary PPM file
+	 *
+	 * @notapi
+	 */
+	static bool_t fbdump(const char *fname, bool_t isPNG) {
+		FILE		*f;
+		uint8_t		*raw, *pd, *zbuf, *pz;
+		pixel_t		*ps;
+		size_t		linesz, rawsz, pos, blk;
+		uint32_t	a1, a2;
+		coord_t		x, y;
+
+		if (!fname)
+			return FALSE;
+
+		/* Convert the frame to 24 bit RGB. For PNG each line is prefixed by a filter byte. */
+		linesz = (size_t)GDISP.Width * 3 + (isPNG ? 1 : 0);
+		rawsz = linesz * GDISP.Height;
+		if (!(raw = (uint8_t *)gfxAlloc(rawsz)))
+			return FALSE;
+		for(pd = raw, y = 0; y < GDISP.Height; y++) {
+			if (isPNG)
+				*pd++ = 0;
+			for(ps = fbpos(0, y), x = 0; x < GDISP.Width; x++, ps += fbXStep) {
+				*pd++ = RED_OF(*ps);
+				*pd++ = GREEN_OF(*ps);
+				*pd++ = BLUE_OF(*ps);
+			}
+		}
+
+		if (!(f = fopen(fname, "wb"))) {
+			gfxFree(raw);
+			return FALSE;
+		}
+
+		if (!isPNG) {
+			fprintf(f, "P6\n%d %d\n255\n", GDISP.Width, GDISP.Height);
+			fwrite(raw, 1, rawsz, f);
+			gfxFree(raw);
+			fclose(f);
+			return TRUE;
+		}
+
+		/* Wrap the image in a zlib stream of stored blocks */
+		if (!(zbuf = (uint8_t *)gfxAlloc(rawsz + 6 + 5 * (rawsz / 65535 + 1)))) {
+			gfxFree(raw);
+			fclose(f);
+			return FALSE;
+		}
+		pz = zbuf;
+		*pz++ = 0x78;
+		*pz++ = 0x01;
+		for(pos = 0; pos < rawsz; pos += blk) {
+			blk = rawsz - pos;
+			if (blk > 65535)
+				blk = 65535;
+			*pz++ = pos + blk >= rawsz ? 1 : 0;
+			*pz++ = (uint8_t)blk;
+			*pz++ = (uint8_t)(blk >> 8);
+			*pz++ = (uint8_t)~blk;
+			*pz++ = (uint8_t)(~blk >> 8);
+			memcpy(pz, raw+pos, blk);
+			pz += blk;
+		}
+		for(a1 = 1, a2 = 0, pd = raw; pd < raw + rawsz; pd++) {
+			a1 = (a1 + *pd) % 65521;
+			a2 = (a2 + a1) % 65521;
+		}
+		putbe32(pz, (a2 << 16) | a1);
+		pz += 4;
+
+		fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+		putbe32(raw, GDISP.Width);
+		putbe32(raw+4, GDISP.Height);
+		raw[8] = 8;					// Bit depth
+		raw[9] = 2;					// Truecolor
+		raw[10] = raw[11] = raw[12] = 0;
+		pngchunk(f, "IHDR", raw, 13);
+		pngchunk(f, "IDAT", zbuf, (uint32_t)(pz - zbuf));
+		pngchunk(f, "IEND", 0, 0);
+
+		gfxFree(zbuf);
+		gfxFree(raw);
+		fclose(f);
+		return TRUE;
+	}
+#endif
+
+/*===========================================================================*/
+/* Driver exported functions.                                                */
+/*===========================================================================*/
+
+/* ---- Required Routines ---- */
+/*
+	The following 2 routines are required.
+	All other routines are optional.
+*/
+
+/**
+ * @brief   Low level GDISP driver initialisation.
+ * @return	TRUE if successful, FALSE on error.
+ *
+ * @notapi
+ */
+bool_t gdisp_lld_init(void) {
+	#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+		int		fd;
+		size_t	sz;
+
+		/* Place the framebuffer in a POSIX shared memory segment so other processes can read it */
+		sz = sizeof(fbShmHeader) + FB_SIZE * sizeof(pixel_t);
+		if ((fd = shm_open(GDISP_FRAMEBUFFER_SHM_NAME, O_CREAT|O_RDWR, 0666)) < 0) {
+			fprintf(stderr, "Cannot open framebuffer shared memory %s\n", GDISP_FRAMEBUFFER_SHM_NAME);
+			return FALSE;
+		}
+		if (ftruncate(fd, sz) < 0
+				|| (fbHeader = (fbShmHeader *)mmap(0, sz, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0)) == (fbShmHeader *)MAP_FAILED) {
+			fprintf(stderr, "Cannot map framebuffer shared memory %s\n", GDISP_FRAMEBUFFER_SHM_NAME);
+			close(fd);
+			return FALSE;
+		}
+		close(fd);
+		fbuf = (pixel_t *)(fbHeader+1);
+		fbHeader->pixelformat = GDISP_PIXELFORMAT;
+		fbHeader->width = GDISP_SCREEN_WIDTH;
+		fbHeader->height = GDISP_SCREEN_HEIGHT;
+		fbHeader->bytesperpixel = sizeof(pixel_t);
+		fbHeader->orientation = GDISP_ROTATE_0;
+		fbHeader->frame = 0;
+		fbHeader->magic = GDISP_FRAMEBUFFER_SHM_MAGIC;
+	#endif
+
+	/* Initialise the GDISP structure to match */
+	GDISP.Orientation = GDISP_ROTATE_0;
+	GDISP.Powermode = powerOn;
+	GDISP.Backlight = 100;
+	GDISP.Contrast = 50;
+	GDISP.Width = GDISP_SCREEN_WIDTH;
+	GDISP.Height = GDISP_SCREEN_HEIGHT;
+	#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+		GDISP.clipx0 = 0;
+		GDISP.clipy0 = 0;
+		GDISP.clipx1 = GDISP.Width;
+		GDISP.clipy1 = GDISP.Height;
+	#endif
+	fbsetsteps();
+	return TRUE;
+}
+
+/**
+ * @brief   Draws a pixel on the display.
+ *
+ * @param[in] x        X location of the pixel
+ * @param[in] y        Y location of the pixel
+ * @param[in] color    The color of the pixel
+ *
+ * @notapi
+ */
+void gdisp_lld_draw_pixel(coord_t x, coord_t y, color_t color) {
+	#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+		if (x < GDISP.clipx0 || y < GDISP.clipy0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+	#endif
+
+	*fbpos(x, y) = color;
+}
+
+/* ---- Optional Routines ---- */
+
+#if GDISP_HARDWARE_FILLS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill an area with a color.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The start filled area
+	 * @param[in] cx, cy   The width and height to be filled
+	 * @param[in] color    The color of the fill
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_fill_area(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
+		pixel_t		*p, *pe, *line;
+		coord_t		t;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		/* A rotated rectangle is still a rectangle - convert it to framebuffer coordinates */
+		#if GDISP_NEED_CONTROL
+			switch(GDISP.Orientation) {
+			case GDISP_ROTATE_90:
+				t = x;
+				x = GDISP.Height - y - cy;
+				y = t;
+				t = cx; cx = cy; cy = t;
+				break;
+			case GDISP_ROTATE_180:
+				x = GDISP.Width - x - cx;
+				y = GDISP.Height - y - cy;
+				break;
+			case GDISP_ROTATE_270:
+				t = y;
+				y = GDISP.Width - x - cx;
+				x = t;
+				t = cx; cx = cy; cy = t;
+				break;
+			default:
+				break;
+			}
+		#else
+			(void) t;
+		#endif
+
+		/* Fill the first line and then copy it to each of the other lines */
+		line = fbuf + (size_t)y*GDISP_SCREEN_WIDTH + x;
+		for(p = line, pe = line+cx; p < pe; p++)
+			*p = color;
+		for(p = line + GDISP_SCREEN_WIDTH; --cy > 0; p += GDISP_SCREEN_WIDTH)
+			memcpy(p, line, cx * sizeof(pixel_t));
+	}
+#endif
+
+#if GDISP_HARDWARE_BITFILLS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill an area with a bitmap.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The start filled area
+	 * @param[in] cx, cy   The width and height to be filled
+	 * @param[in] srcx, srcy   The bitmap position to start the fill from
+	 * @param[in] srccx    The width of a line in the bitmap.
+	 * @param[in] buffer   The pixels to use to fill the area.
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_blit_area_ex(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
+		pixel_t			*p;
+		const pixel_t	*s;
+		coord_t			i;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; srcx += GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; srcy += GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (srcx+cx > srccx)		cx = srccx - srcx;
+			if (cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		buffer += (size_t)srcy*srccx + srcx;
+		if (fbXStep == 1) {
+			for(; cy; cy--, y++, buffer += srccx)
+				memcpy(fbpos(x, y), buffer, cx * sizeof(pixel_t));
+		} else {
+			for(; cy; cy--, y++, buffer += srccx)
+				for(p = fbpos(x, y), s = buffer, i = cx; i; i--, p += fbXStep)
+					*p = *s++;
+		}
+	}
+#endif
+
+#if (GDISP_NEED_ALPHA && GDISP_HARDWARE_ALPHA) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Blend a color into a pixel.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The pixel to blend
+	 * @param[in] color    The color to blend in
+	 * @param[in] alpha    The opacity of the color (0-255)
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_blend_pixel(coord_t x, coord_t y, color_t color, uint8_t alpha) {
+		pixel_t		*p;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0 || y < GDISP.clipy0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+		#endif
+
+		p = fbpos(x, y);
+		*p = gdisp_lld_blend_color(color, *p, alpha);
+	}
+
+	/**
+	 * @brief   Blend a color over an area.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The start of the area
+	 * @param[in] cx, cy   The width and height of the area
+	 * @param[in] color    The color to blend in
+	 * @param[in] alpha    The opacity of the color (0-255)
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_fill_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha) {
+		pixel_t		*p;
+		coord_t		i;
+
+		if (alpha == 255) {
+			gdisp_lld_fill_area(x, y, cx, cy, color);
+			return;
+		}
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (!alpha || cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		for(; cy; cy--, y++)
+			for(p = fbpos(x, y), i = cx; i; i--, p += fbXStep)
+				*p = gdisp_lld_blend_color(color, *p, alpha);
+	}
+
+	/**
+	 * @brief   Blend a bitmap over an area.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The start of the area
+	 * @param[in] cx, cy   The width and height of the area
+	 * @param[in] srcx, srcy   The bitmap position to start the fill from
+	 * @param[in] srccx    The width of a line in the bitmap.
+	 * @param[in] buffer   The pixels to blend in
+	 * @param[in] alpha    The opacity of the bitmap (0-255)
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_blit_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha) {
+		pixel_t			*p;
+		const pixel_t	*s;
+		coord_t			i;
+
+		if (alpha == 255) {
+			gdisp_lld_blit_area_ex(x, y, cx, cy, srcx, srcy, srccx, buffer);
+			return;
+		}
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; srcx += GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; srcy += GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (srcx+cx > srccx)		cx = srccx - srcx;
+			if (!alpha || cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		buffer += (size_t)srcy*srccx + srcx;
+		for(; cy; cy--, y++, buffer += srccx)
+			for(p = fbpos(x, y), s = buffer, i = cx; i; i--, p += fbXStep)
+				*p = gdisp_lld_blend_color(*s++, *p, alpha);
+	}
+#endif
+
+#if (GDISP_NEED_PIXELREAD && GDISP_HARDWARE_PIXELREAD) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Get the color of a particular pixel.
+	 * @note    Optional.
+	 * @note    If x,y is off the screen, the result is undefined.
+	 * @return	The color of the specified pixel.
+	 *
+	 * @param[in] x, y     The pixel to be read
+	 *
+	 * @notapi
+	 */
+	color_t gdisp_lld_get_pixel_color(coord_t x, coord_t y) {
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < 0 || x >= GDISP.Width || y < 0 || y >= GDISP.Height) return 0;
+		#endif
+
+		return *fbpos(x, y);
+	}
+#endif
+
+#if (GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Scroll vertically a section of the screen.
+	 * @note    Optional.
+	 * @note    If x,y + cx,cy is off the screen, the result is undefined.
+	 * @note    If lines is >= cy, it is equivelent to a area fill with bgcolor.
+	 *
+	 * @param[in] x, y     The start of the area to be scrolled
+	 * @param[in] cx, cy   The size of the area to be scrolled
+	 * @param[in] lines    The number of lines to scroll (Can be positive or negative)
+	 * @param[in] bgcolor  The color to fill the newly exposed area.
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_vertical_scroll(coord_t x, coord_t y, coord_t cx, coord_t cy, int lines, color_t bgcolor) {
+		pixel_t		*d, *s;
+		coord_t		i, j;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (!lines || cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		if (lines > cy) lines = cy;
+		else if (-lines > cy) lines = -cy;
+
+		if (lines > 0) {
+			for(j = 0; j < cy - lines; j++) {
+				d = fbpos(x, y+j);
+				s = fbpos(x, y+j+lines);
+				if (fbXStep == 1)
+					memcpy(d, s, cx * sizeof(pixel_t));
+				else
+					for(i = cx; i; i--, d += fbXStep, s += fbXStep)
+						*d = *s;
+			}
+			gdisp_lld_fill_area(x, y+cy-lines, cx, lines, bgcolor);
+		} else {
+			for(j = cy-1; j >= -lines; j--) {
+				d = fbpos(x, y+j);
+				s = fbpos(x, y+j+lines);
+				if (fbXStep == 1)
+					memcpy(d, s, cx * sizeof(pixel_t));
+				else
+					for(i = cx; i; i--, d += fbXStep, s += fbXStep)
+						*d = *s;
+			}
+			gdisp_lld_fill_area(x, y, cx, -lines, bgcolor);
+		}
+	}
+#endif
+
+#if (GDISP_NEED_AUTOFLUSH && GDISP_HARDWARE_FLUSH) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Mark a changed area as complete.
+	 * @note	The framebuffer is always up to date so this just tells a
+	 * 			shared memory reader that a new frame is available.
+	 *
+	 * @param[in] x, y     The start of the changed area
+	 * @param[in] cx, cy   The size of the changed area
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_flush(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		(void) x;
+		(void) y;
+		(void) cx;
+		(void) cy;
+
+		#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+			fbHeader->frame++;
+		#endif
+	}
+#endif
+
+#if (GDISP_NEED_CONTROL && GDISP_HARDWARE_CONTROL) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Driver Control
+	 * @details	Unsupported control codes are ignored.
+	 * @note	The value parameter should always be typecast to (void *).
+	 * @note	There are some predefined and some specific to the low level driver.
+	 * @note	GDISP_CONTROL_POWER			- Takes a gdisp_powermode_t
+	 * 			GDISP_CONTROL_ORIENTATION	- Takes a gdisp_orientation_t
+	 * 			GDISP_CONTROL_BACKLIGHT -	 Takes an int from 0 to 100. For a driver
+	 * 											that only supports off/on anything other
+	 * 											than zero is on.
+	 * 			GDISP_CONTROL_CONTRAST		- Takes an int from 0 to 100.
+	 * 			GDISP_CONTROL_LLD_DUMP_PPM	- Takes a file name (const char *)
+	 * 			GDISP_CONTROL_LLD_DUMP_PNG	- Takes a file name (const char *)
+	 * 			GDISP_CONTROL_LLD_FLUSH		- Ignores the value
+	 *
+	 * @param[in] what		What to do.
+	 * @param[in] value		The value to use (always cast to a void *).
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_control(unsigned what, void *value) {
+		switch(what) {
+		case GDISP_CONTROL_POWER:
+			GDISP.Powermode = (gdisp_powermode_t)value;
+			return;
+		case GDISP_CONTROL_ORIENTATION:
+			if (GDISP.Orientation == (gdisp_orientation_t)value)
+				return;
+			switch((gdisp_orientation_t)value) {
+				case GDISP_ROTATE_0:
+				case GDISP_ROTATE_180:
+					GDISP.Width = GDISP_SCREEN_WIDTH;
+					GDISP.Height = GDISP_SCREEN_HEIGHT;
+					break;
+				case GDISP_ROTATE_90:
+				case GDISP_ROTATE_270:
+					GDISP.Height = GDISP_SCREEN_WIDTH;
+					GDISP.Width = GDISP_SCREEN_HEIGHT;
+					break;
+				default:
+					return;
+			}
+
+			#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+				GDISP.clipx0 = 0;
+				GDISP.clipy0 = 0;
+				GDISP.clipx1 = GDISP.Width;
+				GDISP.clipy1 = GDISP.Height;
+			#endif
+			GDISP.Orientation = (gdisp_orientation_t)value;
+			fbsetsteps();
+			#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+				fbHeader->orientation = GDISP.Orientation;
+			#endif
+			return;
+		case GDISP_CONTROL_BACKLIGHT:
+			if ((unsigned)(size_t)value > 100) value = (void *)100;
+			GDISP.Backlight = (unsigned)(size_t)value;
+			return;
+		case GDISP_CONTROL_CONTRAST:
+			if ((unsigned)(size_t)value > 100) value = (void *)100;
+			GDISP.Contrast = (unsigned)(size_t)value;
+			return;
+		case GDISP_CONTROL_LLD_DUMP_PPM:
+			fbdump((const char *)value, FALSE);
+			return;
+		case GDISP_CONTROL_LLD_DUMP_PNG:
+			fbdump((const char *)value, TRUE);
+			return;
+		case GDISP_CONTROL_LLD_FLUSH:
+			#if defined(GDISP_FRAMEBUFFER_SHM_NAME)
+				fbHeader->frame++;
+			#endif
+			return;
+		}
+	}
+#endif
+
+#if (GDISP_NEED_QUERY && GDISP_HARDWARE_QUERY) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Query a driver value.
+	 * @details	Typecast the result to the type you want.
+	 * @note	GDISP_QUERY_LLD_FRAMEBUFFER	- Returns the framebuffer (pixel_t *)
+	 *
+	 * @param[in] what     What to query
+	 *
+	 * @notapi
+	 */
+	void *gdisp_lld_query(unsigned what) {
+		switch(what) {
+		case GDISP_QUERY_LLD_FRAMEBUFFER:
+			return (void *)fbuf;
+		}
+		return (void *)-1;
+	}
+#endif
+
+#endif /* GFX_USE_GDISP */
+/** @} */
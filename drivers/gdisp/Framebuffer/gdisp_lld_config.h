@@ -0,0 +1,78 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * @file    drivers/gdisp/Framebuffer/gdisp_lld_config.h
+ * @brief   GDISP Graphic Driver subsystem low level driver header for the in-memory framebuffer.
+ *
+ * @addtogroup GDISP
+ * @{
+ */
+
+#ifndef _GDISP_LLD_CONFIG_H
+#define _GDISP_LLD_CONFIG_H
+
+#if GFX_USE_GDISP
+
+/*===========================================================================*/
+/* Driver hardware support.                                                  */
+/*===========================================================================*/
+
+#define GDISP_DRIVER_NAME				"Framebuffer"
+
+#define GDISP_HARDWARE_FILLS			TRUE
+#define GDISP_HARDWARE_BITFILLS			TRUE
+#define GDISP_HARDWARE_SCROLL			TRUE
+#define GDISP_HARDWARE_PIXELREAD		TRUE
+#define GDISP_HARDWARE_ALPHA			TRUE
+#define GDISP_HARDWARE_CONTROL			TRUE
+#define GDISP_HARDWARE_QUERY			TRUE
+#define GDISP_HARDWARE_FLUSH			TRUE
+
+/* Any of the non-packed pixel formats may be selected in gfxconf.h */
+#ifndef GDISP_PIXELFORMAT
+	#define GDISP_PIXELFORMAT			GDISP_PIXELFORMAT_RGB888
+#endif
+#define GDISP_PACKED_PIXELS				FALSE
+#define GDISP_PACKED_LINES				FALSE
+
+/*===========================================================================*/
+/* Driver specific control and query codes.                                  */
+/*===========================================================================*/
+
+/**
+ * @brief   Write the current frame to a binary PPM (P6) file.
+ * @note	The value parameter is the file name (const char *).
+ */
+#define GDISP_CONTROL_LLD_DUMP_PPM		(GDISP_CONTROL_LLD + 0)
+
+/**
+ * @brief   Write the current frame to an (uncompressed) PNG file.
+ * @note	The value parameter is the file name (const char *).
+ */
+#define GDISP_CONTROL_LLD_DUMP_PNG		(GDISP_CONTROL_LLD + 1)
+
+/**
+ * @brief   Mark the current frame as complete.
+ * @details	Increments the frame counter in the shared memory header so that
+ * 			an external reader knows a new frame is available.
+ */
+#define GDISP_CONTROL_LLD_FLUSH			(GDISP_CONTROL_LLD + 2)
+
+/**
+ * @brief   Return a pointer to the raw framebuffer (pixel_t *).
+ * @note	The framebuffer is always stored in the GDISP_ROTATE_0 orientation
+ * 			with a line length of GDISP_SCREEN_WIDTH pixels.
+ */
+#define GDISP_QUERY_LLD_FRAMEBUFFER		(GDISP_QUERY_LLD + 0)
+
+#define GDISP_FRAMEBUFFER_SHM_MAGIC		0x42464755		/* "UGFB" */
+
+#endif	/* GFX_USE_GDISP */
+
+#endif	/* _GDISP_LLD_CONFIG_H */
+/** @} */
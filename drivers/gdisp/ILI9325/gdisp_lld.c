@@ -324,6 +324,41 @@ void gdisp_lld_draw_pixel(coord_t x, coord_t y, color_t color) {
 	}
 #endif
 
+#if GDISP_HARDWARE_SPANS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill a list of horizontal spans with a color.
+	 * @note    Optional - The high level driver can emulate using software.
+	 * @note	Circles, ellipses, arcs and polygons arrive here as one batch.
+	 *
+	 * @param[in] spans    The spans to fill
+	 * @param[in] cnt      The number of spans
+	 * @param[in] color    The color of the fill
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_fill_spans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+		coord_t	x, cx;
+
+		for(; cnt; cnt--, spans++) {
+			x = spans->x;
+			cx = spans->cx;
+			#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+				if (spans->y < GDISP.clipy0 || spans->y >= GDISP.clipy1) continue;
+				if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+				if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+				if (cx <= 0) continue;
+			#endif
+
+			lld_lcdSetViewPort(x, spans->y, cx, 1);
+			lld_lcdWriteStreamStart();
+			for(; cx; cx--)
+				lld_lcdWriteData(color);
+			lld_lcdWriteStreamStop();
+		}
+		lld_lcdResetViewPort();
+	}
+#endif
+
 #if GDISP_HARDWARE_BITFILLS || defined(__DOXYGEN__)
 	void gdisp_lld_blit_area_ex(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
 		coord_t endx, endy;
@@ -27,6 +27,7 @@
 #define GDISP_HARDWARE_CLEARS			TRUE
 #define GDISP_HARDWARE_FILLS			TRUE
 #define GDISP_HARDWARE_BITFILLS			FALSE
+#define GDISP_HARDWARE_SPANS			TRUE
 #define GDISP_HARDWARE_SCROLL			FALSE
 #define GDISP_HARDWARE_PIXELREAD		TRUE
 #define GDISP_HARDWARE_CONTROL			TRUE
@@ -342,6 +342,42 @@ void gdisp_lld_draw_pixel(coord_t x, coord_t y, color_t color) {
 	}
 #endif
 
+#if GDISP_HARDWARE_SPANS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill a list of horizontal spans with a color.
+	 * @note    Optional - The high level driver can emulate using software.
+	 * @note	Circles, ellipses, arcs and polygons arrive here as one batch within a single bus transaction.
+	 *
+	 * @param[in] spans    The spans to fill
+	 * @param[in] cnt      The number of spans
+	 * @param[in] color    The color of the fill
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_fill_spans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+		coord_t	x, cx;
+
+		acquire_bus();
+		for(; cnt; cnt--, spans++) {
+			x = spans->x;
+			cx = spans->cx;
+			#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+				if (spans->y < GDISP.clipy0 || spans->y >= GDISP.clipy1) continue;
+				if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+				if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+				if (cx <= 0) continue;
+			#endif
+
+			set_viewport(x, spans->y, cx, 1);
+			stream_start();
+			for(; cx; cx--)
+				write_data(color);
+			stream_stop();
+		}
+		release_bus();
+	}
+#endif
+
 #if GDISP_HARDWARE_BITFILLS || defined(__DOXYGEN__)
 	/**
 	 * @brief   Fill an area with a bitmap.
@@ -366,6 +366,38 @@ void gdisp_lld_display() {
 	}
 }
 
+#if (GDISP_NEED_AUTOFLUSH && GDISP_HARDWARE_FLUSH) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Send a changed area of the display buffer to the display.
+	 * @note	Only the pages and columns covering the area are sent.
+	 *
+	 * @param[in] x, y     The start of the changed area
+	 * @param[in] cx, cy   The size of the changed area
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_flush(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		coord_t		page, lastpage;
+
+		if (x < 0) { cx += x; x = 0; }
+		if (y < 0) { cy += y; y = 0; }
+		if (x+cx > GDISP_SCREEN_WIDTH)	cx = GDISP_SCREEN_WIDTH - x;
+		if (y+cy > GDISP_SCREEN_HEIGHT)	cy = GDISP_SCREEN_HEIGHT - y;
+		if (cx <= 0 || cy <= 0) return;
+
+		page = y/8;
+		lastpage = (y+cy-1)/8;
+		set_column_address_hvam(x, x+cx-1);
+		set_page_address_hvam(page, lastpage);
+		for(; page <= lastpage; page++)
+			write_data(&gdisp_buffer[page*GDISP_SCREEN_WIDTH + x], cx);
+
+		// Restore the full window used by gdisp_lld_display()
+		set_column_address_hvam(0, GDISP_SCREEN_WIDTH-1);
+		set_page_address_hvam(0, GDISP_SCREEN_HEIGHT/8-1);
+	}
+#endif
+
 /* ---- Optional Routines ---- */
 /*
 	All the below routines are optional.
@@ -22,6 +22,7 @@
 #define GDISP_HARDWARE_SCROLL			TRUE
 #define GDISP_HARDWARE_PIXELREAD		FALSE
 #define GDISP_HARDWARE_CONTROL			TRUE
+#define GDISP_HARDWARE_FLUSH			TRUE
 
 #define GDISP_PIXELFORMAT				GDISP_PIXELFORMAT_MONO
 
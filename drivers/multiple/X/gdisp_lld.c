@@ -25,6 +25,22 @@
 	#define GDISP_FORCE_24BIT	FALSE
 #endif
 
+/**
+ * Use the MIT-SHM extension for the client side image if the X server supports it.
+ * Requires linking with -lXext. If the server can't share memory with us
+ * (eg. a remote display) we fall back to a normal XImage automatically.
+ */
+#ifndef GDISP_X_USE_SHM
+	#define GDISP_X_USE_SHM		TRUE
+#endif
+
+/**
+ * How often (in milliseconds) changed areas of the image are pushed to the window.
+ */
+#ifndef GDISP_X_FLUSH_PERIOD
+	#define GDISP_X_FLUSH_PERIOD	20
+#endif
+
 #if GINPUT_NEED_MOUSE
 	/* Include mouse support code */
 	#include "ginput/lld/mouse.h"
@@ -37,6 +53,12 @@
 #include <X11/Xutil.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#if GDISP_X_USE_SHM
+	#include <sys/ipc.h>
+	#include <sys/shm.h>
+	#include <X11/extensions/XShm.h>
+#endif
 
 #ifndef GDISP_SCREEN_HEIGHT
 	#define GDISP_SCREEN_HEIGHT		480
@@ -48,7 +70,6 @@
 Display			*dis;
 int				scr;
 Window			win;
-Pixmap			pix;
 XEvent			evt;
 GC 				gc;
 Colormap		cmap;
@@ -59,15 +80,120 @@ int				depth;
 	uint16_t		mousebuttons;
 #endif
 
-static void ProcessEvent(void) {
-	XColor	col;
+/* The client side image we draw into. It is pushed to the window by the X thread. */
+static XImage *			img;
+static gfxMutex			imgMutex;
+static bool_t			img32;				// The image uses native byte order 32 bit pixels
+static bool_t			imgDirect;			// ... and those pixels are laid out exactly as a pixel_t
+#if GDISP_X_USE_SHM
+	static XShmSegmentInfo	shminfo;
+	static bool_t			useshm;
+	static bool_t			shmfailed;
+#endif
+
+/* The area of the image that has changed since it was last pushed to the window */
+static coord_t			dirtyx0, dirtyy0, dirtyx1, dirtyy1;
+
+/* The color_t to X pixel conversion tables for TrueColor visuals */
+static bool_t			truecolor;
+static unsigned long	ctabRed[256], ctabGreen[256], ctabBlue[256];
+
+#define imgpos(x, y)	((uint32_t *)(img->data + (size_t)(y) * img->bytes_per_line) + (x))
+
+/**
+ * @brief   Build the lookup table converting an 8 bit color channel to its X pixel bits.
+ *
+ * @param[in] tab		The table to fill
+ * @param[in] mask		The visual's mask for this channel
+ *
+ * @notapi
+ */
+static void xbuildtab(unsigned long *tab, unsigned long mask) {
+	unsigned	shift, bits, i;
+
+	for(shift = 0; mask && !(mask & 1); shift++, mask >>= 1);
+	for(bits = 0; mask & 1; bits++, mask >>= 1);
+	for(i = 0; i < 256; i++)
+		tab[i] = (bits <= 8 ? (unsigned long)i >> (8-bits) : (unsigned long)i << (bits-8)) << shift;
+}
+
+/**
+ * @brief   Convert a color to an X pixel value.
+ * @note	Non-TrueColor visuals need a round trip to the server so a single
+ * 			entry cache is used to make runs of the same color cheap.
+ *
+ * @param[in] color		The color to convert
+ *
+ * @notapi
+ */
+static unsigned long xpixel(color_t color) {
+	static color_t			lastcolor;
+	static unsigned long	lastpixel;
+	static bool_t			lastvalid;
+	XColor					col;
+
+	if (truecolor)
+		return ctabRed[RED_OF(color)] | ctabGreen[GREEN_OF(color)] | ctabBlue[BLUE_OF(color)];
+
+	if (!lastvalid || color != lastcolor) {
+		col.red = RED_OF(color) << 8;
+		col.green = GREEN_OF(color) << 8;
+		col.blue = BLUE_OF(color) << 8;
+		XAllocColor(dis, cmap, &col);
+		lastcolor = color;
+		lastpixel = col.pixel;
+		lastvalid = TRUE;
+	}
+	return lastpixel;
+}
 
+/**
+ * @brief   Add an area to the dirty rectangle.
+ * @pre		imgMutex must be held.
+ *
+ * @notapi
+ */
+static void xdirty(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+	if (dirtyx0 >= dirtyx1) {
+		dirtyx0 = x;
+		dirtyy0 = y;
+		dirtyx1 = x + cx;
+		dirtyy1 = y + cy;
+		return;
+	}
+	if (x < dirtyx0)		dirtyx0 = x;
+	if (y < dirtyy0)		dirtyy0 = y;
+	if (x + cx > dirtyx1)	dirtyx1 = x + cx;
+	if (y + cy > dirtyy1)	dirtyy1 = y + cy;
+}
+
+/**
+ * @brief   Push the dirty rectangle to the window.
+ * @note	Only called from the X thread.
+ *
+ * @notapi
+ */
+static void xflush(void) {
+	gfxMutexEnter(&imgMutex);
+	if (dirtyx0 < dirtyx1) {
+		#if GDISP_X_USE_SHM
+			if (useshm)
+				XShmPutImage(dis, win, gc, img, dirtyx0, dirtyy0, dirtyx0, dirtyy0, dirtyx1 - dirtyx0, dirtyy1 - dirtyy0, False);
+			else
+		#endif
+				XPutImage(dis, win, gc, img, dirtyx0, dirtyy0, dirtyx0, dirtyy0, dirtyx1 - dirtyx0, dirtyy1 - dirtyy0);
+		dirtyx0 = dirtyx1 = 0;
+	}
+	gfxMutexExit(&imgMutex);
+	XFlush(dis);
+}
+
+static void ProcessEvent(void) {
 	switch(evt.type) {
 	case Expose:
-		XCopyArea(dis, pix, win, gc,
-			evt.xexpose.x, evt.xexpose.y,
-			evt.xexpose.width, evt.xexpose.height,   
-			evt.xexpose.x, evt.xexpose.y);
+		gfxMutexEnter(&imgMutex);
+		xdirty(evt.xexpose.x, evt.xexpose.y, evt.xexpose.width, evt.xexpose.height);
+		gfxMutexExit(&imgMutex);
 		break;
 #if GINPUT_NEED_MOUSE
 	case ButtonPress:
@@ -113,11 +239,12 @@ static DECLARE_THREAD_FUNCTION(ThreadX, arg) {
 	(void)arg;
 
 	while(1) {
-		gfxSleepMilliseconds(100);
+		gfxSleepMilliseconds(GDISP_X_FLUSH_PERIOD);
 		while(XPending(dis)) {
 			XNextEvent(dis, &evt);
 			ProcessEvent();
 		}
+		xflush();
 	}
 	return 0;
 }
@@ -130,6 +257,60 @@ static int FatalXIOError(Display *d) {
 	exit(0);
 }
 
+#if GDISP_X_USE_SHM
+	static int ShmError(Display *d, XErrorEvent *e) {
+		(void) d;
+		(void) e;
+
+		shmfailed = TRUE;
+		return 0;
+	}
+
+	/**
+	 * @brief   Try to create the image in memory shared with the X server.
+	 * @return	The image or NULL if shared memory is not available.
+	 *
+	 * @notapi
+	 */
+	static XImage *xshmimage(void) {
+		XImage *		im;
+		int				(*olderr)(Display *, XErrorEvent *);
+
+		if (!XShmQueryExtension(dis))
+			return 0;
+		if (!(im = XShmCreateImage(dis, vis.visual, vis.depth, ZPixmap, 0, &shminfo, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT)))
+			return 0;
+		if ((shminfo.shmid = shmget(IPC_PRIVATE, (size_t)im->bytes_per_line * im->height, IPC_CREAT|0600)) < 0) {
+			XDestroyImage(im);
+			return 0;
+		}
+		shminfo.shmaddr = im->data = shmat(shminfo.shmid, 0, 0);
+		shminfo.readOnly = False;
+		if (shminfo.shmaddr != (char *)-1) {
+			// A remote server fails the attach asynchronously - so catch the error
+			shmfailed = FALSE;
+			olderr = XSetErrorHandler(ShmError);
+			XShmAttach(dis, &shminfo);
+			XSync(dis, False);
+			XSetErrorHandler(olderr);
+		} else
+			shmfailed = TRUE;
+
+		// The segment is removed once both sides have detached
+		shmctl(shminfo.shmid, IPC_RMID, 0);
+
+		if (shmfailed) {
+			if (shminfo.shmaddr != (char *)-1)
+				shmdt(shminfo.shmaddr);
+			im->data = 0;
+			XDestroyImage(im);
+			return 0;
+		}
+		useshm = TRUE;
+		return im;
+	}
+#endif
+
 bool_t gdisp_lld_init(void)
 {
 	XSizeHints				*pSH;
@@ -154,12 +335,23 @@ bool_t gdisp_lld_init(void)
 		cmap = XCreateColormap(dis, RootWindow(dis, scr),
 				vis.visual, AllocNone);
 	#else
-		vis.visual = CopyFromParent;
+		vis.visual = DefaultVisual(dis, scr);
 		vis.depth = DefaultDepth(dis, scr);
 		cmap = DefaultColormap(dis, scr);
 	#endif
 	fprintf(stderr, "Running GFX Window in %d bit color\n", vis.depth);
 
+	#if defined(__cplusplus) || defined(c_plusplus)
+		truecolor = vis.visual->c_class == TrueColor;
+	#else
+		truecolor = vis.visual->class == TrueColor;
+	#endif
+	if (truecolor) {
+		xbuildtab(ctabRed, vis.visual->red_mask);
+		xbuildtab(ctabGreen, vis.visual->green_mask);
+		xbuildtab(ctabBlue, vis.visual->blue_mask);
+	}
+
 	xa.colormap = cmap;
 	xa.border_pixel = 0xFFFFFF;
 	xa.background_pixel = 0x000000;
@@ -184,9 +376,32 @@ bool_t gdisp_lld_init(void)
 	XFree(pSH);
 	XSync(dis, TRUE);
 	
-	pix = XCreatePixmap(dis, win, 
-				GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT, vis.depth);
-	XSync(dis, TRUE);
+	img = 0;
+	#if GDISP_X_USE_SHM
+		img = xshmimage();
+	#endif
+	if (!img) {
+		img = XCreateImage(dis, vis.visual, vis.depth, ZPixmap, 0, 0,
+				GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT, 32, 0);
+		if (!img || !(img->data = malloc((size_t)img->bytes_per_line * img->height))) {
+			fprintf(stderr, "Cannot create the display image\n");
+			XCloseDisplay(dis);
+			return FALSE;
+		}
+	}
+	memset(img->data, 0, (size_t)img->bytes_per_line * img->height);
+	{
+		static const uint16_t	endian = 1;
+
+		img32 = img->bits_per_pixel == 32
+				&& img->byte_order == (*(const uint8_t *)&endian ? LSBFirst : MSBFirst);
+	}
+	imgDirect = img32 && truecolor && sizeof(pixel_t) == 4
+				&& xpixel(RGB2COLOR(255,0,0)) == RGB2COLOR(255,0,0)
+				&& xpixel(RGB2COLOR(0,255,0)) == RGB2COLOR(0,255,0)
+				&& xpixel(RGB2COLOR(0,0,255)) == RGB2COLOR(0,0,255);
+	gfxMutexInit(&imgMutex);
+	dirtyx0 = dirtyx1 = 0;
 
 	gc = XCreateGC(dis, win, 0, 0);
 	XSetBackground(dis, gc, BlackPixel(dis, scr));
@@ -229,25 +444,27 @@ bool_t gdisp_lld_init(void)
 
 void gdisp_lld_draw_pixel(coord_t x, coord_t y, color_t color)
 {
-	XColor	col;
+	unsigned long	p;
 
    #if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
         // Clip pre orientation change
         if (x < GDISP.clipx0 || y < GDISP.clipy0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
     #endif
 
-	col.red = RED_OF(color) << 8;
-	col.green = GREEN_OF(color) << 8;
-	col.blue = BLUE_OF(color) << 8;
-	XAllocColor(dis, cmap, &col);
-	XSetForeground(dis, gc, col.pixel);
-	XDrawPoint(dis, pix, gc, (int)x, (int)y );
-	XDrawPoint(dis, win, gc, (int)x, (int)y );
-	XFlush(dis);
+	gfxMutexEnter(&imgMutex);
+	p = xpixel(color);
+	if (img32)
+		*imgpos(x, y) = (uint32_t)p;
+	else
+		XPutPixel(img, x, y, p);
+	xdirty(x, y, 1, 1);
+	gfxMutexExit(&imgMutex);
 }
 
 void gdisp_lld_fill_area(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
-	XColor	col;
+	unsigned long	p;
+	uint32_t		*d;
+	coord_t			i, j;
 	
     #if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
         // Clip pre orientation change
@@ -258,23 +475,67 @@ void gdisp_lld_fill_area(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t c
         if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
     #endif
 
-	col.red = RED_OF(color) << 8;
-	col.green = GREEN_OF(color) << 8;
-	col.blue = BLUE_OF(color) << 8;
-	XAllocColor(dis, cmap, &col);
-	XSetForeground(dis, gc, col.pixel);
-	XFillRectangle(dis, pix, gc, x, y, cx, cy);
-	XFillRectangle(dis, win, gc, x, y, cx, cy);
-	XFlush(dis);
+	gfxMutexEnter(&imgMutex);
+	p = xpixel(color);
+	if (img32) {
+		// Fill the first line and then copy it
+		for(d = imgpos(x, y), i = 0; i < cx; i++)
+			d[i] = (uint32_t)p;
+		for(j = 1; j < cy; j++)
+			memcpy(imgpos(x, y+j), d, cx * sizeof(uint32_t));
+	} else {
+		for(j = 0; j < cy; j++)
+			for(i = 0; i < cx; i++)
+				XPutPixel(img, x+i, y+j, p);
+	}
+	xdirty(x, y, cx, cy);
+	gfxMutexExit(&imgMutex);
 }
 
-// Start of Bitblit code
-//XImage			bitmap;
-//pixel_t			*bits;
-//	bits = malloc(vis.depth * GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT);
-//	bitmap = XCreateImage(dis, vis, vis.depth, ZPixmap,
-//				0, bits, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT,
-//				0, 0);
+#if GDISP_HARDWARE_BITFILLS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill an area with a bitmap.
+	 * @note    Optional - The high level driver can emulate using software.
+	 *
+	 * @param[in] x, y     The start filled area
+	 * @param[in] cx, cy   The width and height to be filled
+	 * @param[in] srcx, srcy   The bitmap position to start the fill from
+	 * @param[in] srccx    The width of a line in the bitmap.
+	 * @param[in] buffer   The pixels to use to fill the area.
+	 *
+	 * @notapi
+	 */
+	void gdisp_lld_blit_area_ex(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
+		uint32_t		*d;
+		coord_t			i, j;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; srcx += GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; srcy += GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (srcx+cx > srccx)		cx = srccx - srcx;
+			if (cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+
+		buffer += (size_t)srcy*srccx + srcx;
+		gfxMutexEnter(&imgMutex);
+		if (imgDirect) {
+			for(j = 0; j < cy; j++, buffer += srccx)
+				memcpy(imgpos(x, y+j), buffer, cx * sizeof(pixel_t));
+		} else if (img32) {
+			for(j = 0; j < cy; j++, buffer += srccx)
+				for(d = imgpos(x, y+j), i = 0; i < cx; i++)
+					d[i] = (uint32_t)xpixel(buffer[i]);
+		} else {
+			for(j = 0; j < cy; j++, buffer += srccx)
+				for(i = 0; i < cx; i++)
+					XPutPixel(img, x+i, y+j, xpixel(buffer[i]));
+		}
+		xdirty(x, y, cx, cy);
+		gfxMutexExit(&imgMutex);
+	}
+#endif
 
 #if GINPUT_NEED_MOUSE
 
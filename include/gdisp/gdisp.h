@@ -136,6 +136,18 @@ extern GDISPDriver	GDISP;
 #define GDISP_PIXELFORMAT_CUSTOM	99999
 #define GDISP_PIXELFORMAT_ERROR		88888
 
+/**
+ * @brief   Other Pixel Layouts
+ * @details	These can't be used by a driver. They are for converting pixels
+ * 			with gdispConvertPixels() and gdispBlitConvert().
+ */
+#define GDISP_PIXELFORMAT_RGB24		1024		// 3 bytes per pixel - R, G, B
+#define GDISP_PIXELFORMAT_BGR24		1025		// 3 bytes per pixel - B, G, R
+#define GDISP_PIXELFORMAT_RGBA8888	1026		// 4 bytes per pixel - R, G, B, A
+#define GDISP_PIXELFORMAT_BGRA8888	1027		// 4 bytes per pixel - B, G, R, A
+#define GDISP_PIXELFORMAT_INDEX8	1028		// 1 byte per pixel - an index into a palette of color_t
+#define GDISP_PIXELFORMAT_MONO1		1029		// 1 bit per pixel - most significant bit first
+
 /**
  * @name   Some basic colors
  * @{
@@ -296,7 +308,7 @@ typedef color_t		pixel_t;
 extern "C" {
 #endif
 
-#if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC || defined(__DOXYGEN__)
+#if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC || GDISP_NEED_AUTOFLUSH || GDISP_NEED_LIST || defined(__DOXYGEN__)
 	/* These routines can be hardware accelerated
 	 *	- Do not add a routine here unless it has also been added to the hardware acceleration layer
 	 */
@@ -474,6 +486,61 @@ extern "C" {
 		void gdispFillArc(coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle, color_t color);
 	#endif
 
+	/* Alpha Blending and Anti-Aliased Functions */
+
+	#if GDISP_NEED_ALPHA || defined(__DOXYGEN__)
+		/**
+		 * @brief   Blend a color over an area.
+		 *
+		 * @param[in] x,y		The start position
+		 * @param[in] cx,cy		The size of the box (outside dimensions)
+		 * @param[in] color		The color to use
+		 * @param[in] alpha		The opacity (0-255). 0 leaves the area unchanged, 255 is a normal fill.
+		 *
+		 * @api
+		 */
+		void gdispFillAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha);
+
+		/**
+		 * @brief   Blend a bitmap over an area.
+		 * @note	The same buffer rules apply as for @p gdispBlitAreaEx()
+		 *
+		 * @param[in] x,y		The start position
+		 * @param[in] cx,cy		The size of the filled area
+		 * @param[in] srcx,srcy The bitmap position to start the fill form
+		 * @param[in] srccx		The width of a line in the bitmap
+		 * @param[in] buffer	The bitmap in the driver's pixel format
+		 * @param[in] alpha		The opacity (0-255). 0 leaves the area unchanged, 255 is a normal blit.
+		 *
+		 * @api
+		 */
+		void gdispBlitAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha);
+
+		/**
+		 * @brief   Draw an anti-aliased line.
+		 *
+		 * @param[in] x0,y0		The start position
+		 * @param[in] x1,y1 	The end position
+		 * @param[in] color		The color to use
+		 *
+		 * @api
+		 */
+		void gdispDrawLineAA(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color);
+	#endif
+
+	#if (GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE) || defined(__DOXYGEN__)
+		/**
+		 * @brief   Draw an anti-aliased circle.
+		 *
+		 * @param[in] x,y		The center of the circle
+		 * @param[in] radius	The radius of the circle
+		 * @param[in] color		The color to use
+		 *
+		 * @api
+		 */
+		void gdispDrawCircleAA(coord_t x, coord_t y, coord_t radius, color_t color);
+	#endif
+
 	/* Read a pixel Function */
 
 	#if GDISP_NEED_PIXELREAD || defined(__DOXYGEN__)
@@ -556,6 +623,10 @@ extern "C" {
 	#define gdispFillArc(x, y, radius, sangle, eangle, color)	gdisp_lld_fill_arc(x, y, radius, sangle, eangle, color)
 	#define gdispDrawEllipse(x, y, a, b, color)					gdisp_lld_draw_ellipse(x, y, a, b, color)
 	#define gdispFillEllipse(x, y, a, b, color)					gdisp_lld_fill_ellipse(x, y, a, b, color)
+	#define gdispFillAreaAlpha(x, y, cx, cy, color, alpha)		gdisp_lld_fill_area_alpha(x, y, cx, cy, color, alpha)
+	#define gdispBlitAreaAlpha(x, y, cx, cy, sx, sy, scx, buf, alpha)	gdisp_lld_blit_area_alpha(x, y, cx, cy, sx, sy, scx, buf, alpha)
+	#define gdispDrawLineAA(x0, y0, x1, y1, color)				gdisp_lld_draw_line_aa(x0, y0, x1, y1, color)
+	#define gdispDrawCircleAA(x, y, radius, color)				gdisp_lld_draw_circle_aa(x, y, radius, color)
 	#define gdispGetPixelColor(x, y)							gdisp_lld_get_pixel_color(x, y)
 	#define gdispVerticalScroll(x, y, cx, cy, lines, bgcolor)	gdisp_lld_vertical_scroll(x, y, cx, cy, lines, bgcolor)
 	#define gdispControl(what, value)							gdisp_lld_control(what, value)
@@ -563,6 +634,200 @@ extern "C" {
 
 #endif
 
+/* Flushing changed areas to the display */
+
+#if GDISP_NEED_AUTOFLUSH || defined(__DOXYGEN__)
+	/**
+	 * @brief   Send all areas changed since the last flush to the display.
+	 * @note	Overlapping changes are merged so each area is only sent once.
+	 * @note	If GDISP_NEED_ASYNC is defined this is queued behind any
+	 * 			drawing operations already requested.
+	 * @note	If GDISP_NEED_AUTOFLUSH is FALSE this does nothing.
+	 *
+	 * @api
+	 */
+	void gdispFlush(void);
+#else
+	#define gdispFlush()
+#endif
+
+/* Waiting for queued drawing */
+
+#if GDISP_NEED_ASYNC || defined(__DOXYGEN__)
+	/**
+	 * @brief   Wait until all drawing operations requested so far have been completed.
+	 * @note	Useful when timing drawing or before reading the display memory directly.
+	 * @note	If GDISP_NEED_ASYNC is FALSE drawing is always complete on return so this does nothing.
+	 *
+	 * @api
+	 */
+	void gdispSync(void);
+#else
+	#define gdispSync()
+#endif
+
+/* Display lists */
+
+#if GDISP_NEED_LIST || defined(__DOXYGEN__)
+	/**
+	 * @brief   A display list - a recorded sequence of drawing operations.
+	 * @note	The recording is a plain byte buffer that contains no absolute
+	 * 			addresses (except for the source of a blit) so it can be copied,
+	 * 			cached or compared with memcmp() to see if a screen has changed.
+	 */
+	typedef struct GDisplayList {
+		uint8_t *	buf;			// The buffer holding the recording
+		size_t		size;			// The size of the buffer
+		size_t		len;			// The number of bytes recorded
+		bool_t		overflow;		// TRUE if the buffer was too small for the recording
+	} GDisplayList;
+
+	/**
+	 * @brief   Start recording drawing operations into a display list.
+	 * @details	Until gdispListEnd() is called, drawing calls made by this thread are
+	 * 			recorded into the list instead of being drawn.
+	 * @note	Only one list can be recorded at a time.
+	 * @note	Pixel reads, queries and controls are not recorded. They are performed immediately.
+	 * @note	Blits record a pointer to the source bitmap so it must remain valid
+	 * 			for as long as the list is replayed.
+	 *
+	 * @param[in] pl		The display list
+	 * @param[in] buf		The buffer to record into
+	 * @param[in] size		The size of the buffer
+	 *
+	 * @api
+	 */
+	void gdispListBegin(GDisplayList *pl, void *buf, size_t size);
+
+	/**
+	 * @brief   Stop recording the current display list.
+	 * @return	FALSE if the buffer was too small and some operations were lost
+	 *
+	 * @api
+	 */
+	bool_t gdispListEnd(void);
+
+	/**
+	 * @brief   Draw a display list.
+	 * @note	Recorded coordinates are relative to x,y. Drawing is clipped
+	 * 			to the area x,y,cx,cy (as well as to the current clip area).
+	 * @note	A recorded clear fills the x,y,cx,cy area.
+	 * @note	Replaying while recording another list appends the operations to that list.
+	 *
+	 * @param[in] pl		The display list
+	 * @param[in] x,y		The position to draw the list at
+	 * @param[in] cx,cy		The size of the area to clip the list to
+	 *
+	 * @api
+	 */
+	void gdispListReplay(const GDisplayList *pl, coord_t x, coord_t y, coord_t cx, coord_t cy);
+#endif
+
+/* Drawing contexts */
+
+#if GDISP_NEED_CONTEXT || defined(__DOXYGEN__)
+	/**
+	 * @brief   A drawing context - a clip area, an origin and default colors.
+	 * @details	Each thread (or window) can draw through its own context without
+	 * 			changing the clip area used by anyone else. The gdisp lock is
+	 * 			only held while each primitive is actually being drawn.
+	 * @note	Coordinates passed to the context drawing routines are relative to
+	 * 			the context origin. The clip area is stored in display coordinates.
+	 * @note	Drawing is also limited by the clip area set with gdispSetClip().
+	 */
+	typedef struct GDisplayContext {
+		coord_t		clipx0, clipy0;		// The clip area (display coordinates)
+		coord_t		clipx1, clipy1;		// The clip area end (exclusive)
+		coord_t		ox, oy;				// The origin (display coordinates)
+		color_t		color;				// The drawing color
+		color_t		bgcolor;			// The background color
+	} GDisplayContext;
+
+	/**
+	 * @brief   Initialise a drawing context to the whole display with White on Black.
+	 *
+	 * @param[in] pc		The context
+	 *
+	 * @api
+	 */
+	void gdispCtxInit(GDisplayContext *pc);
+
+	/**
+	 * @brief   Set the clip area of a drawing context.
+	 *
+	 * @param[in] pc		The context
+	 * @param[in] x,y		The start of the clip area (relative to the context origin)
+	 * @param[in] cx,cy		The size of the clip area
+	 *
+	 * @api
+	 */
+	void gdispCtxSetClip(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy);
+
+	/**
+	 * @brief   Set the origin of a drawing context.
+	 * @note	The clip area is not moved.
+	 *
+	 * @param[in] pc		The context
+	 * @param[in] x,y		The new origin (display coordinates)
+	 *
+	 * @api
+	 */
+	#define gdispCtxSetOrigin(pc, x, y)			{ (pc)->ox = (x); (pc)->oy = (y); }
+
+	/**
+	 * @brief   Set the default colors of a drawing context.
+	 *
+	 * @param[in] pc		The context
+	 * @param[in] fg		The color to draw with
+	 * @param[in] bg		The background color
+	 *
+	 * @api
+	 */
+	#define gdispCtxSetColors(pc, fg, bg)		{ (pc)->color = (fg); (pc)->bgcolor = (bg); }
+
+	/**
+	 * @brief   Fill the clip area of a context with its background color.
+	 *
+	 * @param[in] pc		The context
+	 *
+	 * @api
+	 */
+	void gdispCtxClear(GDisplayContext *pc);
+
+	/**
+	 * @brief   Context versions of the drawing routines.
+	 * @details	These take a context instead of the color(s) and otherwise work as the
+	 * 			equivalent gdispXxx() routine.
+	 *
+	 * @api
+	 * @{
+	 */
+	void gdispCtxDrawPixel(GDisplayContext *pc, coord_t x, coord_t y);
+	void gdispCtxDrawLine(GDisplayContext *pc, coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+	void gdispCtxFillArea(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy);
+	void gdispCtxBlitAreaEx(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer);
+	void gdispCtxDrawBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy);
+	#if GDISP_NEED_CIRCLE || defined(__DOXYGEN__)
+		void gdispCtxDrawCircle(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius);
+		void gdispCtxFillCircle(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius);
+	#endif
+	#if GDISP_NEED_ELLIPSE || defined(__DOXYGEN__)
+		void gdispCtxDrawEllipse(GDisplayContext *pc, coord_t x, coord_t y, coord_t a, coord_t b);
+		void gdispCtxFillEllipse(GDisplayContext *pc, coord_t x, coord_t y, coord_t a, coord_t b);
+	#endif
+	#if GDISP_NEED_ARC || defined(__DOXYGEN__)
+		void gdispCtxDrawArc(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle);
+		void gdispCtxFillArc(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle);
+	#endif
+	#if GDISP_NEED_TEXT || defined(__DOXYGEN__)
+		void gdispCtxDrawString(GDisplayContext *pc, coord_t x, coord_t y, const char *str, font_t font);
+		void gdispCtxFillString(GDisplayContext *pc, coord_t x, coord_t y, const char *str, font_t font);
+		void gdispCtxDrawStringBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, justify_t justify);
+		void gdispCtxFillStringBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, justify_t justify);
+	#endif
+	/** @} */
+#endif
+
 /* These routines are not hardware accelerated
  *	- Do not add a hardware accelerated routines here.
  */
@@ -615,6 +880,20 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color);
 	void gdispFillConvexPoly(coord_t tx, coord_t ty, const point *pntarray, unsigned cnt, color_t color);
 #endif
 
+#if (GDISP_NEED_CONVEX_POLYGON && GDISP_NEED_ALPHA) || defined(__DOXYGEN__)
+	/**
+	 * @brief   Draw an enclosed polygon with anti-aliased edges.
+	 *
+	 * @param[in] tx, ty	Transform all points in pntarray by tx, ty
+	 * @param[in] pntarray	An array of points
+	 * @param[in] cnt		The number of points in the array
+	 * @param[in] color		The color to use
+	 *
+	 * @api
+	 */
+	void gdispDrawPolyAA(coord_t tx, coord_t ty, const point *pntarray, unsigned cnt, color_t color);
+#endif
+
 /* Text Functions */
 
 #if GDISP_NEED_TEXT || defined(__DOXYGEN__)
@@ -775,6 +1054,126 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color);
 	const char *gdispGetFontName(font_t font);
 #endif
 
+/* Text Layouts */
+
+#if (GDISP_NEED_TEXT && GDISP_NEED_TEXT_LAYOUT) || defined(__DOXYGEN__)
+	/**
+	 * @brief   One character of a text layout.
+	 * @note	The position is relative to the justification point of the first line.
+	 */
+	typedef struct GTextLayoutGlyph {
+		int16_t		x, y;			// The position of the character
+		uint16_t	c;				// The character
+		uint8_t		width;			// The width of the character
+	} GTextLayoutGlyph;
+
+	/**
+	 * @brief   A text layout - a string that has been broken into lines and measured.
+	 * @details	The characters are positioned once by gdispTextLayoutSet(). Drawing a layout
+	 * 			just draws the characters at their saved positions.
+	 * @note	The width, height and lines fields may be read by the application.
+	 * 			The other fields are private.
+	 */
+	typedef struct GTextLayout {
+		GTextLayoutGlyph *	glyphs;			// The positioned characters (allocated from the heap)
+		uint16_t			count;			// The number of characters
+		uint16_t			size;			// The number of characters allocated
+		uint16_t			lines;			// The number of lines
+		coord_t				width;			// The width of the widest line
+		coord_t				height;			// The height of all the lines
+		font_t				font;			// The font the layout was made for (NULL if none)
+		justify_t			justify;		// The justification the layout was made for
+		coord_t				wrapwidth;		// The width the lines were wrapped to (0 for no wrapping)
+		size_t				len;			// The length of the text
+		uint32_t			hash;			// A hash of the text
+	} GTextLayout;
+
+	/**
+	 * @brief   Initialise an empty text layout.
+	 *
+	 * @param[in] pl		The text layout
+	 *
+	 * @api
+	 */
+	void gdispTextLayoutInit(GTextLayout *pl);
+
+	/**
+	 * @brief   Lay out a string.
+	 * @return	FALSE if there wasn't enough memory. The layout is then empty.
+	 * @details	Lines are broken at newlines. If wrapwidth is greater than 0 lines are also
+	 * 			wrapped between words to fit that width. If wrapwidth is negative the whole
+	 * 			string is kept on one line exactly as gdispDrawStringBox() would draw it.
+	 * @note	If the text, font, justification and wrap width are the same as last
+	 * 			time the existing layout is kept. The text is compared by a hash of its
+	 * 			contents so a string that was changed in place is laid out again.
+	 *
+	 * @param[in] pl		The text layout
+	 * @param[in] str		The string to lay out
+	 * @param[in] font		The font to use
+	 * @param[in] justify	Justify the text left, center or right
+	 * @param[in] wrapwidth	The width to wrap the lines to, 0 to only break lines at newlines or -1 for a single line
+	 *
+	 * @api
+	 */
+	bool_t gdispTextLayoutSet(GTextLayout *pl, const char *str, font_t font, justify_t justify, coord_t wrapwidth);
+
+	/**
+	 * @brief   Free the memory used by a text layout and make it empty.
+	 *
+	 * @param[in] pl		The text layout
+	 *
+	 * @api
+	 */
+	void gdispTextLayoutFree(GTextLayout *pl);
+
+	/**
+	 * @brief   Draw a text layout vertically centered within the specified box.
+	 * @note	A single line layout is drawn exactly as gdispDrawStringBox() would draw the string.
+	 * @note	Characters that don't fit entirely within the box are not drawn.
+	 *
+	 * @param[in] pl		The text layout
+	 * @param[in] x,y		The position of the box
+	 * @param[in] cx,cy		The width and height of the box
+	 * @param[in] color		The color to use
+	 *
+	 * @api
+	 */
+	void gdispDrawTextLayout(const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color);
+
+	/**
+	 * @brief   Draw a text layout vertically centered within the specified box. The box background is filled with the specified background color.
+	 * @note	A single line layout is drawn exactly as gdispFillStringBox() would draw the string.
+	 * @note	The entire box is filled
+	 *
+	 * @param[in] pl		The text layout
+	 * @param[in] x,y		The position of the box
+	 * @param[in] cx,cy		The width and height of the box
+	 * @param[in] color		The color to use
+	 * @param[in] bgcolor	The background color to use
+	 *
+	 * @api
+	 */
+	void gdispFillTextLayout(const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, color_t bgcolor);
+
+	#if GDISP_NEED_CONTEXT || defined(__DOXYGEN__)
+		/**
+		 * @brief   Draw a text layout through a drawing context.
+		 * @note	Uses the context color and, for the fill, the context background color.
+		 *
+		 * @param[in] pc		The context
+		 * @param[in] pl		The text layout
+		 * @param[in] x,y		The position of the box (relative to the context origin)
+		 * @param[in] cx,cy		The width and height of the box
+		 *
+		 * @api
+		 * @{
+		 */
+		void gdispCtxDrawTextLayout(GDisplayContext *pc, const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy);
+		void gdispCtxFillTextLayout(GDisplayContext *pc, const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy);
+		/** @} */
+	#endif
+#endif
+
 /* Extra Arc Functions */
 
 #if GDISP_NEED_ARC || defined(__DOXYGEN__)
@@ -816,6 +1215,65 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color);
  */
 color_t gdispBlendColor(color_t fg, color_t bg, uint8_t alpha);
 
+#if GDISP_NEED_CONVERT || defined(__DOXYGEN__)
+	/**
+	 * @brief   Get the number of bytes used by a number of pixels in a pixel format.
+	 * @return	The number of bytes (rounded up to a whole byte) or 0 if the format is not supported
+	 * @note	The driver pixel formats (GDISP_PIXELFORMAT_RGB565 etc) are arrays of
+	 * 			that format's color_t in the native byte order. They are never packed.
+	 *
+	 * @param[in] fmt		The pixel format
+	 * @param[in] cnt		The number of pixels
+	 *
+	 * @api
+	 */
+	size_t gdispConvertSize(unsigned fmt, coord_t cnt);
+
+	/**
+	 * @brief   Convert pixels from one pixel format to another.
+	 * @return	FALSE if either format is not supported
+	 * @note	The formats can be any of the driver pixel formats (GDISP_PIXELFORMAT_RGB565 etc)
+	 * 			or the other pixel layouts (GDISP_PIXELFORMAT_RGB24 etc). GDISP_PIXELFORMAT_INDEX8
+	 * 			can only be a source format.
+	 * @note	Conversion into the display pixel format (GDISP_PIXELFORMAT) is the fastest.
+	 * @note	Alpha is ignored when reading and is set to fully opaque when writing.
+	 * @note	Pixels are converted in order so the conversion can be done in place provided the
+	 * 			source doesn't end before the end of the converted pixels. Reading the source into
+	 * 			the end of the buffer always works.
+	 *
+	 * @param[in] dst		The buffer for the converted pixels
+	 * @param[in] dstfmt	The pixel format to convert to
+	 * @param[in] src		The pixels to convert
+	 * @param[in] srcfmt	The pixel format to convert from
+	 * @param[in] srcx		The first pixel in src to convert
+	 * @param[in] cnt		The number of pixels to convert
+	 * @param[in] palette	The palette (in display colors) for GDISP_PIXELFORMAT_INDEX8 and GDISP_PIXELFORMAT_MONO1.
+	 * 						It can be NULL for GDISP_PIXELFORMAT_MONO1 to get Black and White.
+	 *
+	 * @api
+	 */
+	bool_t gdispConvertPixelsEx(void *dst, unsigned dstfmt, const void *src, unsigned srcfmt, coord_t srcx, coord_t cnt, const color_t *palette);
+
+	/**
+	 * @brief   Blit an area of pixels in another pixel format.
+	 * @details	The pixels are converted a few rows at a time into a small buffer and blitted.
+	 * @note	If the format is the display pixel format this is the same as gdispBlitAreaEx().
+	 * @note	When recording a display list the converted colors are recorded rather than
+	 * 			a pointer to the buffer.
+	 *
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the filled area
+	 * @param[in] srcx,srcy	The bitmap position to start the fill from
+	 * @param[in] srccx		The width of a line in the bitmap
+	 * @param[in] buffer	The bitmap
+	 * @param[in] srcfmt	The pixel format of the bitmap
+	 * @param[in] palette	The palette for GDISP_PIXELFORMAT_INDEX8 and GDISP_PIXELFORMAT_MONO1 bitmaps
+	 *
+	 * @api
+	 */
+	void gdispBlitConvert(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const void *buffer, unsigned srcfmt, const color_t *palette);
+#endif
+
 /* Support routine for packed pixel formats */
 #if !defined(gdispPackPixels) || defined(__DOXYGEN__)
 	/**
@@ -830,7 +1288,7 @@ color_t gdispBlendColor(color_t fg, color_t bg, uint8_t alpha);
 	 *
 	 * @api
 	 */
-	void gdispPackPixels(const pixel_t *buf, coord_t cx, coord_t x, coord_t y, color_t color);
+	void gdispPackPixels(pixel_t *buf, coord_t cx, coord_t x, coord_t y, color_t color);
 #endif
 
 /* 
@@ -840,6 +1298,16 @@ color_t gdispBlendColor(color_t fg, color_t bg, uint8_t alpha);
 /* Now obsolete functions */
 #define gdispBlitArea(x, y, cx, cy, buffer)		gdispBlitAreaEx(x, y, cx, cy, 0, 0, cx, buffer)
 
+#if GDISP_NEED_CONVERT
+	/**
+	 * @brief   Convert pixels from one pixel format to another.
+	 * @note	See gdispConvertPixelsEx()
+	 *
+	 * @api
+	 */
+	#define gdispConvertPixels(dst, dstfmt, src, srcfmt, cnt, palette)	gdispConvertPixelsEx(dst, dstfmt, src, srcfmt, 0, cnt, palette)
+#endif
+
 /* Macro definitions for common gets and sets */
 
 /**
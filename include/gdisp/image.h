@@ -49,6 +49,32 @@ typedef uint16_t	gdispImageFlags;
 	#define GDISP_IMAGE_FLG_ANIMATED			0x0002	/* The image has animation */
 	#define GDISP_IMAGE_FLG_MULTIPAGE			0x0004	/* The image has multiple pages */
 
+#if GDISP_NEED_IMAGE_TRANSFORM || defined(__DOXYGEN__)
+	/**
+	 * @brief	How an image is resampled when it is drawn scaled or rotated
+	 */
+	typedef uint8_t		gdispImageFilter;
+		#define GDISP_IMAGE_FILTER_NEAREST		0		/* The nearest pixel - fastest */
+		#define GDISP_IMAGE_FILTER_BILINEAR		1		/* Interpolate between the nearest 4 pixels - smoother */
+
+	/**
+	 * @brief	Receives the decoded rows of an image for scaled and rotated drawing
+	 * @details	The decoder sets shift and the area and then calls fn once for each row of the area
+	 * 			in whatever order it decodes them. The area can be changed between rows but all the
+	 * 			rows of an area must be delivered together.
+	 * @note	pixels has cx pixels. mask is NULL or has a byte for each pixel which is 0 if the
+	 * 			pixel is transparent.
+	 * @note	Don't mess with this! It is only used between the image decoders and the
+	 * 			drawing code.
+	 */
+	typedef struct gdispImageRows {
+		void		(*fn)(struct gdispImageRows *pr, coord_t y, const pixel_t *pixels, const uint8_t *mask);
+		uint8_t		shift;					/* @< The image is decoded at 1 / (1 << shift) of its size. The
+														decoder can reduce the value it is asked for. */
+		coord_t		x, y, cx, cy;			/* @< The area of the image the rows are in (in decoded pixels) */
+	} gdispImageRows;
+#endif
+
 struct gdispImageIO;
 
 /**
@@ -80,10 +106,22 @@ typedef size_t (*gdispImageIOReadFn)(struct gdispImageIO *pio, void *buf, size_t
  */
 typedef void (*gdispImageIOSeekFn)(struct gdispImageIO *pio, size_t pos);
 
+/**
+ * @brief	An image IO peek function
+ * @returns	A pointer to the next len bytes of input or NULL if they can't be accessed directly
+ *
+ * @param[in] pio	Pointer to the io structure
+ * @param[in] len	The number of bytes wanted
+ *
+ * @note	The data is used in place rather than being copied. The current position is not changed.
+ */
+typedef const void *(*gdispImageIOPeekFn)(struct gdispImageIO *pio, size_t len);
+
 typedef struct gdispImageIOFunctions {
 	gdispImageIOReadFn			read;				/* @< The function to read input */
 	gdispImageIOSeekFn			seek;				/* @< The function to seek input */
 	gdispImageIOCloseFn			close;				/* @< The function to close input */
+	gdispImageIOPeekFn			peek;				/* @< The function to access input directly (optional - NULL if not supported) */
 	} gdispImageIOFunctions;
 
 /**
@@ -95,6 +133,34 @@ typedef struct gdispImageIO {
 	const gdispImageIOFunctions	*fns;				/* @< The current "file" functions */
 } gdispImageIO;
 
+#if GDISP_NEED_IMAGE_SHARED_CACHE || defined(__DOXYGEN__)
+	/**
+	 * @brief	Where an image comes from
+	 * @details	Used to find a decoded image in the shared image cache.
+	 * @note	The image reader functions fill this in. It is all zero's if the source
+	 * 			can't be identified (eg a BaseFileStream) and the image is then never shared.
+	 */
+	typedef struct gdispImageSource {
+		const void *	ptr;				/* @< The image in RAM or Flash (NULL for a file) */
+		uint32_t		hash;				/* @< A hash of the file name */
+		uint32_t		stamp;				/* @< The file modification time */
+		uint32_t		size;				/* @< The file size */
+	} gdispImageSource;
+
+	/**
+	 * @brief	The shared image cache statistics
+	 */
+	typedef struct gdispImageCacheStats {
+		uint32_t		hits;				/* @< How many times a cached image has been shared */
+		uint32_t		misses;				/* @< How many times an image wasn't in the cache */
+		uint32_t		evictions;			/* @< How many images have been discarded to make room */
+		uint32_t		entries;			/* @< How many images are currently cached */
+		uint32_t		inuse;				/* @< How many of those are currently used by an open image */
+		size_t			used;				/* @< How many bytes of pixels are currently cached */
+		size_t			size;				/* @< The cache size (GDISP_IMAGE_SHARED_CACHE_SIZE) */
+	} gdispImageCacheStats;
+#endif
+
 /**
  * @brief	The structure for an image
  */
@@ -108,6 +174,10 @@ typedef struct gdispImage {
 		uint32_t							memused;			/* @< How much RAM is currently allocated */
 		uint32_t							maxmemused;			/* @< How much RAM has been allocated (maximum) */
 	#endif
+	#if GDISP_NEED_IMAGE_SHARED_CACHE
+		gdispImageSource					src;				/* @< Where the image comes from */
+		struct gdispImageCacheEntry *		shared;				/* @< Don't mess with this! */
+	#endif
 	const struct gdispImageHandlers *	fns;				/* @< Don't mess with this! */
 	struct gdispImagePrivate *			priv;				/* @< Don't mess with this! */
 } gdispImage;
@@ -160,6 +230,24 @@ extern "C" {
 		/* Old definition */
 		#define gdispImageSetSimulFileReader(img, fname)	gdispImageSetFileReader(img, fname)
 	#endif
+
+	#if GFX_USE_OS_LINUX || defined(__DOXYGEN__)
+		/**
+		 * @brief	Sets the io fields in the image structure to routines
+		 * 			that support reading from a file that is mapped into memory.
+		 * @pre		Only available on Linux
+		 *
+		 * @return	TRUE if the file could be mapped
+		 *
+		 * @param[in] img   	The image structure
+		 * @param[in] filename	The filename to open
+		 *
+		 * @note	The decoders read the image straight from the mapping. This is much faster than
+		 * 			gdispImageSetFileReader() for images that need lots of small reads and seeks eg GIF
+		 * 			animations.
+		 */
+		bool_t gdispImageSetMappedFileReader(gdispImage *img, const char *filename);
+	#endif
 	
 	/**
 	 * @brief	Open an image ready for drawing
@@ -236,6 +324,8 @@ extern "C" {
 	 * @note	A fatal error here does not necessarily mean that drawing the image will fail. For
 	 * 			example, a GDISP_IMAGE_ERR_NOMEMORY error simply means there isn't enough RAM to
 	 * 			cache the image.
+	 * @note	If GDISP_NEED_IMAGE_SHARED_CACHE is TRUE, images opened from the same source share
+	 * 			a single cached copy. See @p gdispImageGetCacheStats().
 	 */
 	gdispImageError gdispImageCache(gdispImage *img);
 
@@ -279,6 +369,64 @@ extern "C" {
 	 * 			frame/page.
 	 */
 	delaytime_t gdispImageNext(gdispImage *img);
+
+	#if GDISP_NEED_IMAGE_SHARED_CACHE || defined(__DOXYGEN__)
+		/**
+		 * @brief	Get the shared image cache statistics.
+		 *
+		 * @param[out] stats	Where to put the statistics
+		 *
+		 * @note	When GDISP_NEED_IMAGE_SHARED_CACHE is TRUE the first frame cached by @p gdispImageCache()
+		 * 			is shared with every other image opened from the same source (with the same
+		 * 			background color and size). Each cached image is kept until it needs to be discarded
+		 * 			to make room even if no image is currently using it.
+		 */
+		void gdispImageGetCacheStats(gdispImageCacheStats *stats);
+
+		/**
+		 * @brief	Discard every image in the shared image cache that isn't currently being used.
+		 */
+		void gdispImageFlushCache(void);
+	#endif
+
+	#if GDISP_NEED_IMAGE_TRANSFORM || defined(__DOXYGEN__)
+		/**
+		 * @brief	Draw the whole image scaled to fit an area
+		 * @return	GDISP_IMAGE_ERR_OK (0) on success or an error code.
+		 *
+		 * @param[in] img   	The image structure
+		 * @param[in] x,y		The screen location to draw the image
+		 * @param[in] cx,cy		The size to draw the image
+		 * @param[in] filter	GDISP_IMAGE_FILTER_NEAREST or GDISP_IMAGE_FILTER_BILINEAR
+		 *
+		 * @pre		gdispImageOpen() must have returned successfully.
+		 *
+		 * @note	The image is resampled a row at a time as it is decoded so no extra copy of the
+		 * 			image is needed. It is faster if the image has been cached. An interlaced PNG
+		 * 			image that isn't cached is decoded into a temporary copy of the whole image.
+		 * @note	A JPG image that is being reduced is decoded at a smaller size to start with.
+		 * @note	Transparent pixels are not drawn. Interlaced GIF frames are not interpolated vertically.
+		 * @note	Images and areas must be smaller than 8192 pixels in each direction.
+		 */
+		gdispImageError gdispImageDrawScaled(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, gdispImageFilter filter);
+
+		/**
+		 * @brief	Draw the whole image rotated about its center
+		 * @return	GDISP_IMAGE_ERR_OK (0) on success or an error code.
+		 *
+		 * @param[in] img   	The image structure
+		 * @param[in] x,y		The screen location of the top left corner of the box around the rotated image
+		 * @param[in] angle		The angle in degrees. Positive angles rotate anti-clockwise.
+		 * @param[in] filter	GDISP_IMAGE_FILTER_NEAREST or GDISP_IMAGE_FILTER_BILINEAR
+		 *
+		 * @pre		gdispImageOpen() must have returned successfully.
+		 *
+		 * @note	Rotating by a multiple of 90 degrees is exact. Other angles use the C library
+		 * 			sin() and cos().
+		 * @note	See @p gdispImageDrawScaled() for the other notes.
+		 */
+		gdispImageError gdispImageDrawRotated(gdispImage *img, coord_t x, coord_t y, int16_t angle, gdispImageFilter filter);
+	#endif
 	
 	#if GDISP_NEED_IMAGE_NATIVE
 		/**
@@ -301,6 +449,9 @@ extern "C" {
 		gdispImageError gdispImageCache_NATIVE(gdispImage *img);
 		gdispImageError gdispImageDraw_NATIVE(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy);
 		delaytime_t gdispImageNext_NATIVE(gdispImage *img);
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			gdispImageError gdispImageRows_NATIVE(gdispImage *img, gdispImageRows *pr);
+		#endif
 		/* @} */
 	#endif
 
@@ -317,6 +468,9 @@ extern "C" {
 		gdispImageError gdispImageCache_GIF(gdispImage *img);
 		gdispImageError gdispImageDraw_GIF(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy);
 		delaytime_t gdispImageNext_GIF(gdispImage *img);
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			gdispImageError gdispImageRows_GIF(gdispImage *img, gdispImageRows *pr);
+		#endif
 		/* @} */
 	#endif
 
@@ -333,6 +487,9 @@ extern "C" {
 		gdispImageError gdispImageCache_BMP(gdispImage *img);
 		gdispImageError gdispImageDraw_BMP(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy);
 		delaytime_t gdispImageNext_BMP(gdispImage *img);
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			gdispImageError gdispImageRows_BMP(gdispImage *img, gdispImageRows *pr);
+		#endif
 		/* @} */
 	#endif
 	
@@ -349,7 +506,26 @@ extern "C" {
 		gdispImageError gdispImageCache_JPG(gdispImage *img);
 		gdispImageError gdispImageDraw_JPG(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy);
 		delaytime_t gdispImageNext_JPG(gdispImage *img);
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			gdispImageError gdispImageRows_JPG(gdispImage *img, gdispImageRows *pr);
+		#endif
 		/* @} */
+
+		/**
+		 * @brief	Decode a JPG image at a reduced size.
+		 * @return	GDISP_IMAGE_ERR_OK (0) on success or an error code.
+		 *
+		 * @param[in] img	The image structure
+		 * @param[in] scale	1, 2, 4 or 8 to decode the image at full, 1/2, 1/4 or 1/8 size
+		 *
+		 * @pre		gdispImageOpen() must have returned successfully.
+		 *
+		 * @note	The image width and height change to the scaled size and any cached frame is released.
+		 * @note	The scaling is done as part of the decoding so a scaled image is also much faster to draw.
+		 * 			This makes it ideal for thumbnails.
+		 * @note	GDISP_IMAGE_ERR_UNSUPPORTED is returned if the image is not a JPG image.
+		 */
+		gdispImageError gdispImageSetScale_JPG(gdispImage *img, uint8_t scale);
 	#endif
 
 	#if GDISP_NEED_IMAGE_PNG
@@ -365,6 +541,9 @@ extern "C" {
 		gdispImageError gdispImageCache_PNG(gdispImage *img);
 		gdispImageError gdispImageDraw_PNG(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy);
 		delaytime_t gdispImageNext_PNG(gdispImage *img);
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			gdispImageError gdispImageRows_PNG(gdispImage *img, gdispImageRows *pr);
+		#endif
 		/* @} */
 	#endif
 
@@ -166,28 +166,304 @@ GDISPDriver	GDISP;
 	}
 #endif
 
+#if !GDISP_HARDWARE_SPANS
+	void gdisp_lld_fill_spans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+		for(; cnt; cnt--, spans++) {
+			if (spans->cx == 1)
+				gdisp_lld_draw_pixel(spans->x, spans->y, color);
+			else
+				gdisp_lld_fill_area(spans->x, spans->y, spans->cx, 1, color);
+		}
+	}
+#endif
+
+#if GDISP_NEED_ALPHA && !GDISP_HARDWARE_ALPHA
+	/*
+	 * Without hardware support each pixel is read back, blended and written again.
+	 * If the pixels can't be read back a pixel is drawn solid if it is at least half opaque.
+	 */
+	void gdisp_lld_blend_pixel(coord_t x, coord_t y, color_t color, uint8_t alpha) {
+		#if GDISP_NEED_PIXELREAD
+			#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+				if (x < GDISP.clipx0 || y < GDISP.clipy0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+			#endif
+			if (alpha != 255) {
+				if (!alpha) return;
+				color = gdisp_lld_blend_color(color, gdisp_lld_get_pixel_color(x, y), alpha);
+			}
+		#else
+			if (!(alpha & 0x80)) return;
+		#endif
+		gdisp_lld_draw_pixel(x, y, color);
+	}
+
+	void gdisp_lld_fill_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha) {
+		#if GDISP_NEED_PIXELREAD
+			coord_t x0, x1, y1;
+
+			if (alpha == 255) {
+				gdisp_lld_fill_area(x, y, cx, cy, color);
+				return;
+			}
+			#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+				if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+				if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; y = GDISP.clipy0; }
+				if (!alpha || cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+				if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+				if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+			#endif
+			x0 = x;
+			x1 = x + cx;
+			y1 = y + cy;
+			for(; y < y1; y++)
+				for(x = x0; x < x1; x++)
+					gdisp_lld_draw_pixel(x, y, gdisp_lld_blend_color(color, gdisp_lld_get_pixel_color(x, y), alpha));
+		#else
+			if (alpha & 0x80)
+				gdisp_lld_fill_area(x, y, cx, cy, color);
+		#endif
+	}
+
+	void gdisp_lld_blit_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha) {
+		#if GDISP_NEED_PIXELREAD
+			coord_t x0, x1, y1;
+
+			if (alpha == 255) {
+				gdisp_lld_blit_area_ex(x, y, cx, cy, srcx, srcy, srccx, buffer);
+				return;
+			}
+			#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+				if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; srcx += GDISP.clipx0 - x; x = GDISP.clipx0; }
+				if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; srcy += GDISP.clipy0 - y; y = GDISP.clipy0; }
+				if (srcx+cx > srccx)		cx = srccx - srcx;
+				if (!alpha || cx <= 0 || cy <= 0 || x >= GDISP.clipx1 || y >= GDISP.clipy1) return;
+				if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+				if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+			#endif
+			x0 = x;
+			x1 = x + cx;
+			y1 = y + cy;
+			buffer += srcy*srccx+srcx;
+			srccx -= cx;
+			for(; y < y1; y++, buffer += srccx)
+				for(x = x0; x < x1; x++)
+					gdisp_lld_draw_pixel(x, y, gdisp_lld_blend_color(*buffer++, gdisp_lld_get_pixel_color(x, y), alpha));
+		#else
+			if (alpha & 0x80)
+				gdisp_lld_blit_area_ex(x, y, cx, cy, srcx, srcy, srccx, buffer);
+		#endif
+	}
+#endif
+
+#if GDISP_NEED_ALPHA
+	/*
+	 * Wu's anti-aliased line. The error accumulator holds the fractional position of the
+	 * line as a 16 bit fraction of a pixel. Its top 8 bits split the color between the two
+	 * pixels that straddle the line.
+	 */
+	void gdisp_lld_draw_line_aa(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color) {
+		coord_t		dx, dy, t;
+		int			xdir;
+		uint16_t	erracc, erradj, prev;
+		uint8_t		w;
+
+		/* Always draw from top to bottom */
+		if (y0 > y1) {
+			t = x0; x0 = x1; x1 = t;
+			t = y0; y0 = y1; y1 = t;
+		}
+		dy = y1 - y0;
+		dx = x1 - x0;
+		xdir = 1;
+		if (dx < 0) {
+			xdir = -1;
+			dx = -dx;
+		}
+
+		/* Horizontal, vertical and diagonal lines don't need anti-aliasing */
+		if (!dx || !dy || dx == dy) {
+			gdisp_lld_draw_line(x0, y0, x1, y1, color);
+			return;
+		}
+
+		/* The end points are always exactly on the line */
+		gdisp_lld_blend_pixel(x0, y0, color, 255);
+		gdisp_lld_blend_pixel(x1, y1, color, 255);
+
+		erracc = 0;
+		if (dy > dx) {
+			/* Y-major - x moves a fraction of a pixel for each line */
+			erradj = (uint16_t)(((uint32_t)dx << 16) / dy);
+			while (--dy) {
+				prev = erracc;
+				erracc += erradj;
+				if (erracc <= prev)
+					x0 += xdir;
+				y0++;
+				w = erracc >> 8;
+				gdisp_lld_blend_pixel(x0, y0, color, w ^ 0xFF);
+				gdisp_lld_blend_pixel(x0 + xdir, y0, color, w);
+			}
+		} else {
+			/* X-major - y moves a fraction of a pixel for each column */
+			erradj = (uint16_t)(((uint32_t)dy << 16) / dx);
+			while (--dx) {
+				prev = erracc;
+				erracc += erradj;
+				if (erracc <= prev)
+					y0++;
+				x0 += xdir;
+				w = erracc >> 8;
+				gdisp_lld_blend_pixel(x0, y0, color, w ^ 0xFF);
+				gdisp_lld_blend_pixel(x0, y0 + 1, color, w);
+			}
+		}
+	}
+#endif
+
+#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+	/* Integer square root (rounded down) */
+	static uint32_t _isqrt(uint32_t n) {
+		uint32_t	r, b;
+
+		for(r = 0, b = 1UL << 30; b > n; b >>= 2);
+		for(; b; b >>= 2) {
+			if (n >= r + b) {
+				n -= r + b;
+				r = (r >> 1) + b;
+			} else
+				r >>= 1;
+		}
+		return r;
+	}
+
+	/* Blend a pixel into each quadrant without drawing any pixel twice */
+	static void _circle_aa_plot(coord_t x, coord_t y, coord_t dx, coord_t dy, color_t color, uint8_t alpha) {
+		gdisp_lld_blend_pixel(x+dx, y+dy, color, alpha);
+		if (dx)
+			gdisp_lld_blend_pixel(x-dx, y+dy, color, alpha);
+		if (dy) {
+			gdisp_lld_blend_pixel(x+dx, y-dy, color, alpha);
+			if (dx)
+				gdisp_lld_blend_pixel(x-dx, y-dy, color, alpha);
+		}
+	}
+
+	/*
+	 * An anti-aliased circle. For each column of the first octant the exact edge
+	 * position is found as a fixed point square root and its fraction splits the
+	 * color between the two pixels either side of the edge.
+	 */
+	void gdisp_lld_draw_circle_aa(coord_t x, coord_t y, coord_t radius, color_t color) {
+		uint32_t	r2, yf;
+		coord_t		a, b;
+		unsigned	s;
+		uint8_t		w;
+
+		/* Use as many fraction bits as will fit - 8 for radii up to 255 */
+		for(s = 8; s && ((uint32_t)radius << s) >= 0x10000; s--);
+		r2 = (uint32_t)radius * radius;
+		for(a = 0; ; a++) {
+			yf = _isqrt((r2 - (uint32_t)a*a) << (2*s));
+			b = yf >> s;
+			if (b < a)
+				break;
+			w = (uint8_t)((yf & ((1 << s) - 1)) << (8 - s));
+			_circle_aa_plot(x, y, a, b, color, w ^ 0xFF);
+			_circle_aa_plot(x, y, a, b+1, color, w);
+			_circle_aa_plot(x, y, b+1, a, color, w);
+			if (a != b)
+				_circle_aa_plot(x, y, b, a, color, w ^ 0xFF);
+		}
+	}
+#endif
+
+#if (GDISP_NEED_CIRCLE && (!GDISP_HARDWARE_CIRCLES || !GDISP_HARDWARE_CIRCLEFILLS)) \
+		|| (GDISP_NEED_ELLIPSE && (!GDISP_HARDWARE_ELLIPSES || !GDISP_HARDWARE_ELLIPSEFILLS)) \
+		|| (GDISP_NEED_ARC && (!GDISP_HARDWARE_ARCS || !GDISP_HARDWARE_ARCFILLS))
+	/*
+	 * The emulated shapes below are rasterized into clipped horizontal spans
+	 * which are handed to gdisp_lld_fill_spans() a batch at a time.
+	 * The low level driver is never re-entered so a single static batch is safe.
+	 */
+	static gdisp_lld_span_t	spanBuf[GDISP_SPAN_BUFFER_SIZE];
+	static unsigned			spanCnt;
+	static color_t			spanColor;
+
+	static void spanFlush(void) {
+		if (spanCnt) {
+			gdisp_lld_fill_spans(spanBuf, spanCnt, spanColor);
+			spanCnt = 0;
+		}
+	}
+
+	#define spanBegin(color)	{ spanColor = (color); spanCnt = 0; }
+	#define spanEnd()			spanFlush()
+
+	/*
+	 * @brief				Add the pixels x0 to x1 (inclusive) on line y to the current batch
+	 *
+	 * @notapi
+	 */
+	static void spanAdd(coord_t x0, coord_t x1, coord_t y) {
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (y < GDISP.clipy0 || y >= GDISP.clipy1) return;
+			if (x0 < GDISP.clipx0) x0 = GDISP.clipx0;
+			if (x1 >= GDISP.clipx1) x1 = GDISP.clipx1 - 1;
+		#else
+			if (y < 0 || y >= GDISP.Height) return;
+			if (x0 < 0) x0 = 0;
+			if (x1 >= GDISP.Width) x1 = GDISP.Width - 1;
+		#endif
+		if (x1 < x0) return;
+
+		if (spanCnt >= GDISP_SPAN_BUFFER_SIZE)
+			spanFlush();
+		spanBuf[spanCnt].x = x0;
+		spanBuf[spanCnt].y = y;
+		spanBuf[spanCnt].cx = x1 - x0 + 1;
+		spanCnt++;
+	}
+#endif
+
 #if GDISP_NEED_CIRCLE && !GDISP_HARDWARE_CIRCLES
 	void gdisp_lld_draw_circle(coord_t x, coord_t y, coord_t radius, color_t color) {
-		coord_t a, b, P;
+		coord_t a, b, P, a0;
 
-		a = 0;
+		a = a0 = 0;
 		b = radius;
 		P = 1 - radius;
 
+		spanBegin(color);
 		do {
-			gdisp_lld_draw_pixel(x+a, y+b, color);
-			gdisp_lld_draw_pixel(x+b, y+a, color);
-			gdisp_lld_draw_pixel(x-a, y+b, color);
-			gdisp_lld_draw_pixel(x-b, y+a, color);
-			gdisp_lld_draw_pixel(x+b, y-a, color);
-			gdisp_lld_draw_pixel(x+a, y-b, color);
-			gdisp_lld_draw_pixel(x-a, y-b, color);
-			gdisp_lld_draw_pixel(x-b, y-a, color);
+			/* The steep octants have a single pixel on each line */
+			spanAdd(x-b, x-b, y+a);
+			spanAdd(x+b, x+b, y+a);
+			if (a) {
+				spanAdd(x-b, x-b, y-a);
+				spanAdd(x+b, x+b, y-a);
+			}
 			if (P < 0)
 				P += 3 + 2*a++;
-			else
+			else {
+				/* The shallow octants form a horizontal run that ends when b changes */
+				spanAdd(x-a, x-a0, y+b);
+				spanAdd(x+a0, x+a, y+b);
+				spanAdd(x-a, x-a0, y-b);
+				spanAdd(x+a0, x+a, y-b);
+				a0 = a+1;
 				P += 5 + 2*(a++ - b--);
+			}
 		} while(a <= b);
+
+		/* Finish any run still in progress */
+		if (a0 < a) {
+			spanAdd(x-a+1, x-a0, y+b);
+			spanAdd(x+a0, x+a-1, y+b);
+			spanAdd(x-a+1, x-a0, y-b);
+			spanAdd(x+a0, x+a-1, y-b);
+		}
+		spanEnd();
 	}
 #endif
 
@@ -199,74 +475,93 @@ GDISPDriver	GDISP;
 		b = radius;
 		P = 1 - radius;
 
+		spanBegin(color);
 		do {
-			gdisp_lld_draw_line(x-a, y+b, x+a, y+b, color);
-			gdisp_lld_draw_line(x-a, y-b, x+a, y-b, color);
-			gdisp_lld_draw_line(x-b, y+a, x+b, y+a, color);
-			gdisp_lld_draw_line(x-b, y-a, x+b, y-a, color);
+			spanAdd(x-b, x+b, y+a);
+			if (a)
+				spanAdd(x-b, x+b, y-a);
 			if (P < 0)
 				P += 3 + 2*a++;
-			else
+			else {
+				/* This is the widest line for this b */
+				if (a != b) {
+					spanAdd(x-a, x+a, y+b);
+					spanAdd(x-a, x+a, y-b);
+				}
 				P += 5 + 2*(a++ - b--);
+			}
 		} while(a <= b);
+		spanEnd();
 	}
 #endif
 
 #if GDISP_NEED_ELLIPSE && !GDISP_HARDWARE_ELLIPSES
 	void gdisp_lld_draw_ellipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
 		int  dx = 0, dy = b; /* im I. Quadranten von links oben nach rechts unten */
+		int  dx0 = 0, w;
 		long a2 = a*a, b2 = b*b;
 		long err = b2-(2*b-1)*a2, e2; /* Fehler im 1. Schritt */
 
+		spanBegin(color);
 		do {
-			gdisp_lld_draw_pixel(x+dx, y+dy, color); /* I. Quadrant */
-			gdisp_lld_draw_pixel(x-dx, y+dy, color); /* II. Quadrant */
-			gdisp_lld_draw_pixel(x-dx, y-dy, color); /* III. Quadrant */
-			gdisp_lld_draw_pixel(x+dx, y-dy, color); /* IV. Quadrant */
-
 			e2 = 2*err;
+			w = dx;
 			if(e2 <  (2*dx+1)*b2) {
 				dx++;
 				err += (2*dx+1)*b2;
 			}
 			if(e2 > -(2*dy-1)*a2) {
+				/* The horizontal run for this line is complete */
+				spanAdd(x+dx0, x+w, y+dy);		/* I. Quadrant */
+				spanAdd(x-w, x-dx0, y+dy);		/* II. Quadrant */
+				if (dy) {
+					spanAdd(x-w, x-dx0, y-dy);	/* III. Quadrant */
+					spanAdd(x+dx0, x+w, y-dy);	/* IV. Quadrant */
+				}
+				dx0 = dx;
 				dy--;
 				err -= (2*dy-1)*a2;
 			}
 		} while(dy >= 0); 
 
-		while(dx++ < a) { /* fehlerhafter Abbruch bei flachen Ellipsen (b=1) */
-			gdisp_lld_draw_pixel(x+dx, y, color); /* -> Spitze der Ellipse vollenden */
-			gdisp_lld_draw_pixel(x-dx, y, color);
-	   }   
+		if (dx < a) { /* fehlerhafter Abbruch bei flachen Ellipsen (b=1) */
+			spanAdd(x+dx+1, x+a, y); /* -> Spitze der Ellipse vollenden */
+			spanAdd(x-a, x-dx-1, y);
+		}
+		spanEnd();
 	}
 #endif
 
 #if GDISP_NEED_ELLIPSE && !GDISP_HARDWARE_ELLIPSEFILLS
 	void gdisp_lld_fill_ellipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
 		int  dx = 0, dy = b; /* im I. Quadranten von links oben nach rechts unten */
+		int  w;
 		long a2 = a*a, b2 = b*b;
 		long err = b2-(2*b-1)*a2, e2; /* Fehler im 1. Schritt */
 
+		spanBegin(color);
 		do {
-			gdisp_lld_draw_line(x-dx,y+dy,x+dx,y+dy, color);
-			gdisp_lld_draw_line(x-dx,y-dy,x+dx,y-dy, color);
-
 			e2 = 2*err;
+			w = dx;
 			if(e2 <  (2*dx+1)*b2) {
 				dx++;
 				err += (2*dx+1)*b2;
 			}
 			if(e2 > -(2*dy-1)*a2) {
+				/* This is the widest line for this dy */
+				spanAdd(x-w, x+w, y+dy);
+				if (dy)
+					spanAdd(x-w, x+w, y-dy);
 				dy--;
 				err -= (2*dy-1)*a2;
 			}
 		} while(dy >= 0); 
 
-		while(dx++ < a) { /* fehlerhafter Abbruch bei flachen Ellipsen (b=1) */
-			gdisp_lld_draw_pixel(x+dx, y, color); /* -> Spitze der Ellipse vollenden */
-			gdisp_lld_draw_pixel(x-dx, y, color);
-	   }   
+		if (dx < a) { /* fehlerhafter Abbruch bei flachen Ellipsen (b=1) */
+			spanAdd(x+dx+1, x+a, y); /* -> Spitze der Ellipse vollenden */
+			spanAdd(x-a, x-dx-1, y);
+		}
+		spanEnd();
 	}
 #endif
 
@@ -287,7 +582,7 @@ GDISPDriver	GDISP;
 	 *
 	 * @notapi
 	 */
-	static void _draw_arc(coord_t x, coord_t y, uint16_t start, uint16_t end, uint16_t radius, color_t color) {
+	static void _draw_arc(coord_t x, coord_t y, uint16_t start, uint16_t end, uint16_t radius) {
 	    if (/*start >= 0 && */start <= 180) {
 	        float x_maxI = x + radius*cos(start*M_PI/180);
 	        float x_minI;
@@ -303,13 +598,13 @@ GDISPDriver	GDISP;
 
 	        do {
 	            if(x-a <= x_maxI && x-a >= x_minI)
-	            	gdisp_lld_draw_pixel(x-a, y-b, color);
+	            	spanAdd(x-a, x-a, y-b);
 	            if(x+a <= x_maxI && x+a >= x_minI)
-	            	gdisp_lld_draw_pixel(x+a, y-b, color);
+	            	spanAdd(x+a, x+a, y-b);
 	            if(x-b <= x_maxI && x-b >= x_minI)
-	            	gdisp_lld_draw_pixel(x-b, y-a, color);
+	            	spanAdd(x-b, x-b, y-a);
 	            if(x+b <= x_maxI && x+b >= x_minI)
-	            	gdisp_lld_draw_pixel(x+b, y-a, color);
+	            	spanAdd(x+b, x+b, y-a);
 
 	            if (P < 0) {
 	                P = P + 3 + 2*a;
@@ -337,13 +632,13 @@ GDISPDriver	GDISP;
 
 	        do {
 	            if(x-a <= x_maxII && x-a >= x_minII)
-	            	gdisp_lld_draw_pixel(x-a, y+b, color);
+	            	spanAdd(x-a, x-a, y+b);
 	            if(x+a <= x_maxII && x+a >= x_minII)
-	            	gdisp_lld_draw_pixel(x+a, y+b, color);
+	            	spanAdd(x+a, x+a, y+b);
 	            if(x-b <= x_maxII && x-b >= x_minII)
-	            	gdisp_lld_draw_pixel(x-b, y+a, color);
+	            	spanAdd(x-b, x-b, y+a);
 	            if(x+b <= x_maxII && x+b >= x_minII)
-	            	gdisp_lld_draw_pixel(x+b, y+a, color);
+	            	spanAdd(x+b, x+b, y+a);
 
 	            if (P < 0) {
 	                P = P + 3 + 2*a;
@@ -358,106 +653,123 @@ GDISPDriver	GDISP;
 	}
 
 	void gdisp_lld_draw_arc(coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle, color_t color) {
+		spanBegin(color);
 		if(endangle < startangle) {
-	        _draw_arc(x, y, startangle, 360, radius, color);
-	        _draw_arc(x, y, 0, endangle, radius, color);
+	        _draw_arc(x, y, startangle, 360, radius);
+	        _draw_arc(x, y, 0, endangle, radius);
 	    } else {
-	        _draw_arc(x, y, startangle, endangle, radius, color);
+	        _draw_arc(x, y, startangle, endangle, radius);
 		}
+		spanEnd();
 	}
 #endif
 
 #if GDISP_NEED_ARC && !GDISP_HARDWARE_ARCFILLS
+
+	#include <math.h>
+
 	/*
-	 * @brief				Internal helper function for gdispDrawArc()
+	 * @brief				Internal helper function for gdispFillArc()
+	 * @details				Fills the part of one line of the circle that lies inside the sector.
 	 *
 	 * @note				DO NOT USE DIRECTLY!
 	 *
 	 * @param[in] x, y		The middle point of the arc
-	 * @param[in] start		The start angle of the arc
-	 * @param[in] end		The end angle of the arc
-	 * @param[in] radius	The radius of the arc
-	 * @param[in] color		The color in which the arc will be drawn
+	 * @param[in] k			The distance of the line above the middle point
+	 * @param[in] w			The half width of the circle on this line
+	 * @param[in] kl, kh	The cotangents of the end and start angles of the sector
+	 * @param[in] flip		Mirror the line through the middle point (for the lower half)
 	 *
 	 * @notapi
 	 */
-	static void _fill_arc(coord_t x, coord_t y, uint16_t start, uint16_t end, uint16_t radius, color_t color) {
-	    if (/*start >= 0 && */start <= 180) {
-	        float x_maxI = x + radius*cos(start*M_PI/180);
-	        float x_minI;
-
-	        if (end > 180)
-	            x_minI = x - radius;
-	        else
-	            x_minI = x + radius*cos(end*M_PI/180);
-
-	        int a = 0;
-	        int b = radius;
-	        int P = 1 - radius;
-
-	        do {
-	            if(x-a <= x_maxI && x-a >= x_minI)
-	            	gdisp_lld_draw_line(x, y, x-a, y-b, color);
-	            if(x+a <= x_maxI && x+a >= x_minI)
-	            	gdisp_lld_draw_line(x, y, x+a, y-b, color);
-	            if(x-b <= x_maxI && x-b >= x_minI)
-	            	gdisp_lld_draw_line(x, y, x-b, y-a, color);
-	            if(x+b <= x_maxI && x+b >= x_minI)
-	            	gdisp_lld_draw_line(x, y, x+b, y-a, color);
-
-	            if (P < 0) {
-	                P = P + 3 + 2*a;
-	                a = a + 1;
-	            } else {
-	                P = P + 5 + 2*(a - b);
-	                a = a + 1;
-	                b = b - 1;
-	            }
-	        } while(a <= b);
-	    }
-
-	    if (end > 180 && end <= 360) {
-	        float x_maxII = x+radius*cos(end*M_PI/180);
-	        float x_minII;
+	static void _fill_arc_line(coord_t x, coord_t y, coord_t k, coord_t w, float kl, float kh, bool_t flip) {
+		float	f;
+		coord_t	lo, hi;
+
+		/* The bounding rays cross this line at k*cot(angle). Only pixel centres inside the sector are filled */
+		if (k) {
+			f = k*kl;
+			lo = f <= -w ? -w : (f > w ? w+1 : (coord_t)ceil(f - 0.001));
+			f = k*kh;
+			hi = f >= w ? w : (f < -w ? -w-1 : (coord_t)floor(f + 0.001));
+		} else {
+			lo = kl <= -w ? -w : 0;
+			hi = kh >= w ? w : 0;
+		}
+		if (lo > hi)
+			return;
+		if (flip)
+			spanAdd(x-hi, x-lo, y+k);
+		else
+			spanAdd(x+lo, x+hi, y-k);
+	}
 
-	        if(start <= 180)
-	            x_minII = x - radius;
-	        else
-	            x_minII = x+radius*cos(start*M_PI/180);
+	/*
+	 * @brief				Internal helper function for gdispFillArc()
+	 * @details				Fills the sector start to end (0 to 180 degrees) of the upper half of the circle.
+	 *						If flip is TRUE the angles are relative to 180 degrees and the lower half is filled.
+	 *
+	 * @note				DO NOT USE DIRECTLY!
+	 *
+	 * @notapi
+	 */
+	static void _fill_arc_half(coord_t x, coord_t y, uint16_t start, uint16_t end, uint16_t radius, bool_t flip) {
+		float	kl, kh;
+		int		a, b, P;
+
+		/* The cotangent of each bounding ray - horizontal rays get a value wider than the circle */
+		if (end >= 180)		kl = -(float)radius - 1;
+		else if (end == 0)	kl = (float)radius + 1;
+		else				kl = cos(end*M_PI/180)/sin(end*M_PI/180);
+		if (start == 0)		kh = (float)radius + 1;
+		else if (start >= 180)	kh = -(float)radius - 1;
+		else				kh = cos(start*M_PI/180)/sin(start*M_PI/180);
 
-	        int a = 0;
-	        int b = radius;
-	        int P = 1 - radius;
+		a = 0;
+		b = radius;
+		P = 1 - radius;
 
-	        do {
-	            if(x-a <= x_maxII && x-a >= x_minII)
-	            	gdisp_lld_draw_line(x, y, x-a, y+b, color);
-	            if(x+a <= x_maxII && x+a >= x_minII)
-	            	gdisp_lld_draw_line(x, y, x+a, y+b, color);
-	            if(x-b <= x_maxII && x-b >= x_minII)
-	            	gdisp_lld_draw_line(x, y, x-b, y+a, color);
-	            if(x+b <= x_maxII && x+b >= x_minII)
-	            	gdisp_lld_draw_line(x, y, x+b, y+a, color);
+		do {
+			_fill_arc_line(x, y, a, b, kl, kh, flip);
+			if (P < 0)
+				P += 3 + 2*a++;
+			else {
+				/* This is the widest line for this b */
+				if (a != b)
+					_fill_arc_line(x, y, b, a, kl, kh, flip);
+				P += 5 + 2*(a++ - b--);
+			}
+		} while(a <= b);
+	}
 
-	            if (P < 0) {
-	                P = P + 3 + 2*a;
-	                a = a + 1;
-	            } else {
-	                P = P + 5 + 2*(a - b);
-	                a = a + 1;
-	                b = b - 1;
-	            }
-	        } while (a <= b);
-	    }
+	/*
+	 * @brief				Internal helper function for gdispFillArc()
+	 *
+	 * @note				DO NOT USE DIRECTLY!
+	 *
+	 * @param[in] x, y		The middle point of the arc
+	 * @param[in] start		The start angle of the arc
+	 * @param[in] end		The end angle of the arc
+	 * @param[in] radius	The radius of the arc
+	 *
+	 * @notapi
+	 */
+	static void _fill_arc(coord_t x, coord_t y, uint16_t start, uint16_t end, uint16_t radius) {
+		if (start <= 180)
+			_fill_arc_half(x, y, start, end > 180 ? 180 : end, radius, FALSE);
+		if (end > 180 && end <= 360)
+			_fill_arc_half(x, y, start > 180 ? start-180 : 0, end-180, radius, TRUE);
 	}
 
 	void gdisp_lld_fill_arc(coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle, color_t color) {
+		spanBegin(color);
 		if(endangle < startangle) {
-	        _fill_arc(x, y, startangle, 360, radius, color);
-	        _fill_arc(x, y, 0, endangle, radius, color);
+	        _fill_arc(x, y, startangle, 360, radius);
+	        _fill_arc(x, y, 0, endangle, radius);
 	    } else {
-	        _fill_arc(x, y, startangle, endangle, radius, color);
+	        _fill_arc(x, y, startangle, endangle, radius);
 		}
+		spanEnd();
 	}
 #endif
 
@@ -476,6 +788,15 @@ void *gdisp_lld_query(unsigned what) {
 }
 #endif
 
+#if GDISP_NEED_AUTOFLUSH && !GDISP_HARDWARE_FLUSH
+void gdisp_lld_flush(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+	(void) x;
+	(void) y;
+	(void) cx;
+	(void) cy;
+}
+#endif
+
 #if GDISP_NEED_MSGAPI
 	void gdisp_lld_msg_dispatch(gdisp_lld_msg_t *msg) {
 		switch(msg->action) {
@@ -499,6 +820,25 @@ void *gdisp_lld_query(unsigned what) {
 		case GDISP_LLD_MSG_DRAWLINE:
 			gdisp_lld_draw_line(msg->drawline.x0, msg->drawline.y0, msg->drawline.x1, msg->drawline.y1, msg->drawline.color);
 			break;
+		case GDISP_LLD_MSG_FILLSPANS:
+			gdisp_lld_fill_spans(msg->fillspans.spans, msg->fillspans.cnt, msg->fillspans.color);
+			break;
+		#if GDISP_NEED_ALPHA
+			case GDISP_LLD_MSG_FILLAREAALPHA:
+				gdisp_lld_fill_area_alpha(msg->fillareaalpha.x, msg->fillareaalpha.y, msg->fillareaalpha.cx, msg->fillareaalpha.cy, msg->fillareaalpha.color, msg->fillareaalpha.alpha);
+				break;
+			case GDISP_LLD_MSG_BLITAREAALPHA:
+				gdisp_lld_blit_area_alpha(msg->blitareaalpha.x, msg->blitareaalpha.y, msg->blitareaalpha.cx, msg->blitareaalpha.cy, msg->blitareaalpha.srcx, msg->blitareaalpha.srcy, msg->blitareaalpha.srccx, msg->blitareaalpha.buffer, msg->blitareaalpha.alpha);
+				break;
+			case GDISP_LLD_MSG_DRAWLINEAA:
+				gdisp_lld_draw_line_aa(msg->drawlineaa.x0, msg->drawlineaa.y0, msg->drawlineaa.x1, msg->drawlineaa.y1, msg->drawlineaa.color);
+				break;
+		#endif
+		#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+			case GDISP_LLD_MSG_DRAWCIRCLEAA:
+				gdisp_lld_draw_circle_aa(msg->drawcircleaa.x, msg->drawcircleaa.y, msg->drawcircleaa.radius, msg->drawcircleaa.color);
+				break;
+		#endif
 		#if GDISP_NEED_CLIP
 			case GDISP_LLD_MSG_SETCLIP:
 				gdisp_lld_set_clip(msg->setclip.x, msg->setclip.y, msg->setclip.cx, msg->setclip.cy);
@@ -522,10 +862,10 @@ void *gdisp_lld_query(unsigned what) {
 		#endif
 		#if GDISP_NEED_ARC
 			case GDISP_LLD_MSG_DRAWARC:
-				gdisp_lld_draw_circle(msg->drawarc.x, msg->drawarc.y, msg->drawarc.radius, msg->drawarc.startangle, msg->drawarc.endangle, msg->drawarc.color);
+				gdisp_lld_draw_arc(msg->drawarc.x, msg->drawarc.y, msg->drawarc.radius, msg->drawarc.startangle, msg->drawarc.endangle, msg->drawarc.color);
 				break;
 			case GDISP_LLD_MSG_FILLARC:
-				gdisp_lld_fill_circle(msg->fillarc.x, msg->fillarc.y, msg->fillarc.radius, msg->fillarc.startangle, msg->fillarc.endangle, msg->fillarc.color);
+				gdisp_lld_fill_arc(msg->fillarc.x, msg->fillarc.y, msg->fillarc.radius, msg->fillarc.startangle, msg->fillarc.endangle, msg->fillarc.color);
 				break;
 		#endif
 		#if GDISP_NEED_PIXELREAD
@@ -548,6 +888,11 @@ void *gdisp_lld_query(unsigned what) {
 				msg->query.result = gdisp_lld_query(msg->query.what);
 				break;
 		#endif
+		#if GDISP_NEED_AUTOFLUSH
+			case GDISP_LLD_MSG_FLUSH:
+				gdisp_lld_flush(msg->flush.x, msg->flush.y, msg->flush.cx, msg->flush.cy);
+				break;
+		#endif
 		}
 	}
 #endif
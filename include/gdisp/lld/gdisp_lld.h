@@ -58,6 +58,17 @@
 		#define GDISP_HARDWARE_BITFILLS			FALSE
 	#endif
 
+	/**
+	 * @brief   Hardware accelerated fills of a list of horizontal spans.
+	 * @details If set to @p FALSE software emulation is used.
+	 * @note	Circles, ellipses, arcs and convex polygons are rasterized
+	 *			into spans. Drivers with a window/stream interface can
+	 *			push a whole batch of spans in one bus transaction.
+	 */
+	#ifndef GDISP_HARDWARE_SPANS
+		#define GDISP_HARDWARE_SPANS			FALSE
+	#endif
+
 	/**
 	 * @brief   Hardware accelerated circles.
 	 * @details If set to @p FALSE software emulation is used.
@@ -122,6 +133,16 @@
 		#define GDISP_HARDWARE_PIXELREAD		FALSE
 	#endif
 
+	/**
+	 * @brief   The driver can blend pixels into the display in place.
+	 * @details If set to @p FALSE software emulation is used.
+	 * @note	The emulation reads back each pixel. Drivers that keep the display
+	 *			contents in memory should blend directly in their framebuffer.
+	 */
+	#ifndef GDISP_HARDWARE_ALPHA
+		#define GDISP_HARDWARE_ALPHA			FALSE
+	#endif
+
 	/**
 	 * @brief   The driver supports one or more control commands.
 	 * @details If set to @p FALSE there is no support for control commands.
@@ -138,6 +159,15 @@
 		#define GDISP_HARDWARE_QUERY			FALSE
 	#endif
 
+	/**
+	 * @brief   The driver supports flushing changed areas to the display.
+	 * @details If set to @p FALSE gdisp_lld_flush() does nothing.
+	 * @note	Only used if GDISP_NEED_AUTOFLUSH is TRUE.
+	 */
+	#ifndef GDISP_HARDWARE_FLUSH
+		#define GDISP_HARDWARE_FLUSH			FALSE
+	#endif
+
 	/**
 	 * @brief   The driver supports a clipping in hardware.
 	 * @details If set to @p FALSE there is no support for non-standard queries.
@@ -204,6 +234,22 @@
 	#endif
 /** @} */
 
+/*===========================================================================*/
+/* Type definitions.                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief   A horizontal run of pixels passed to gdisp_lld_fill_spans().
+ * @note	Spans are always already clipped and have a cx of at least 1.
+ */
+typedef struct gdisp_lld_span_t {
+	coord_t		x, y;			/* The left-most pixel of the span */
+	coord_t		cx;				/* The number of pixels in the span */
+} gdisp_lld_span_t;
+
+/* The blending kernel for the pixel format */
+#include "gdisp_lld_blend.h"
+
 /*===========================================================================*/
 /* External declarations.                                                    */
 /*===========================================================================*/
@@ -225,6 +271,7 @@ extern "C" {
 	extern void gdisp_lld_fill_area(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color);
 	extern void gdisp_lld_blit_area_ex(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer);
 	extern void gdisp_lld_draw_line(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color);
+	extern void gdisp_lld_fill_spans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color);
 
 	/* Circular Drawing Functions */
 	#if GDISP_NEED_CIRCLE
@@ -249,6 +296,17 @@ extern "C" {
 	extern void gdisp_lld_fill_char(coord_t x, coord_t y, uint16_t c, font_t font, color_t color, color_t bgcolor);
 	#endif
 
+	/* Alpha blending and anti-aliased drawing */
+	#if GDISP_NEED_ALPHA
+	extern void gdisp_lld_blend_pixel(coord_t x, coord_t y, color_t color, uint8_t alpha);
+	extern void gdisp_lld_fill_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha);
+	extern void gdisp_lld_blit_area_alpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha);
+	extern void gdisp_lld_draw_line_aa(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color);
+	#endif
+	#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+	extern void gdisp_lld_draw_circle_aa(coord_t x, coord_t y, coord_t radius, color_t color);
+	#endif
+
 	/* Pixel readback */
 	#if GDISP_NEED_PIXELREAD
 	extern color_t gdisp_lld_get_pixel_color(coord_t x, coord_t y);
@@ -274,6 +332,11 @@ extern "C" {
 	extern void gdisp_lld_set_clip(coord_t x, coord_t y, coord_t cx, coord_t cy);
 	#endif
 
+	/* Flushing Function - sends a changed area to the display */
+	#if GDISP_NEED_AUTOFLUSH
+	extern void gdisp_lld_flush(coord_t x, coord_t y, coord_t cx, coord_t cy);
+	#endif
+
 	/* Messaging API */
 	#if GDISP_NEED_MSGAPI
 	#include "gdisp_lld_msgs.h"
@@ -0,0 +1,114 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * @file	include/gdisp/lld/gdisp_lld_blend.h
+ * @brief   GDISP Graphic Driver subsystem color blending kernels.
+ *
+ * @details	Each pixel format gets its own kernel. The color channels are spread
+ * 			out within a 32 bit word so that there is room above each channel for
+ * 			the multiply. A single multiply (two for RGB888) then blends all the
+ * 			channels at once without unpacking the color into separate values.
+ *
+ * @addtogroup GDISP
+ * @{
+ */
+
+#ifndef _GDISP_LLD_BLEND_H
+#define _GDISP_LLD_BLEND_H
+
+#if GFX_USE_GDISP || defined(__DOXYGEN__)
+
+/**
+ * @brief   Blend 2 colors according to the alpha.
+ * @return	The combined color
+ * @note	Can be used by low level drivers that blend in place.
+ *
+ * @param[in] fg		The foreground color
+ * @param[in] bg		The background color
+ * @param[in] alpha		The alpha value (0-255). 0 is all background, 255 is all foreground.
+ *
+ * @notapi
+ */
+#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB565
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint32_t	f, b, a;
+
+		/* 00000ggg ggg00000 rrrrr000 000bbbbb - 5 bits of headroom above each channel */
+		f = ((uint32_t)fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+		b = ((uint32_t)bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+		a = ((uint32_t)alpha + 4) >> 3;					// 0 to 32
+		f = ((f * a + b * (32 - a)) >> 5) & 0x07E0F81F;
+		return (color_t)(f | (f >> 16));
+	}
+
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint32_t	rb, g, a;
+
+		a = (uint32_t)alpha + (alpha >> 7);				// 0 to 256
+		rb = (((fg & 0xFF00FF) * a + (bg & 0xFF00FF) * (256 - a)) >> 8) & 0xFF00FF;
+		g = (((fg & 0x00FF00) * a + (bg & 0x00FF00) * (256 - a)) >> 8) & 0x00FF00;
+		return (color_t)(rb | g);
+	}
+
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB666
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint32_t	rb, g, a;
+
+		a = ((uint32_t)alpha + 2) >> 2;					// 0 to 64
+		rb = (((fg & 0x03F03F) * a + (bg & 0x03F03F) * (64 - a)) >> 6) & 0x03F03F;
+		g = (((fg & 0x000FC0) * a + (bg & 0x000FC0) * (64 - a)) >> 6) & 0x000FC0;
+		return (color_t)(rb | g);
+	}
+
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB444
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint32_t	f, b, a;
+
+		/* 0000gggg 00000000 rrrr0000 bbbb - 4 bits of headroom above each channel */
+		f = ((uint32_t)fg & 0x0F0F) | (((uint32_t)fg & 0x00F0) << 16);
+		b = ((uint32_t)bg & 0x0F0F) | (((uint32_t)bg & 0x00F0) << 16);
+		a = ((uint32_t)alpha + 8) >> 4;					// 0 to 16
+		f = ((f * a + b * (16 - a)) >> 4) & 0x00F00F0F;
+		return (color_t)((f & 0x0F0F) | ((f >> 16) & 0x00F0));
+	}
+
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB332
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint32_t	f, b, a;
+
+		/* 00000ggg 00000000 rrr000bb - 3 bits of headroom above each channel */
+		f = ((uint32_t)fg & 0xE3) | (((uint32_t)fg & 0x1C) << 14);
+		b = ((uint32_t)bg & 0xE3) | (((uint32_t)bg & 0x1C) << 14);
+		a = ((uint32_t)alpha + 16) >> 5;				// 0 to 8
+		f = ((f * a + b * (8 - a)) >> 3) & 0x000700E3;
+		return (color_t)((f & 0xE3) | ((f >> 14) & 0x1C));
+	}
+
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_MONO
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		return alpha & 0x80 ? fg : bg;
+	}
+
+#else
+	static inline color_t gdisp_lld_blend_color(color_t fg, color_t bg, uint8_t alpha) {
+		uint16_t	fg_ratio, bg_ratio;
+		uint16_t	r, g, b;
+
+		fg_ratio = alpha + 1;
+		bg_ratio = 256 - alpha;
+		r = (RED_OF(fg) * fg_ratio + RED_OF(bg) * bg_ratio) >> 8;
+		g = (GREEN_OF(fg) * fg_ratio + GREEN_OF(bg) * bg_ratio) >> 8;
+		b = (BLUE_OF(fg) * fg_ratio + BLUE_OF(bg) * bg_ratio) >> 8;
+		return RGB2COLOR(r, g, b);
+	}
+#endif
+
+#endif	/* GFX_USE_GDISP */
+#endif	/* _GDISP_LLD_BLEND_H */
+/** @} */
@@ -27,6 +27,15 @@ typedef enum gdisp_msgaction {
 	GDISP_LLD_MSG_FILLAREA,
 	GDISP_LLD_MSG_BLITAREA,
 	GDISP_LLD_MSG_DRAWLINE,
+	GDISP_LLD_MSG_FILLSPANS,
+	#if GDISP_NEED_ALPHA
+		GDISP_LLD_MSG_FILLAREAALPHA,
+		GDISP_LLD_MSG_BLITAREAALPHA,
+		GDISP_LLD_MSG_DRAWLINEAA,
+	#endif
+	#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+		GDISP_LLD_MSG_DRAWCIRCLEAA,
+	#endif
 	#if GDISP_NEED_CLIP
 		GDISP_LLD_MSG_SETCLIP,
 	#endif
@@ -52,37 +61,34 @@ typedef enum gdisp_msgaction {
 		GDISP_LLD_MSG_CONTROL,
 	#endif
 	GDISP_LLD_MSG_QUERY,
+	#if GDISP_NEED_AUTOFLUSH
+		GDISP_LLD_MSG_FLUSH,
+	#endif
 } gdisp_msgaction_t;
 
 typedef union gdisp_lld_msg {
 	struct {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;
 	};
 	struct gdisp_lld_msg_init {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_INIT
 	} init;
 	struct gdisp_lld_msg_clear {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_CLEAR
 		color_t				color;
 	} clear;
 	struct gdisp_lld_msg_drawpixel {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWPIXEL
 		coord_t				x, y;
 		color_t				color;
 	} drawpixel;
 	struct gdisp_lld_msg_fillarea {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLAREA
 		coord_t				x, y;
 		coord_t				cx, cy;
 		color_t				color;
 	} fillarea;
 	struct gdisp_lld_msg_blitarea {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_BLITAREA
 		coord_t				x, y;
 		coord_t				cx, cy;
@@ -91,48 +97,75 @@ typedef union gdisp_lld_msg {
 		const pixel_t		*buffer;
 	} blitarea;
 	struct gdisp_lld_msg_setclip {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_SETCLIP
 		coord_t				x, y;
 		coord_t				cx, cy;
 	} setclip;
 	struct gdisp_lld_msg_drawline {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWLINE
 		coord_t				x0, y0;
 		coord_t				x1, y1;
 		color_t				color;
 	} drawline;
+	struct gdisp_lld_msg_fillspans {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLSPANS
+		unsigned			cnt;
+		const gdisp_lld_span_t	*spans;
+		color_t				color;
+	} fillspans;
+	struct gdisp_lld_msg_fillareaalpha {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLAREAALPHA
+		coord_t				x, y;
+		coord_t				cx, cy;
+		color_t				color;
+		uint8_t				alpha;
+	} fillareaalpha;
+	struct gdisp_lld_msg_blitareaalpha {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_BLITAREAALPHA
+		coord_t				x, y;
+		coord_t				cx, cy;
+		coord_t				srcx, srcy;
+		coord_t				srccx;
+		const pixel_t		*buffer;
+		uint8_t				alpha;
+	} blitareaalpha;
+	struct gdisp_lld_msg_drawlineaa {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWLINEAA
+		coord_t				x0, y0;
+		coord_t				x1, y1;
+		color_t				color;
+	} drawlineaa;
+	struct gdisp_lld_msg_drawcircleaa {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWCIRCLEAA
+		coord_t				x, y;
+		coord_t				radius;
+		color_t				color;
+	} drawcircleaa;
 	struct gdisp_lld_msg_drawcircle {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWCIRCLE
 		coord_t				x, y;
 		coord_t				radius;
 		color_t				color;
 	} drawcircle;
 	struct gdisp_lld_msg_fillcircle {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLCIRCLE
 		coord_t				x, y;
 		coord_t				radius;
 		color_t				color;
 	} fillcircle;
 	struct gdisp_lld_msg_drawellipse {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWELLIPSE
 		coord_t				x, y;
 		coord_t				a, b;
 		color_t				color;
 	} drawellipse;
 	struct gdisp_lld_msg_fillellipse {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLELLIPSE
 		coord_t				x, y;
 		coord_t				a, b;
 		color_t				color;
 	} fillellipse;
 	struct gdisp_lld_msg_drawarc {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_DRAWARC
 		coord_t				x, y;
 		coord_t				radius;
@@ -140,7 +173,6 @@ typedef union gdisp_lld_msg {
 		color_t				color;
 	} drawarc;
 	struct gdisp_lld_msg_fillarc {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FILLARC
 		coord_t				x, y;
 		coord_t				radius;
@@ -148,13 +180,11 @@ typedef union gdisp_lld_msg {
 		color_t				color;
 	} fillarc;
 	struct gdisp_lld_msg_getpixelcolor {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_GETPIXELCOLOR
 		coord_t				x, y;
 		color_t				result;
 	} getpixelcolor;
 	struct gdisp_lld_msg_verticalscroll {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_VERTICALSCROLL
 		coord_t				x, y;
 		coord_t				cx, cy;
@@ -162,17 +192,20 @@ typedef union gdisp_lld_msg {
 		color_t				bgcolor;
 	} verticalscroll;
 	struct gdisp_lld_msg_control {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_CONTROL
 		int					what;
 		void *				value;
 	} control;
 	struct gdisp_lld_msg_query {
-		gfxQueueItem		qi;
 		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_QUERY
 		int					what;
 		void *				result;
 	} query;
+	struct gdisp_lld_msg_flush {
+		gdisp_msgaction_t	action;			// GDISP_LLD_MSG_FLUSH
+		coord_t				x, y;
+		coord_t				cx, cy;
+	} flush;
 } gdisp_lld_msg_t;
 
 #endif	/* GFX_USE_GDISP && GDISP_NEED_MSGAPI */
@@ -80,6 +80,24 @@
 	#ifndef GDISP_NEED_CONVEX_POLYGON
 		#define GDISP_NEED_CONVEX_POLYGON		FALSE
 	#endif
+	/**
+	 * @brief   Are alpha blended fills and blits and anti-aliased lines and circles needed.
+	 * @details	Defaults to FALSE
+	 * @note	Drivers that can't blend in place (GDISP_HARDWARE_ALPHA) need
+	 * 			to be able to read back pixels. Without pixel read-back a
+	 * 			blended pixel is drawn in full color if it is at least half opaque.
+	 */
+	#ifndef GDISP_NEED_ALPHA
+		#define GDISP_NEED_ALPHA				FALSE
+	#endif
+	/**
+	 * @brief   Are pixel format conversion functions needed.
+	 * @details	Defaults to FALSE
+	 * @note	Turned on automatically when the NATIVE, GIF or BMP image decoders are used.
+	 */
+	#ifndef GDISP_NEED_CONVERT
+		#define GDISP_NEED_CONVERT				FALSE
+	#endif
 	/**
 	 * @brief   Are scrolling functions needed.
 	 * @details	Defaults to FALSE
@@ -131,6 +149,35 @@
 	#ifndef GDISP_NEED_MSGAPI
 		#define GDISP_NEED_MSGAPI		FALSE
 	#endif
+	/**
+	 * @brief   Should drawing be tracked so that only changed areas are sent to the display.
+	 * @details	Defaults to FALSE
+	 * @note	This is only useful for drivers that keep a frame buffer or shadow copy
+	 * 			of the display and implement gdisp_lld_flush(). For other drivers
+	 * 			it just adds overhead.
+	 * @note	Changed areas are sent when gdispFlush() is called and, depending
+	 * 			on the GDISP_AUTOFLUSH_xxx settings, periodically or when enough
+	 * 			of the display has changed.
+	 */
+	#ifndef GDISP_NEED_AUTOFLUSH
+		#define GDISP_NEED_AUTOFLUSH	FALSE
+	#endif
+	/**
+	 * @brief   Are display lists (recording and replaying drawing operations) needed.
+	 * @details	Defaults to FALSE
+	 */
+	#ifndef GDISP_NEED_LIST
+		#define GDISP_NEED_LIST			FALSE
+	#endif
+	/**
+	 * @brief   Are drawing contexts (per context clip, origin and colors) needed.
+	 * @details	Defaults to FALSE
+	 * @note	Turns on GDISP_NEED_CLIP.
+	 * @note	Not supported with GDISP_NEED_ASYNC.
+	 */
+	#ifndef GDISP_NEED_CONTEXT
+		#define GDISP_NEED_CONTEXT		FALSE
+	#endif
 /**
  * @}
  *
@@ -152,6 +199,19 @@
 	#ifndef GDISP_NEED_IMAGE_GIF
 		#define GDISP_NEED_IMAGE_GIF	FALSE
 	#endif
+	/**
+	 * @brief   Should animated GIF images be drawn from a composited canvas.
+	 * @details	Defaults to FALSE
+	 * @note	Each frame is composited into a full size canvas with every GIF disposal method
+	 * 			(including restoring). When an animation is drawn in the same place each frame only
+	 * 			the area that changed is drawn to the display.
+	 * @note	This uses width * height pixels of RAM for each open animated GIF.
+	 * @note	Transparent areas of the image are drawn in the image background color.
+	 * 			See @p gdispImageSetBgColor().
+	 */
+	#ifndef GDISP_NEED_IMAGE_GIF_CANVAS
+		#define GDISP_NEED_IMAGE_GIF_CANVAS	FALSE
+	#endif
 	/**
 	 * @brief   Is BMP image decoding required.
 	 * @details	Defaults to FALSE
@@ -180,6 +240,26 @@
 	#ifndef GDISP_NEED_IMAGE_ACCOUNTING
 		#define GDISP_NEED_IMAGE_ACCOUNTING	FALSE
 	#endif
+	/**
+	 * @brief   Should cached images be shared between images opened from the same source.
+	 * @details	Defaults to FALSE
+	 * @note	The first frame cached by @p gdispImageCache() is kept in a process wide cache
+	 * 			of GDISP_IMAGE_SHARED_CACHE_SIZE bytes. Opening the same memory image or file
+	 * 			again (eg for several image widgets) uses the cached pixels instead of decoding them again.
+	 * @note	Used by the NATIVE, BMP, JPG and PNG decoders. GIF images are not shared.
+	 */
+	#ifndef GDISP_NEED_IMAGE_SHARED_CACHE
+		#define GDISP_NEED_IMAGE_SHARED_CACHE	FALSE
+	#endif
+	/**
+	 * @brief   Are scaled and rotated image drawing required.
+	 * @details	Defaults to FALSE
+	 * @note	Adds @p gdispImageDrawScaled() and @p gdispImageDrawRotated() for NATIVE, GIF,
+	 * 			BMP, JPG and PNG images.
+	 */
+	#ifndef GDISP_NEED_IMAGE_TRANSFORM
+		#define GDISP_NEED_IMAGE_TRANSFORM	FALSE
+	#endif
 /**
  * @}
  * 
@@ -209,6 +289,29 @@
 	#ifndef GDISP_NEED_ANTIALIAS
 		#define GDISP_NEED_ANTIALIAS	FALSE
 	#endif
+
+	/**
+	 * @brief	Cache rendered glyphs so that repeated text doesn't need to be decoded again.
+	 * @details	Defaults to FALSE
+	 * @note	Filled text is cached as pixels already colored for its foreground and
+	 * 			background which are drawn with a single blit. Other text is cached as a
+	 * 			coverage mask.
+	 * @note	The cache memory is allocated from the heap and is limited to
+	 * 			GDISP_TEXT_CACHE_SIZE bytes.
+	 */
+	#ifndef GDISP_NEED_TEXT_CACHE
+		#define GDISP_NEED_TEXT_CACHE	FALSE
+	#endif
+
+	/**
+	 * @brief	Text layouts that measure and position a string once so it can be drawn many times.
+	 * @details	Defaults to FALSE
+	 * @note	A layout can also break the text into lines at newlines or to fit a width.
+	 * @note	The positioned characters are allocated from the heap.
+	 */
+	#ifndef GDISP_NEED_TEXT_LAYOUT
+		#define GDISP_NEED_TEXT_LAYOUT	FALSE
+	#endif
 	
 /**
  * @}
@@ -233,13 +336,68 @@
 	 * @details	Defaults to FALSE
 	 * @note	Both GDISP_NEED_MULTITHREAD and GDISP_NEED_ASYNC make
 	 * 			the gdisp API thread-safe.
-	 * @note	Turning this on adds two context switches per transaction
-	 *			so it can significantly slow graphics drawing but it allows
-	 *			drawing operations to continue in the background.
+	 * @note	Drawing operations are queued to a background thread which
+	 *			draws them in batches. This allows drawing operations to continue
+	 *			in the background but calls that return a value (eg pixel reads)
+	 *			are still performed synchronously.
 	 */
 	#ifndef GDISP_NEED_ASYNC
 		#define GDISP_NEED_ASYNC		FALSE
 	#endif
+	/**
+	 * @brief   The size (in bytes) of the command ring used by GDISP_NEED_ASYNC.
+	 * @details	Defaults to 1024
+	 * @note	Drawing calls are copied into the ring together with any
+	 * 			text or blit pixels they need so the caller's buffers may be
+	 * 			reused as soon as the call returns. Blits and strings that
+	 * 			need more than half the ring are drawn synchronously instead.
+	 * @note	Only relevant if GDISP_NEED_ASYNC is TRUE.
+	 */
+	#ifndef GDISP_ASYNC_RING_SIZE
+		#define GDISP_ASYNC_RING_SIZE	1024
+	#endif
+	/**
+	 * @brief   The stack size (in bytes) of the GDISP_NEED_ASYNC drawing thread.
+	 * @details	Defaults to 2048
+	 * @note	Queued text is rendered on this thread so the stack must hold the
+	 * 			whole font rendering call chain (about 1K) plus the display driver.
+	 * 			Increase it if your driver uses a lot of stack.
+	 * @note	Only relevant if GDISP_NEED_ASYNC is TRUE.
+	 */
+	#ifndef GDISP_THREAD_STACK_SIZE
+		#define GDISP_THREAD_STACK_SIZE	2048
+	#endif
+/**
+ * @}
+ *
+ * @name    GDISP Flushing Options
+ * @pre		GDISP_NEED_AUTOFLUSH must be TRUE
+ * @{
+ */
+	/**
+	 * @brief   The maximum number of separate dirty rectangles tracked.
+	 * @details	Defaults to 8
+	 * @note	Overlapping or touching rectangles are always merged. When the list
+	 * 			is full the two rectangles that merge with the least growth are combined.
+	 */
+	#ifndef GDISP_AUTOFLUSH_RECTS
+		#define GDISP_AUTOFLUSH_RECTS		8
+	#endif
+	/**
+	 * @brief   Flush the changed areas every this many milliseconds.
+	 * @details	Defaults to 0 (no periodic flushing)
+	 * @note	Uses a GTIMER and requires GDISP_NEED_MULTITHREAD or GDISP_NEED_ASYNC.
+	 */
+	#ifndef GDISP_AUTOFLUSH_PERIOD
+		#define GDISP_AUTOFLUSH_PERIOD		0
+	#endif
+	/**
+	 * @brief   Flush immediately once at least this many pixels have changed.
+	 * @details	Defaults to 0 (no threshold flushing)
+	 */
+	#ifndef GDISP_AUTOFLUSH_THRESHOLD
+		#define GDISP_AUTOFLUSH_THRESHOLD	0
+	#endif
 /**
  * @}
  *
@@ -257,6 +415,35 @@
  * @name    GDISP Optional Sizing Parameters
  * @{
  */
+	/**
+	 * @brief   The number of horizontal spans batched up before they are
+	 *			handed to gdisp_lld_fill_spans().
+	 * @details	Defaults to 32
+	 * @note	Circles, ellipses, arcs and polygons are rasterized into spans.
+	 *			Each span uses 3 coord_t's of stack or static RAM.
+	 */
+	#ifndef GDISP_SPAN_BUFFER_SIZE
+		#define GDISP_SPAN_BUFFER_SIZE		32
+	#endif
+	/**
+	 * @brief   The maximum number of bytes of heap used by the glyph cache.
+	 * @details	Defaults to 4096
+	 * @note	Only used if GDISP_NEED_TEXT_CACHE is TRUE. When the cache is full
+	 *			the least recently used glyphs are discarded.
+	 */
+	#ifndef GDISP_TEXT_CACHE_SIZE
+		#define GDISP_TEXT_CACHE_SIZE		4096
+	#endif
+	/**
+	 * @brief   The maximum number of bytes of heap used by the shared image cache.
+	 * @details	Defaults to 65536
+	 * @note	Only used if GDISP_NEED_IMAGE_SHARED_CACHE is TRUE. When the cache is full
+	 *			the least recently used images that are not open are discarded. An image that
+	 *			won't fit is still cached but just for itself.
+	 */
+	#ifndef GDISP_IMAGE_SHARED_CACHE_SIZE
+		#define GDISP_IMAGE_SHARED_CACHE_SIZE	65536
+	#endif
 /**
  * @}
  *
@@ -96,6 +96,22 @@
 			#define GDISP_NEED_MULTITHREAD	TRUE
 		#endif
 	#endif
+	#if GWIN_REDRAW_DEFERRED
+		#if !GWIN_NEED_WINDOWMANAGER
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GWIN: GWIN_NEED_WINDOWMANAGER is required if GWIN_REDRAW_DEFERRED is TRUE. It has been turned on for you."
+			#endif
+			#undef GWIN_NEED_WINDOWMANAGER
+			#define GWIN_NEED_WINDOWMANAGER	TRUE
+		#endif
+		#if GWIN_REDRAW_PERIOD && !GFX_USE_GTIMER
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GWIN: GFX_USE_GTIMER is required if GWIN_REDRAW_PERIOD is not 0. It has been turned on for you."
+			#endif
+			#undef GFX_USE_GTIMER
+			#define	GFX_USE_GTIMER		TRUE
+		#endif
+	#endif
 	#if GWIN_NEED_WINDOWMANAGER
 		#if !GFX_USE_GQUEUE || !GQUEUE_NEED_ASYNC
 			#if GFX_DISPLAY_RULE_WARNINGS
@@ -137,14 +153,38 @@
 	#if GDISP_NEED_MULTITHREAD && GDISP_NEED_ASYNC
 		#error "GDISP: Only one of GDISP_NEED_MULTITHREAD and GDISP_NEED_ASYNC should be defined."
 	#endif
-	#if GDISP_NEED_ASYNC && !(GFX_USE_GQUEUE && GQUEUE_NEED_GSYNC)
+	#if GDISP_NEED_ASYNC && !GDISP_NEED_MSGAPI
 		#if GFX_DISPLAY_RULE_WARNINGS
-			#warning "GDISP: GDISP_NEED_ASYNC requires GFX_USE_GQUEUE and GQUEUE_NEED_GSYNC. They have been turned on for you."
+			#warning "GDISP: GDISP_NEED_ASYNC requires GDISP_NEED_MSGAPI. It has been turned on for you."
+		#endif
+		#undef GDISP_NEED_MSGAPI
+		#define	GDISP_NEED_MSGAPI	TRUE
+	#endif
+	#if GDISP_NEED_CONTEXT && GDISP_NEED_ASYNC
+		#error "GDISP: GDISP_NEED_CONTEXT is not supported with GDISP_NEED_ASYNC."
+	#endif
+	#if GDISP_NEED_CONTEXT && !GDISP_NEED_CLIP
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#warning "GDISP: GDISP_NEED_CONTEXT requires GDISP_NEED_CLIP. It has been turned on for you."
+		#endif
+		#undef GDISP_NEED_CLIP
+		#define	GDISP_NEED_CLIP		TRUE
+	#endif
+	#if GDISP_NEED_AUTOFLUSH && GDISP_AUTOFLUSH_PERIOD
+		#if !GDISP_NEED_MULTITHREAD && !GDISP_NEED_ASYNC
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GDISP: GDISP_AUTOFLUSH_PERIOD requires GDISP_NEED_MULTITHREAD or GDISP_NEED_ASYNC. GDISP_NEED_MULTITHREAD has been turned on for you."
+			#endif
+			#undef GDISP_NEED_MULTITHREAD
+			#define GDISP_NEED_MULTITHREAD	TRUE
+		#endif
+		#if !GFX_USE_GTIMER
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GDISP: GFX_USE_GTIMER is required if GDISP_AUTOFLUSH_PERIOD is set. It has been turned on for you."
+			#endif
+			#undef GFX_USE_GTIMER
+			#define	GFX_USE_GTIMER		TRUE
 		#endif
-		#undef GFX_USE_GQUEUE
-		#define	GFX_USE_GQUEUE		TRUE
-		#undef GQUEUE_NEED_GSYNC
-		#define	GQUEUE_NEED_GSYNC	TRUE
 	#endif
 	#if GDISP_NEED_ANTIALIAS && !GDISP_NEED_PIXELREAD
 		#if GDISP_HARDWARE_PIXELREAD
@@ -159,6 +199,26 @@
 			#endif
 		#endif
 	#endif
+	#if GDISP_NEED_ALPHA && !GDISP_HARDWARE_ALPHA && !GDISP_NEED_PIXELREAD
+		#if GDISP_HARDWARE_PIXELREAD
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GDISP: GDISP_NEED_ALPHA has been set but GDISP_NEED_PIXELREAD has not. It has been turned on for you."
+			#endif
+			#undef GDISP_NEED_PIXELREAD
+			#define GDISP_NEED_PIXELREAD	TRUE
+		#else
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#warning "GDISP: GDISP_NEED_ALPHA has been set but your hardware can neither blend nor read back pixels. Blended pixels will be drawn solid or not at all."
+			#endif
+		#endif
+	#endif
+	#if GDISP_NEED_IMAGE && (GDISP_NEED_IMAGE_NATIVE || GDISP_NEED_IMAGE_GIF || GDISP_NEED_IMAGE_BMP || GDISP_NEED_IMAGE_PNG) && !GDISP_NEED_CONVERT
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#warning "GDISP: The NATIVE, GIF, BMP and PNG image decoders need GDISP_NEED_CONVERT. It has been turned on for you."
+		#endif
+		#undef GDISP_NEED_CONVERT
+		#define GDISP_NEED_CONVERT	TRUE
+	#endif
 	#if (defined(GDISP_INCLUDE_FONT_SMALL) && GDISP_INCLUDE_FONT_SMALL) || (defined(GDISP_INCLUDE_FONT_LARGER) && GDISP_INCLUDE_FONT_LARGER)
 		#if GFX_DISPLAY_RULE_WARNINGS
 			#warning "GDISP: An old font (Small or Larger) has been defined. A single default font of DEJAVUSANS12 has been added instead."
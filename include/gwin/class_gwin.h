@@ -35,7 +35,8 @@
 #define GWIN_FLG_WIDGET					0x0020			// @< This is a widget
 #define GWIN_FLG_ALLOCTXT				0x0040			// @< The widget text is allocated
 #define GWIN_FLG_MOUSECAPTURE			0x0080			// @< The widget has captured the mouse
-#define GWIN_FIRST_WM_FLAG				0x0100			// @< 4 bits free for the window manager to use
+#define GWIN_FLG_NEEDREDRAW				0x0100			// @< The window is waiting to be redrawn (GWIN_REDRAW_DEFERRED)
+#define GWIN_FIRST_WM_FLAG				0x0200			// @< 3 bits free for the window manager to use
 #define GWIN_FIRST_CONTROL_FLAG			0x1000			// @< 4 bits free for Windows and Widgets to use
 /* @} */
 
@@ -47,7 +48,7 @@ typedef struct gwinVMT {
 	const char *		classname;						// @< The GWIN classname (mandatory)
 	size_t				size;							// @< The size of the class object
 	void (*Destroy)		(GWindowObject *gh);			// @< The GWIN destroy function (optional)
-	void (*Redraw)		(GWindowObject *gh);			// @< The GWIN redraw routine (optional)
+	void (*Redraw)		(GWindowObject *gh);			// @< The GWIN redraw routine (optional). The clip area is already set.
 	void (*AfterClear)	(GWindowObject *gh);			// @< The GWIN after-clear function (optional)
 } gwinVMT;
 /* @} */
@@ -92,7 +93,7 @@ typedef struct gwinVMT {
 				void (*ToggleOn)		(GWidgetObject *gw, uint16_t role);						// @< Process toggle on events (optional)
 			};
 		#endif
-		#if GINPUT_NEED_TOGGLE
+		#if GINPUT_NEED_DIAL
 			struct {
 				uint16_t				dialroles;												// @< The roles supported for dials (0->dialroles-1)
 				void (*DialAssign)		(GWidgetObject *gw, uint16_t role, uint16_t instance);	// @< Test the role and save the dial instance handle (optional)
@@ -129,6 +130,7 @@ typedef struct gwinVMT {
 		void (*Redim)		(GHandle gh, coord_t x, coord_t y, coord_t w, coord_t h);	// @< A window wants to be moved or resized
 		void (*Raise)		(GHandle gh);							// @< A window wants to be on top
 		void (*MinMax)		(GHandle gh, GWindowMinMax minmax);		// @< A window wants to be minimized/maximised
+		void (*Redraw)		(GHandle gh);							// @< A visible window needs redrawing (only the parts not covered by other windows)
 	} gwmVMT;
 	/* @} */
 
@@ -161,6 +163,32 @@ extern "C" {
  */
 GHandle _gwindowCreate(GWindowObject *pgw, const GWindowInit *pInit, const gwinVMT *vmt, uint16_t flags);
 
+/**
+ * @brief	Redraw a window now if it is visible
+ *
+ * @param[in]	gh		The window to redraw
+ *
+ * @note	With a window manager only the parts of the window that are not covered
+ * 			by other windows are drawn. Use this rather than calling the window's
+ * 			redraw routine directly.
+ *
+ * @notapi
+ */
+void _gwinDraw(GHandle gh);
+
+/**
+ * @brief	Redraw a window if it is visible because its state has changed
+ *
+ * @param[in]	gh		The window to redraw
+ *
+ * @note	This is the same as @p _gwinDraw() except that with GWIN_REDRAW_DEFERRED the
+ * 			window is only marked. It is drawn by the next @p gwinRedrawDisplay().
+ * 			A window without a redraw routine is always cleared immediately.
+ *
+ * @notapi
+ */
+void _gwinUpdate(GHandle gh);
+
 #if GWIN_NEED_WIDGET || defined(__DOXYGEN__)
 	/**
 	 * @brief	Initialise (and allocate if necessary) the base Widget object
@@ -189,11 +217,25 @@ GHandle _gwindowCreate(GWindowObject *pgw, const GWindowInit *pInit, const gwinV
 	 *
 	 * @param[in]	gh		The widget to redraw
 	 *
+	 * @note	This is the widget redraw routine for the VMT. The caller must have set the clip area.
+	 * 			To redraw a widget after its state has changed use @p _gwinUpdate().
+	 *
 	 * @notapi
 	 */
 	void _gwidgetRedraw(GHandle gh);
 #endif
 
+#if (GWIN_NEED_WIDGET && GWIN_WIDGET_HITGRID && GFX_USE_GINPUT && GINPUT_NEED_MOUSE) || defined(__DOXYGEN__)
+	/**
+	 * @brief	Tell the widget mouse handling that the position, size, visibility or z-order of a window has changed
+	 *
+	 * @notapi
+	 */
+	void _gwidgetHitGridInvalidate(void);
+#else
+	#define _gwidgetHitGridInvalidate()
+#endif
+
 #ifdef __cplusplus
 }
 #endif
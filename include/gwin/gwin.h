@@ -95,6 +95,19 @@ extern "C" {
 	 * @api
 	 */
 	void gwinSetWindowManager(struct GWindowManager *gwm);
+
+	/**
+	 * @brief   Redraw all the windows that are waiting to be redrawn.
+	 *
+	 * @note				With GWIN_REDRAW_DEFERRED, changing a window or widget just marks it as needing
+	 * 						a redraw. The marked windows are then drawn together (in z-order) every
+	 * 						GWIN_REDRAW_PERIOD milliseconds or when this is called. Many changes to
+	 * 						a window between redraws only cause it to be drawn once.
+	 * @note				Without GWIN_REDRAW_DEFERRED windows are drawn as they change and this does nothing.
+	 *
+	 * @api
+	 */
+	void gwinRedrawDisplay(void);
 #endif
 
 /*-------------------------------------------------
@@ -32,6 +32,9 @@
 // An label window
 typedef struct GLabelObject {
 	GWidgetObject	w;
+	#if GDISP_NEED_TEXT_LAYOUT
+		GTextLayout	layout;			// The text as it was last drawn
+	#endif
 } GLabelObject;
 
 #ifdef __cplusplus
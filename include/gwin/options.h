@@ -132,6 +132,45 @@
 	#ifndef GWIN_NEED_IMAGE_ANIMATION
 		#define GWIN_NEED_IMAGE_ANIMATION		FALSE
 	#endif
+	/**
+	 * @brief   Find the widget under the mouse using a grid of screen cells
+	 * @details	Defaults to FALSE
+	 * @note	Each cell lists the visible windows that overlap it so a mouse down only
+	 * 			checks the windows in one cell rather than every window.
+	 * @note	The grid is allocated with gfxAlloc() and is rebuilt on the next mouse down after
+	 * 			a window is created, moved, resized, shown, hidden, raised or destroyed.
+	 */
+	#ifndef GWIN_WIDGET_HITGRID
+		#define GWIN_WIDGET_HITGRID				FALSE
+	#endif
+	/**
+	 * @brief   The size (in pixels) of a cell in the @p GWIN_WIDGET_HITGRID grid
+	 * @details	Defaults to 32
+	 */
+	#ifndef GWIN_WIDGET_HITGRID_CELL
+		#define GWIN_WIDGET_HITGRID_CELL		32
+	#endif
+	/**
+	 * @brief   Windows and widgets that change are marked for redrawing rather than being redrawn immediately
+	 * @details	Defaults to FALSE
+	 * @note	The marked windows are redrawn every @p GWIN_REDRAW_PERIOD milliseconds or
+	 * 			when @p gwinRedrawDisplay() is called. A window that changes many times
+	 * 			between redraws is only drawn once.
+	 * @note	Moving, resizing, hiding and destroying a window still repaint the screen immediately.
+	 * @note	This requires GWIN_NEED_WINDOWMANAGER.
+	 */
+	#ifndef GWIN_REDRAW_DEFERRED
+		#define GWIN_REDRAW_DEFERRED			FALSE
+	#endif
+	/**
+	 * @brief   How often (in milliseconds) the marked windows are redrawn when @p GWIN_REDRAW_DEFERRED is TRUE
+	 * @details	Defaults to 50 (20 times a second)
+	 * @note	The period starts when the first window is marked so a display with no changes uses no time.
+	 * @note	Set this to 0 to only redraw when your application calls @p gwinRedrawDisplay().
+	 */
+	#ifndef GWIN_REDRAW_PERIOD
+		#define GWIN_REDRAW_PERIOD				50
+	#endif
 /** @} */
 
 #endif /* _GWIN_OPTIONS_H */
@@ -0,0 +1,350 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * @file    src/gdisp/convert.c
+ * @brief   GDISP pixel format conversion.
+ *
+ * @addtogroup GDISP
+ * @{
+ */
+
+#include "gfx.h"
+
+#if GFX_USE_GDISP && GDISP_NEED_CONVERT
+
+#include <string.h>
+
+/*
+ * Conversions into the display pixel format from the common layouts have their own single pass
+ * kernels. Everything else goes through a small buffer of 0xRRGGBB values.
+ * The kernels are plain loops with a fixed stride and no data dependent branches so that
+ * the compiler can vectorise them (SSE2, NEON etc) where the target supports it.
+ */
+
+/**
+ * How many pixels to convert at a time through the 0xRRGGBB buffer
+ */
+#define CONVERT_CHUNK		32
+
+typedef uint32_t	rgb_t;		// 0x00RRGGBB
+
+/* Expand each format to 8 bits per channel - the top bits of each channel are repeated in the bottom bits */
+#define RGB_FROM_MONO(v)	((v) ? 0xFFFFFF : 0)
+#define RGB_FROM_565(v)		((((rgb_t)(v) & 0xF800) << 8) | (((rgb_t)(v) & 0xE000) << 3)	\
+							| (((rgb_t)(v) & 0x07E0) << 5) | (((rgb_t)(v) & 0x0600) >> 1)		\
+							| (((rgb_t)(v) & 0x001F) << 3) | (((rgb_t)(v) & 0x001C) >> 2))
+#define RGB_FROM_888(v)		((rgb_t)(v) & 0xFFFFFF)
+#define RGB_FROM_444(v)		((((rgb_t)(v) & 0x0F00) << 12) | (((rgb_t)(v) & 0x0F00) << 8)	\
+							| (((rgb_t)(v) & 0x00F0) << 8) | (((rgb_t)(v) & 0x00F0) << 4)		\
+							| (((rgb_t)(v) & 0x000F) << 4) | ((rgb_t)(v) & 0x000F))
+#define RGB_FROM_332(v)		((((rgb_t)(v) & 0xE0) << 16) | (((rgb_t)(v) & 0xE0) << 13) | (((rgb_t)(v) & 0xC0) << 10)	\
+							| (((rgb_t)(v) & 0x1C) << 11) | (((rgb_t)(v) & 0x1C) << 8) | (((rgb_t)(v) & 0x18) << 5)		\
+							| (((rgb_t)(v) & 0x03) * 0x55))
+#define RGB_FROM_666(v)		((((rgb_t)(v) & 0x03F000) << 6) | ((rgb_t)(v) & 0x030000)		\
+							| (((rgb_t)(v) & 0x000FC0) << 4) | (((rgb_t)(v) & 0x000C00) >> 2)	\
+							| (((rgb_t)(v) & 0x00003F) << 2) | (((rgb_t)(v) & 0x000030) >> 4))
+
+/* Reduce 8 bits per channel to each format - the same rounding as RGB2COLOR() */
+#define RGB_TO_MONO(v)		((v) & 0xFFFFFF ? 1 : 0)
+#define RGB_TO_565(v)		((uint16_t)((((v) >> 8) & 0xF800) | (((v) >> 5) & 0x07E0) | (((v) >> 3) & 0x001F)))
+#define RGB_TO_888(v)		((uint32_t)(v))
+#define RGB_TO_444(v)		((uint16_t)((((v) >> 12) & 0x0F00) | (((v) >> 8) & 0x00F0) | (((v) >> 4) & 0x000F)))
+#define RGB_TO_332(v)		((uint8_t)((((v) >> 16) & 0xE0) | (((v) >> 11) & 0x1C) | (((v) >> 6) & 0x03)))
+#define RGB_TO_666(v)		((uint32_t)((((v) >> 6) & 0x03F000) | (((v) >> 4) & 0x000FC0) | (((v) >> 2) & 0x00003F)))
+
+/* Convert a display color to 0xRRGGBB */
+#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_MONO
+	#define RGB_FROM_COLOR(c)	RGB_FROM_MONO(c)
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB565
+	#define RGB_FROM_COLOR(c)	RGB_FROM_565(c)
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+	#define RGB_FROM_COLOR(c)	RGB_FROM_888(c)
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB444
+	#define RGB_FROM_COLOR(c)	RGB_FROM_444(c)
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB332
+	#define RGB_FROM_COLOR(c)	RGB_FROM_332(c)
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB666
+	#define RGB_FROM_COLOR(c)	RGB_FROM_666(c)
+#else
+	#define RGB_FROM_COLOR(c)	((((rgb_t)RED_OF(c)) << 16) | (((rgb_t)GREEN_OF(c)) << 8) | ((rgb_t)BLUE_OF(c)))
+#endif
+
+/* Get bit x of a 1 bit per pixel row */
+#define MONO1_BIT(p, x)		((((const uint8_t *)(p))[(x) >> 3] >> (7 - ((x) & 7))) & 1)
+
+size_t gdispConvertSize(unsigned fmt, coord_t cnt) {
+	switch(fmt) {
+	case GDISP_PIXELFORMAT_MONO:
+	case GDISP_PIXELFORMAT_RGB332:
+	case GDISP_PIXELFORMAT_INDEX8:
+		return cnt;
+	case GDISP_PIXELFORMAT_RGB565:
+	case GDISP_PIXELFORMAT_RGB444:
+		return (size_t)cnt * 2;
+	case GDISP_PIXELFORMAT_RGB24:
+	case GDISP_PIXELFORMAT_BGR24:
+		return (size_t)cnt * 3;
+	case GDISP_PIXELFORMAT_RGB888:
+	case GDISP_PIXELFORMAT_RGB666:
+	case GDISP_PIXELFORMAT_RGBA8888:
+	case GDISP_PIXELFORMAT_BGRA8888:
+		return (size_t)cnt * 4;
+	case GDISP_PIXELFORMAT_MONO1:
+		return ((size_t)cnt + 7) / 8;
+	#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_CUSTOM
+		case GDISP_PIXELFORMAT:
+			return (size_t)cnt * sizeof(color_t);
+	#endif
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief	Convert straight into display colors.
+ * @return	FALSE if there is no kernel for the source format
+ *
+ * @notapi
+ */
+static bool_t convertToColor(color_t *d, const void *src, unsigned srcfmt, coord_t srcx, coord_t cnt, const color_t *palette) {
+	const uint8_t	*s;
+	coord_t			i;
+
+	s = (const uint8_t *)src;
+	switch(srcfmt) {
+	case GDISP_PIXELFORMAT:
+		memmove(d, (const color_t *)src + srcx, (size_t)cnt * sizeof(color_t));
+		return TRUE;
+	case GDISP_PIXELFORMAT_INDEX8:
+		for(s += srcx, i = 0; i < cnt; i++)
+			d[i] = palette[s[i]];
+		return TRUE;
+	case GDISP_PIXELFORMAT_MONO1:
+		for(i = 0; i < cnt; i++)
+			d[i] = palette[MONO1_BIT(s, srcx+i)];
+		return TRUE;
+	case GDISP_PIXELFORMAT_RGB24:
+		for(s += srcx*3, i = 0; i < cnt; i++, s += 3)
+			d[i] = RGB2COLOR(s[0], s[1], s[2]);
+		return TRUE;
+	case GDISP_PIXELFORMAT_BGR24:
+		for(s += srcx*3, i = 0; i < cnt; i++, s += 3)
+			d[i] = RGB2COLOR(s[2], s[1], s[0]);
+		return TRUE;
+	case GDISP_PIXELFORMAT_RGBA8888:
+		for(s += srcx*4, i = 0; i < cnt; i++, s += 4)
+			d[i] = RGB2COLOR(s[0], s[1], s[2]);
+		return TRUE;
+	case GDISP_PIXELFORMAT_BGRA8888:
+		for(s += srcx*4, i = 0; i < cnt; i++, s += 4)
+			d[i] = RGB2COLOR(s[2], s[1], s[0]);
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+/* Read source pixels as 0xRRGGBB */
+static void convertRead(rgb_t *d, const void *src, unsigned srcfmt, coord_t srcx, coord_t cnt, const color_t *palette) {
+	const uint8_t	*s;
+	coord_t			i;
+
+	s = (const uint8_t *)src;
+	switch(srcfmt) {
+	case GDISP_PIXELFORMAT_MONO:
+		for(s += srcx, i = 0; i < cnt; i++)
+			d[i] = RGB_FROM_MONO(s[i]);
+		break;
+	case GDISP_PIXELFORMAT_RGB565:
+		{
+			const uint16_t *p = (const uint16_t *)src + srcx;
+			for(i = 0; i < cnt; i++)
+				d[i] = RGB_FROM_565(p[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB888:
+		{
+			const uint32_t *p = (const uint32_t *)src + srcx;
+			for(i = 0; i < cnt; i++)
+				d[i] = RGB_FROM_888(p[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB444:
+		{
+			const uint16_t *p = (const uint16_t *)src + srcx;
+			for(i = 0; i < cnt; i++)
+				d[i] = RGB_FROM_444(p[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB332:
+		for(s += srcx, i = 0; i < cnt; i++)
+			d[i] = RGB_FROM_332(s[i]);
+		break;
+	case GDISP_PIXELFORMAT_RGB666:
+		{
+			const uint32_t *p = (const uint32_t *)src + srcx;
+			for(i = 0; i < cnt; i++)
+				d[i] = RGB_FROM_666(p[i]);
+		}
+		break;
+	#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_CUSTOM
+		case GDISP_PIXELFORMAT:
+			{
+				const color_t *p = (const color_t *)src + srcx;
+				for(i = 0; i < cnt; i++)
+					d[i] = RGB_FROM_COLOR(p[i]);
+			}
+			break;
+	#endif
+	case GDISP_PIXELFORMAT_INDEX8:
+		for(s += srcx, i = 0; i < cnt; i++)
+			d[i] = RGB_FROM_COLOR(palette[s[i]]);
+		break;
+	case GDISP_PIXELFORMAT_MONO1:
+		for(i = 0; i < cnt; i++)
+			d[i] = RGB_FROM_COLOR(palette[MONO1_BIT(s, srcx+i)]);
+		break;
+	case GDISP_PIXELFORMAT_RGB24:
+		for(s += srcx*3, i = 0; i < cnt; i++, s += 3)
+			d[i] = ((rgb_t)s[0] << 16) | ((rgb_t)s[1] << 8) | s[2];
+		break;
+	case GDISP_PIXELFORMAT_BGR24:
+		for(s += srcx*3, i = 0; i < cnt; i++, s += 3)
+			d[i] = ((rgb_t)s[2] << 16) | ((rgb_t)s[1] << 8) | s[0];
+		break;
+	case GDISP_PIXELFORMAT_RGBA8888:
+		for(s += srcx*4, i = 0; i < cnt; i++, s += 4)
+			d[i] = ((rgb_t)s[0] << 16) | ((rgb_t)s[1] << 8) | s[2];
+		break;
+	case GDISP_PIXELFORMAT_BGRA8888:
+		for(s += srcx*4, i = 0; i < cnt; i++, s += 4)
+			d[i] = ((rgb_t)s[2] << 16) | ((rgb_t)s[1] << 8) | s[0];
+		break;
+	}
+}
+
+/* Write 0xRRGGBB pixels in the destination format */
+static void convertWrite(void *dst, unsigned dstfmt, coord_t dstx, const rgb_t *s, coord_t cnt) {
+	uint8_t		*d;
+	coord_t		i;
+
+	d = (uint8_t *)dst;
+	switch(dstfmt) {
+	case GDISP_PIXELFORMAT_MONO:
+		for(d += dstx, i = 0; i < cnt; i++)
+			d[i] = RGB_TO_MONO(s[i]);
+		break;
+	case GDISP_PIXELFORMAT_RGB565:
+		{
+			uint16_t *p = (uint16_t *)dst + dstx;
+			for(i = 0; i < cnt; i++)
+				p[i] = RGB_TO_565(s[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB888:
+		{
+			uint32_t *p = (uint32_t *)dst + dstx;
+			for(i = 0; i < cnt; i++)
+				p[i] = RGB_TO_888(s[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB444:
+		{
+			uint16_t *p = (uint16_t *)dst + dstx;
+			for(i = 0; i < cnt; i++)
+				p[i] = RGB_TO_444(s[i]);
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB332:
+		for(d += dstx, i = 0; i < cnt; i++)
+			d[i] = RGB_TO_332(s[i]);
+		break;
+	case GDISP_PIXELFORMAT_RGB666:
+		{
+			uint32_t *p = (uint32_t *)dst + dstx;
+			for(i = 0; i < cnt; i++)
+				p[i] = RGB_TO_666(s[i]);
+		}
+		break;
+	#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_CUSTOM
+		case GDISP_PIXELFORMAT:
+			{
+				color_t *p = (color_t *)dst + dstx;
+				for(i = 0; i < cnt; i++)
+					p[i] = RGB2COLOR(s[i] >> 16, (s[i] >> 8) & 0xFF, s[i] & 0xFF);
+			}
+			break;
+	#endif
+	case GDISP_PIXELFORMAT_MONO1:
+		for(i = 0; i < cnt; i++, dstx++) {
+			if (s[i] & 0xFFFFFF)
+				d[dstx >> 3] |= 0x80 >> (dstx & 7);
+			else
+				d[dstx >> 3] &= ~(0x80 >> (dstx & 7));
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGB24:
+		for(d += dstx*3, i = 0; i < cnt; i++, d += 3) {
+			d[0] = s[i] >> 16; d[1] = s[i] >> 8; d[2] = s[i];
+		}
+		break;
+	case GDISP_PIXELFORMAT_BGR24:
+		for(d += dstx*3, i = 0; i < cnt; i++, d += 3) {
+			d[0] = s[i]; d[1] = s[i] >> 8; d[2] = s[i] >> 16;
+		}
+		break;
+	case GDISP_PIXELFORMAT_RGBA8888:
+		for(d += dstx*4, i = 0; i < cnt; i++, d += 4) {
+			d[0] = s[i] >> 16; d[1] = s[i] >> 8; d[2] = s[i]; d[3] = 0xFF;
+		}
+		break;
+	case GDISP_PIXELFORMAT_BGRA8888:
+		for(d += dstx*4, i = 0; i < cnt; i++, d += 4) {
+			d[0] = s[i]; d[1] = s[i] >> 8; d[2] = s[i] >> 16; d[3] = 0xFF;
+		}
+		break;
+	}
+}
+
+bool_t gdispConvertPixelsEx(void *dst, unsigned dstfmt, const void *src, unsigned srcfmt, coord_t srcx, coord_t cnt, const color_t *palette) {
+	static const color_t	blackwhite[2] = { Black, White };
+	rgb_t					buf[CONVERT_CHUNK];
+	coord_t					dstx, n;
+
+	/* Check the formats */
+	if (!gdispConvertSize(srcfmt, 1) || !gdispConvertSize(dstfmt, 1) || dstfmt == GDISP_PIXELFORMAT_INDEX8)
+		return FALSE;
+	if (!palette) {
+		if (srcfmt == GDISP_PIXELFORMAT_INDEX8)
+			return FALSE;
+		palette = blackwhite;
+	}
+	if (cnt <= 0)
+		return TRUE;
+
+	/* The common conversions go straight to display colors */
+	if (dstfmt == GDISP_PIXELFORMAT && convertToColor((color_t *)dst, src, srcfmt, srcx, cnt, palette))
+		return TRUE;
+
+	/* Same format - just copy */
+	if (srcfmt == dstfmt && srcfmt != GDISP_PIXELFORMAT_MONO1) {
+		memmove(dst, (const uint8_t *)src + gdispConvertSize(srcfmt, srcx), gdispConvertSize(srcfmt, cnt));
+		return TRUE;
+	}
+
+	/* Everything else goes via 0xRRGGBB */
+	for(dstx = 0; cnt > 0; cnt -= n, srcx += n, dstx += n) {
+		n = cnt > CONVERT_CHUNK ? CONVERT_CHUNK : cnt;
+		convertRead(buf, src, srcfmt, srcx, n, palette);
+		convertWrite(dst, dstfmt, dstx, buf, n);
+	}
+	return TRUE;
+}
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_CONVERT */
+/** @} */
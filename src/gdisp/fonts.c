@@ -68,7 +68,16 @@ font_t gdispOpenFont(const char *name) {
 	return mf_get_font_list()->font;
 }
 
+#if GDISP_NEED_TEXT_CACHE
+	extern void _gdispTextCacheFlush(font_t font);
+#endif
+
 void gdispCloseFont(font_t font) {
+	#if GDISP_NEED_TEXT_CACHE
+		/* Cached glyphs must not outlive the font */
+		_gdispTextCacheFlush(font);
+	#endif
+
 	if (font->flags & FONT_FLAG_DYNAMIC)
 	{
 		struct mf_font_s *dfont = (struct mf_font_s *)font;
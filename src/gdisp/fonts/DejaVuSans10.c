@@ -149,6 +149,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSans10 = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_DejaVuSans10_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -158,6 +158,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSans12 = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_DejaVuSans12_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
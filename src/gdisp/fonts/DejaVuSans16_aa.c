@@ -286,6 +286,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans16_aa = {
     139, /* total dict count */
     1, /* char range count */
     mf_rlefont_DejaVuSans16_aa_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -220,6 +220,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans24 = {
     118, /* total dict count */
     1, /* char range count */
     mf_rlefont_DejaVuSans24_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
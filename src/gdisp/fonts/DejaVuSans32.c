@@ -274,6 +274,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans32 = {
     140, /* total dict count */
     1, /* char range count */
     mf_rlefont_DejaVuSans32_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
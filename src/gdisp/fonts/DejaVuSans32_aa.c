@@ -552,6 +552,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans32_aa = {
     187, /* total dict count */
     1, /* char range count */
     mf_rlefont_DejaVuSans32_aa_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
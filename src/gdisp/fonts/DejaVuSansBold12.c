@@ -169,6 +169,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSansBold12 = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_DejaVuSansBold12_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -240,6 +240,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSansBold12_aa = {
     114, /* total dict count */
     1, /* char range count */
     mf_rlefont_DejaVuSansBold12_aa_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
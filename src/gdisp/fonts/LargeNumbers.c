@@ -110,6 +110,7 @@ const struct mf_rlefont_s mf_rlefont_LargeNumbers = {
     54, /* total dict count */
     1, /* char range count */
     mf_rlefont_LargeNumbers_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
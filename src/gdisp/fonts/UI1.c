@@ -240,6 +240,7 @@ const struct mf_rlefont_s mf_rlefont_UI1 = {
     107, /* total dict count */
     3, /* char range count */
     mf_rlefont_UI1_char_ranges,
+    0, /* char lookup */
 };
 
 #ifndef MF_SCALEDFONT_INTERNALS
@@ -147,6 +147,7 @@ const struct mf_rlefont_s mf_rlefont_UI2 = {
     61, /* total dict count */
     1, /* char range count */
     mf_rlefont_UI2_char_ranges,
+    0, /* char lookup */
 };
 
 #ifndef MF_SCALEDFONT_INTERNALS
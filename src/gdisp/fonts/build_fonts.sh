@@ -2,7 +2,7 @@
 
 set -x -e
 
-# Path to the mcufont encoder program
+# Path to the mcufont encoder program (build it from tools/mcufont/src)
 MCUFONT=mcufont
 
 # Character ranges to include in the fonts.
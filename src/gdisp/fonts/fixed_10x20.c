@@ -210,6 +210,7 @@ const struct mf_bwfont_s mf_bwfont_fixed_10x20 = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_fixed_10x20_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -132,6 +132,7 @@ const struct mf_bwfont_s mf_bwfont_fixed_7x14 = {
     4, /* version */
     1, /* char range count */
     mf_bwfont_fixed_7x14_char_ranges,
+    0, /* char lookup */
 };
 
 #ifdef MF_INCLUDED_FONTS
@@ -19,75 +19,673 @@
 /* Include the low level driver information */
 #include "gdisp/lld/gdisp_lld.h"
 
+#if GDISP_NEED_LIST || GDISP_NEED_ASYNC || (GDISP_NEED_TEXT && GDISP_NEED_TEXT_CACHE)
+	#include <string.h>
+#endif
+
 /*===========================================================================*/
 /* Driver local variables.                                                   */
 /*===========================================================================*/
 
+/* Do we need synchronous API functions rather than macros calling the low level driver directly */
+#define GDISP_NEED_SYNCAPI		(GDISP_NEED_MULTITHREAD || ((GDISP_NEED_AUTOFLUSH || GDISP_NEED_LIST) && !GDISP_NEED_ASYNC))
+
 #if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC
 	static gfxMutex			gdispMutex;
+	#define MUTEX_ENTER()	gfxMutexEnter(&gdispMutex)
+	#define MUTEX_EXIT()	gfxMutexExit(&gdispMutex)
+#else
+	#define MUTEX_ENTER()
+	#define MUTEX_EXIT()
+#endif
+
+#if GDISP_NEED_AUTOFLUSH
+	typedef struct dirtyRect {
+		coord_t		x0, y0, x1, y1;		// x1, y1 are exclusive
+	} dirtyRect;
+
+	static dirtyRect		dirtyList[GDISP_AUTOFLUSH_RECTS];
+	static unsigned			dirtyCnt;
+	#if GDISP_AUTOFLUSH_PERIOD
+		static GTimer		flushTimer;
+	#endif
+
+	#define AUTOFLUSH_MARK(x, y, cx, cy)	autoflushMark(x, y, cx, cy)
+	#define AUTOFLUSH_MARKLINE(x0, y0, x1, y1)	\
+				autoflushMark(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, (x0 < x1 ? x1-x0 : x0-x1)+1, (y0 < y1 ? y1-y0 : y0-y1)+1)
+	#define AUTOFLUSH_MARKSCREEN()			autoflushMarkScreen()
+	#define AUTOFLUSH_CONTROL(what)			{ if ((what) == GDISP_CONTROL_ORIENTATION) autoflushFlush(); }
+	#if GDISP_AUTOFLUSH_PERIOD
+		#define AUTOFLUSH_START()			{ gtimerInit(&flushTimer); gtimerStart(&flushTimer, autoflushTimer, 0, TRUE, GDISP_AUTOFLUSH_PERIOD); }
+	#else
+		#define AUTOFLUSH_START()
+	#endif
+#else
+	#define AUTOFLUSH_MARK(x, y, cx, cy)
+	#define AUTOFLUSH_MARKLINE(x0, y0, x1, y1)
+	#define AUTOFLUSH_MARKSCREEN()
+	#define AUTOFLUSH_CONTROL(what)
+	#define AUTOFLUSH_START()
 #endif
 
 #if GDISP_NEED_ASYNC
-	#define GDISP_THREAD_STACK_SIZE	256		/* Just a number - not yet a reflection of actual use */
-	#define GDISP_QUEUE_SIZE		8		/* We only allow a short queue */
+	#if GDISP_ASYNC_RING_SIZE < 128
+		#error "GDISP: GDISP_ASYNC_RING_SIZE must be at least 128 bytes"
+	#endif
+
+	/**
+	 * The command ring.
+	 *	Each record is a header unit followed by its payload. Records never wrap - if there is
+	 *	not enough room before the end of the ring the remainder is filled with a skip record.
+	 *	Producers only hold the system lock while reserving and posting a record so they never
+	 *	wait for each other while filling in their payloads. The GDISP thread drains all posted
+	 *	records in order while holding the gdisp mutex once.
+	 */
+	typedef union ringUnit {
+		struct {
+			uint16_t			size;		// Size of the record in ring units (including this header)
+			volatile uint8_t	state;		// RING_BUSY, RING_READY or RING_SKIP
+			uint8_t				type;		// RING_MSG, RING_TEXT or RING_SYNC
+		} hdr;
+		void *		p;						// Force alignment for any payload
+		uint32_t	u;
+	} ringUnit;
+
+	#define RING_UNITS			(GDISP_ASYNC_RING_SIZE / sizeof(ringUnit))
+	#define RING_MAXPAYLOAD		((RING_UNITS/2 - 1) * sizeof(ringUnit))		// The biggest payload we will queue
+
+	#define RING_BUSY			0			// Reserved but the producer is still filling it in
+	#define RING_READY			1			// Posted
+	#define RING_SKIP			2			// Padding at the end of the ring
+
+	#define RING_MSG			0			// A gdisp_lld_msg_t plus any inline blit pixels
+	#define RING_TEXT			1			// A ringText plus the string
+	#define RING_SYNC			2			// A semaphore to signal when the record is reached
+
+	#if GDISP_NEED_TEXT
+		#define TEXT_CHAR			0
+		#define TEXT_STRING			1
+		#define TEXT_STRINGBOX		2
+		#define TEXT_FILL			0x80
+
+		typedef struct ringText {
+			font_t		font;
+			coord_t		x, y;
+			coord_t		cx, cy;
+			color_t		color, bgcolor;
+			uint16_t	c;						// The character for TEXT_CHAR
+			uint8_t		mode;					// TEXT_CHAR, TEXT_STRING or TEXT_STRINGBOX optionally with TEXT_FILL
+			uint8_t		justify;
+			// The string follows
+		} ringText;
+
+		static void textRenderRing(const ringText *pt);
+	#endif
 
-	static gfxQueue 		gdispQueue;
-	static gfxMutex			gdispMsgsMutex;
-	static gfxSem			gdispMsgsSem;
-	static gdisp_lld_msg_t	gdispMsgs[GDISP_QUEUE_SIZE];
+	static ringUnit			gdispRing[RING_UNITS];
+	static unsigned			ringHead;				// Next unit to reserve
+	static unsigned			ringTail;				// Next unit to draw
+	static unsigned			ringUsed;				// Units in use (including skip records)
+	static unsigned			ringWaiters;			// Producers waiting for space
+	static bool_t			ringSleeping;			// The GDISP thread is waiting for a record
+	static gfxSem			ringSpaceSem;
+	static gfxSem			ringDataSem;
 	static 					DECLARE_THREAD_STACK(waGDISPThread, GDISP_THREAD_STACK_SIZE);
 #endif
 
+#if GDISP_NEED_LIST
+	static GDisplayList *	listCur;			// The display list currently being recorded
+	static coord_t			listClip[4];		// The last clip recorded into the list (x, y, cx, cy)
+	#if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC
+		static gfxThreadHandle	listThread;		// The thread doing the recording
+		#define LIST_RECORDING()	(listCur && listThread == gfxThreadMe())
+	#else
+		#define LIST_RECORDING()	(listCur != 0)
+	#endif
+
+	/* The recorded operations */
+	#define LIST_OP_CLEAR			0
+	#define LIST_OP_DRAWPIXEL		1
+	#define LIST_OP_DRAWLINE		2
+	#define LIST_OP_FILLAREA		3
+	#define LIST_OP_BLITAREA		4
+	#define LIST_OP_SETCLIP			5
+	#define LIST_OP_DRAWCIRCLE		6
+	#define LIST_OP_FILLCIRCLE		7
+	#define LIST_OP_DRAWELLIPSE		8
+	#define LIST_OP_FILLELLIPSE		9
+	#define LIST_OP_DRAWARC			10
+	#define LIST_OP_FILLARC			11
+	#define LIST_OP_VERTICALSCROLL	12
+	#define LIST_OP_FILLAREAALPHA	13		// The alpha is recorded as the last coordinate
+	#define LIST_OP_BLITAREAALPHA	14		// The alpha is recorded as the last coordinate
+	#define LIST_OP_DRAWLINEAA		15
+	#define LIST_OP_DRAWCIRCLEAA	16
+	#define LIST_OP_MAX				17
+
+	/* The number of coordinates recorded for each operation */
+	static const uint8_t	listCoords[LIST_OP_MAX] = { 0, 2, 4, 4, 7, 4, 3, 3, 4, 4, 5, 5, 5, 5, 8, 4, 3 };
+
+	/* Does the operation record a blit source rather than a color */
+	#define listIsBlit(op)	((op) == LIST_OP_BLITAREA || (op) == LIST_OP_BLITAREAALPHA)
+
+	/* The size of a record - the operation, the coordinates and then either a color or a blit source */
+	#define listSize(op)	(1 + listCoords[op]*sizeof(coord_t) + (listIsBlit(op) ? sizeof(const pixel_t *) : ((op) == LIST_OP_SETCLIP ? 0 : sizeof(color_t))))
+
+	typedef struct listArgs {
+		coord_t			c[8];
+		color_t			color;
+		const pixel_t *	buffer;
+	} listArgs;
+
+	/* If we are recording, record the operation instead of drawing it */
+	#define LIST_RECORD(fn)			{ if (LIST_RECORDING()) { fn; return; } }
+#else
+	#define LIST_RECORD(fn)
+#endif
+
+#if GDISP_NEED_TEXT && GDISP_NEED_TEXT_CACHE && (GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC)
+	/* The glyph cache has its own lock as it is never held while drawing */
+	static gfxMutex			tcacheMutex;
+	#define TCACHE_INIT()	gfxMutexInit(&tcacheMutex)
+	#define TCACHE_LOCK()	gfxMutexEnter(&tcacheMutex)
+	#define TCACHE_UNLOCK()	gfxMutexExit(&tcacheMutex)
+#else
+	#define TCACHE_INIT()
+	#define TCACHE_LOCK()
+	#define TCACHE_UNLOCK()
+#endif
+
+#if GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_SHARED_CACHE && (GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC)
+	/* The shared image cache lives in image.c but needs its lock created here */
+	extern void _gdispImageCacheInit(void);
+	#define ICACHE_INIT()	_gdispImageCacheInit()
+#else
+	#define ICACHE_INIT()
+#endif
+
 /*===========================================================================*/
 /* Driver local functions.                                                   */
 /*===========================================================================*/
 
-#if GDISP_NEED_ASYNC
-	static DECLARE_THREAD_FUNCTION(GDISPThreadHandler, arg) {
-		(void)arg;
-		gdisp_lld_msg_t	*pmsg;
+#if GDISP_NEED_AUTOFLUSH
+	/**
+	 * @brief   Send all the dirty rectangles to the display.
+	 * @pre		The gdisp mutex must be held (if there is one).
+	 *
+	 * @notapi
+	 */
+	static void autoflushFlush(void) {
+		dirtyRect	*p;
+
+		for(p = dirtyList; p < &dirtyList[dirtyCnt]; p++)
+			gdisp_lld_flush(p->x0, p->y0, p->x1 - p->x0, p->y1 - p->y0);
+		dirtyCnt = 0;
+	}
+
+	/**
+	 * @brief   Add an area to the dirty rectangle list.
+	 * @details	The area is clipped and then merged with any rectangle it overlaps
+	 * 			or touches. If the list is full it is merged with the rectangle
+	 * 			that grows the least.
+	 * @pre		The gdisp mutex must be held (if there is one).
+	 *
+	 * @notapi
+	 */
+	static void autoflushMark(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		dirtyRect	r, *p, *best;
+		int32_t		growth, bestgrowth;
+
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			if (x < GDISP.clipx0) { cx -= GDISP.clipx0 - x; x = GDISP.clipx0; }
+			if (y < GDISP.clipy0) { cy -= GDISP.clipy0 - y; y = GDISP.clipy0; }
+			if (x+cx > GDISP.clipx1)	cx = GDISP.clipx1 - x;
+			if (y+cy > GDISP.clipy1)	cy = GDISP.clipy1 - y;
+		#endif
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		r.x0 = x;
+		r.y0 = y;
+		r.x1 = x + cx;
+		r.y1 = y + cy;
 
 		while(1) {
-			/* Wait for msg with work to do. */
-			pmsg = (gdisp_lld_msg_t *)gfxQueueGet(&gdispQueue, TIME_INFINITE);
+			/* Absorb anything we overlap or touch. Growing may cause new overlaps so start again after each merge. */
+			for(p = dirtyList; p < &dirtyList[dirtyCnt]; p++) {
+				if (r.x0 <= p->x1 && r.x1 >= p->x0 && r.y0 <= p->y1 && r.y1 >= p->y0)
+					break;
+			}
+			if (p == &dirtyList[dirtyCnt]) {
+				if (dirtyCnt < GDISP_AUTOFLUSH_RECTS)
+					break;
+
+				/* The list is full - find the cheapest rectangle to merge with */
+				best = dirtyList;
+				bestgrowth = 0x7FFFFFFF;
+				for(p = dirtyList; p < &dirtyList[dirtyCnt]; p++) {
+					growth = (int32_t)((r.x1 > p->x1 ? r.x1 : p->x1) - (r.x0 < p->x0 ? r.x0 : p->x0))
+								* ((r.y1 > p->y1 ? r.y1 : p->y1) - (r.y0 < p->y0 ? r.y0 : p->y0))
+							- (int32_t)(p->x1 - p->x0) * (p->y1 - p->y0);
+					if (growth < bestgrowth) {
+						bestgrowth = growth;
+						best = p;
+					}
+				}
+				p = best;
+			}
 
-			/* OK - we need to obtain the mutex in case a synchronous operation is occurring */
-			gfxMutexEnter(&gdispMutex);
+			/* Merge with p and remove it from the list */
+			if (p->x0 < r.x0)	r.x0 = p->x0;
+			if (p->y0 < r.y0)	r.y0 = p->y0;
+			if (p->x1 > r.x1)	r.x1 = p->x1;
+			if (p->y1 > r.y1)	r.y1 = p->y1;
+			*p = dirtyList[--dirtyCnt];
+		}
+		dirtyList[dirtyCnt++] = r;
+
+		#if GDISP_AUTOFLUSH_THRESHOLD
+		{
+			uint32_t	area;
+
+			for(area = 0, p = dirtyList; p < &dirtyList[dirtyCnt]; p++)
+				area += (uint32_t)(p->x1 - p->x0) * (p->y1 - p->y0);
+			if (area >= GDISP_AUTOFLUSH_THRESHOLD)
+				autoflushFlush();
+		}
+		#endif
+	}
 
-			gdisp_lld_msg_dispatch(pmsg);
+	/**
+	 * @brief   Mark the whole display as dirty (eg. after a clear).
+	 * @pre		The gdisp mutex must be held (if there is one).
+	 *
+	 * @notapi
+	 */
+	static void autoflushMarkScreen(void) {
+		dirtyList[0].x0 = 0;
+		dirtyList[0].y0 = 0;
+		dirtyList[0].x1 = GDISP.Width;
+		dirtyList[0].y1 = GDISP.Height;
+		dirtyCnt = 1;
+		#if GDISP_AUTOFLUSH_THRESHOLD
+			if ((uint32_t)GDISP.Width * GDISP.Height >= GDISP_AUTOFLUSH_THRESHOLD)
+				autoflushFlush();
+		#endif
+	}
+
+	#if GDISP_NEED_CONVEX_POLYGON || GDISP_NEED_ASYNC
+		/**
+		 * @brief   Add the bounding box of a list of spans to the dirty rectangle list.
+		 * @pre		The gdisp mutex must be held.
+		 *
+		 * @notapi
+		 */
+		static void autoflushSpans(const gdisp_lld_span_t *spans, unsigned cnt) {
+			coord_t		x0, y0, x1, y1;
+
+			if (!cnt)
+				return;
+			x0 = spans->x;
+			x1 = spans->x + spans->cx;
+			y0 = y1 = spans->y;
+			for(cnt--, spans++; cnt; cnt--, spans++) {
+				if (spans->x < x0)				x0 = spans->x;
+				if (spans->x + spans->cx > x1)	x1 = spans->x + spans->cx;
+				if (spans->y < y0)				y0 = spans->y;
+				if (spans->y > y1)				y1 = spans->y;
+			}
+			autoflushMark(x0, y0, x1 - x0, y1 - y0 + 1);
+		}
+	#endif
 
-			/* Mark the message as free */
-			pmsg->action = GDISP_LLD_MSG_NOP;
+	#if GDISP_AUTOFLUSH_PERIOD
+		static void autoflushTimer(void *param) {
+			(void) param;
 
-			gfxMutexExit(&gdispMutex);
+			MUTEX_ENTER();
+			autoflushFlush();
+			MUTEX_EXIT();
 		}
-		return 0;
+	#endif
+#endif
+
+#if GDISP_NEED_LIST
+	/**
+	 * @brief	Record a drawing operation into the display list being recorded.
+	 * @note	Each record is a one byte operation code followed by its coordinates,
+	 * 			its color (if it has one) and the source pointer for a blit.
+	 *
+	 * @param[in] op	The operation code
+	 * @param[in] pa	The operation parameters
+	 *
+	 * @notapi
+	 */
+	static void listRecord(uint8_t op, const listArgs *pa) {
+		GDisplayList *	pl;
+		uint8_t *		p;
+		size_t			len;
+
+		pl = listCur;
+		if (op == LIST_OP_SETCLIP)
+			memcpy(listClip, pa->c, sizeof(listClip));
+		if (pl->overflow)
+			return;
+		len = listSize(op);
+		if (pl->len + len > pl->size) {
+			pl->overflow = TRUE;
+			return;
+		}
+		p = pl->buf + pl->len;
+		*p++ = op;
+		memcpy(p, pa->c, listCoords[op]*sizeof(coord_t));
+		p += listCoords[op]*sizeof(coord_t);
+		if (listIsBlit(op))
+			memcpy(p, &pa->buffer, sizeof(pa->buffer));
+		else if (op != LIST_OP_SETCLIP)
+			memcpy(p, &pa->color, sizeof(pa->color));
+		pl->len += len;
 	}
 
-	static gdisp_lld_msg_t *gdispAllocMsg(gdisp_msgaction_t action) {
-		gdisp_lld_msg_t	*p;
+	static void listOp(uint8_t op, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
+		listArgs	a;
+
+		a.c[0] = x; a.c[1] = y;
+		a.c[2] = cx; a.c[3] = cy;
+		a.color = color;
+		listRecord(op, &a);
+	}
+
+	static void listBlitArea(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
+		listArgs	a;
+
+		a.c[0] = x; a.c[1] = y;
+		a.c[2] = cx; a.c[3] = cy;
+		a.c[4] = srcx; a.c[5] = srcy;
+		a.c[6] = srccx;
+		a.buffer = buffer;
+		listRecord(LIST_OP_BLITAREA, &a);
+	}
+
+	#if GDISP_NEED_ALPHA
+		static void listBlitAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha) {
+			listArgs	a;
+
+			a.c[0] = x; a.c[1] = y;
+			a.c[2] = cx; a.c[3] = cy;
+			a.c[4] = srcx; a.c[5] = srcy;
+			a.c[6] = srccx;
+			a.c[7] = alpha;
+			a.buffer = buffer;
+			listRecord(LIST_OP_BLITAREAALPHA, &a);
+		}
+	#endif
+
+	#if GDISP_NEED_ARC || GDISP_NEED_SCROLL || GDISP_NEED_ALPHA
+		static void listOp5(uint8_t op, coord_t x, coord_t y, coord_t c2, coord_t c3, coord_t c4, color_t color) {
+			listArgs	a;
+
+			a.c[0] = x; a.c[1] = y;
+			a.c[2] = c2; a.c[3] = c3;
+			a.c[4] = c4;
+			a.color = color;
+			listRecord(op, &a);
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_AUTOFLUSH && GDISP_NEED_ASYNC
+	/**
+	 * @brief   Add the area touched by a drawing message to the dirty rectangle list.
+	 * @pre		The gdisp mutex must be held.
+	 *
+	 * @notapi
+	 */
+	static void autoflushMsg(gdisp_lld_msg_t *pmsg) {
+		switch(pmsg->action) {
+		case GDISP_LLD_MSG_CLEAR:
+			autoflushMarkScreen();
+			break;
+		case GDISP_LLD_MSG_DRAWPIXEL:
+			autoflushMark(pmsg->drawpixel.x, pmsg->drawpixel.y, 1, 1);
+			break;
+		case GDISP_LLD_MSG_FILLAREA:
+			autoflushMark(pmsg->fillarea.x, pmsg->fillarea.y, pmsg->fillarea.cx, pmsg->fillarea.cy);
+			break;
+		case GDISP_LLD_MSG_BLITAREA:
+			autoflushMark(pmsg->blitarea.x, pmsg->blitarea.y, pmsg->blitarea.cx, pmsg->blitarea.cy);
+			break;
+		case GDISP_LLD_MSG_DRAWLINE:
+			AUTOFLUSH_MARKLINE(pmsg->drawline.x0, pmsg->drawline.y0, pmsg->drawline.x1, pmsg->drawline.y1);
+			break;
+		case GDISP_LLD_MSG_FILLSPANS:
+			autoflushSpans(pmsg->fillspans.spans, pmsg->fillspans.cnt);
+			break;
+		#if GDISP_NEED_ALPHA
+			case GDISP_LLD_MSG_FILLAREAALPHA:
+				autoflushMark(pmsg->fillareaalpha.x, pmsg->fillareaalpha.y, pmsg->fillareaalpha.cx, pmsg->fillareaalpha.cy);
+				break;
+			case GDISP_LLD_MSG_BLITAREAALPHA:
+				autoflushMark(pmsg->blitareaalpha.x, pmsg->blitareaalpha.y, pmsg->blitareaalpha.cx, pmsg->blitareaalpha.cy);
+				break;
+			case GDISP_LLD_MSG_DRAWLINEAA:
+				AUTOFLUSH_MARKLINE(pmsg->drawlineaa.x0, pmsg->drawlineaa.y0, pmsg->drawlineaa.x1, pmsg->drawlineaa.y1);
+				break;
+		#endif
+		#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+			case GDISP_LLD_MSG_DRAWCIRCLEAA:
+				autoflushMark(pmsg->drawcircleaa.x-pmsg->drawcircleaa.radius-1, pmsg->drawcircleaa.y-pmsg->drawcircleaa.radius-1, 2*pmsg->drawcircleaa.radius+3, 2*pmsg->drawcircleaa.radius+3);
+				break;
+		#endif
+		#if GDISP_NEED_CIRCLE
+			case GDISP_LLD_MSG_DRAWCIRCLE:
+				autoflushMark(pmsg->drawcircle.x-pmsg->drawcircle.radius, pmsg->drawcircle.y-pmsg->drawcircle.radius, 2*pmsg->drawcircle.radius+1, 2*pmsg->drawcircle.radius+1);
+				break;
+			case GDISP_LLD_MSG_FILLCIRCLE:
+				autoflushMark(pmsg->fillcircle.x-pmsg->fillcircle.radius, pmsg->fillcircle.y-pmsg->fillcircle.radius, 2*pmsg->fillcircle.radius+1, 2*pmsg->fillcircle.radius+1);
+				break;
+		#endif
+		#if GDISP_NEED_ELLIPSE
+			case GDISP_LLD_MSG_DRAWELLIPSE:
+				autoflushMark(pmsg->drawellipse.x-pmsg->drawellipse.a, pmsg->drawellipse.y-pmsg->drawellipse.b, 2*pmsg->drawellipse.a+1, 2*pmsg->drawellipse.b+1);
+				break;
+			case GDISP_LLD_MSG_FILLELLIPSE:
+				autoflushMark(pmsg->fillellipse.x-pmsg->fillellipse.a, pmsg->fillellipse.y-pmsg->fillellipse.b, 2*pmsg->fillellipse.a+1, 2*pmsg->fillellipse.b+1);
+				break;
+		#endif
+		#if GDISP_NEED_ARC
+			case GDISP_LLD_MSG_DRAWARC:
+				autoflushMark(pmsg->drawarc.x-pmsg->drawarc.radius, pmsg->drawarc.y-pmsg->drawarc.radius, 2*pmsg->drawarc.radius+1, 2*pmsg->drawarc.radius+1);
+				break;
+			case GDISP_LLD_MSG_FILLARC:
+				autoflushMark(pmsg->fillarc.x-pmsg->fillarc.radius, pmsg->fillarc.y-pmsg->fillarc.radius, 2*pmsg->fillarc.radius+1, 2*pmsg->fillarc.radius+1);
+				break;
+		#endif
+		#if GDISP_NEED_SCROLL
+			case GDISP_LLD_MSG_VERTICALSCROLL:
+				autoflushMark(pmsg->verticalscroll.x, pmsg->verticalscroll.y, pmsg->verticalscroll.cx, pmsg->verticalscroll.cy);
+				break;
+		#endif
+		default:
+			break;
+		}
+	}
+#endif
+
+#if GDISP_NEED_ASYNC
+	/**
+	 * @brief   Execute one record from the command ring.
+	 * @pre		The gdisp mutex must be held.
+	 *
+	 * @notapi
+	 */
+	static void ringExecute(ringUnit *pu) {
+		gdisp_lld_msg_t	*pmsg;
+
+		switch(pu->hdr.type) {
+		case RING_MSG:
+			pmsg = (gdisp_lld_msg_t *)(pu+1);
+			#if GDISP_NEED_AUTOFLUSH
+				/* A flush request sends everything that has changed rather than a specific area */
+				if (pmsg->action == GDISP_LLD_MSG_FLUSH)
+					autoflushFlush();
+				else {
+					#if GDISP_NEED_CONTROL
+						if (pmsg->action == GDISP_LLD_MSG_CONTROL)
+							AUTOFLUSH_CONTROL(pmsg->control.what);
+					#endif
+					gdisp_lld_msg_dispatch(pmsg);
+					autoflushMsg(pmsg);
+				}
+			#else
+				gdisp_lld_msg_dispatch(pmsg);
+			#endif
+			break;
+		#if GDISP_NEED_TEXT
+			case RING_TEXT:
+				textRenderRing((const ringText *)(pu+1));
+				break;
+		#endif
+		case RING_SYNC:
+			gfxSemSignal(*(gfxSem **)(pu+1));
+			break;
+		}
+	}
 
-		while(1) {		/* To be sure, to be sure */
+	static DECLARE_THREAD_FUNCTION(GDISPThreadHandler, arg) {
+		(void)arg;
+		ringUnit	*pu;
+		unsigned	waiters;
+		bool_t		more;
 
-			/* Wait for a slot */
-			gfxSemWait(&gdispMsgsSem, TIME_INFINITE);
+		while(1) {
+			/* Wait for a posted record */
+			gfxSystemLock();
+			pu = &gdispRing[ringTail];
+			if (!ringUsed || pu->hdr.state == RING_BUSY) {
+				ringSleeping = TRUE;
+				gfxSystemUnlock();
+				gfxSemWait(&ringDataSem, TIME_INFINITE);
+				continue;
+			}
+			gfxSystemUnlock();
+
+			/* Draw everything that has been posted. We need the mutex in case a synchronous operation is occurring */
+			gfxMutexEnter(&gdispMutex);
+			do {
+				if (pu->hdr.state == RING_READY)
+					ringExecute(pu);
+
+				/* Release the record */
+				gfxSystemLock();
+				ringTail += pu->hdr.size;
+				if (ringTail >= RING_UNITS)
+					ringTail = 0;
+				ringUsed -= pu->hdr.size;
+				pu = &gdispRing[ringTail];
+				more = ringUsed && pu->hdr.state != RING_BUSY;
+				waiters = ringWaiters;
+				ringWaiters = 0;
+				gfxSystemUnlock();
+
+				/* Wake anyone waiting for space */
+				while(waiters--)
+					gfxSemSignal(&ringSpaceSem);
+			} while(more);
+			gfxMutexExit(&gdispMutex);
+		}
+		return 0;
+	}
 
-			/* Find the slot */
-			gfxMutexEnter(&gdispMsgsMutex);
-			for(p=gdispMsgs; p < &gdispMsgs[GDISP_QUEUE_SIZE]; p++) {
-				if (p->action == GDISP_LLD_MSG_NOP) {
-					/* Allocate it */
-					p->action = action;
-					gfxMutexExit(&gdispMsgsMutex);
-					return p;
+	/**
+	 * @brief   Reserve a record in the command ring, waiting for space if necessary.
+	 * @return	A pointer to the payload area of the record
+	 *
+	 * @param[in] type	The record type
+	 * @param[in] size	The size of the payload in bytes. Must not be more than RING_MAXPAYLOAD.
+	 *
+	 * @notapi
+	 */
+	static void *ringAlloc(uint8_t type, size_t size) {
+		ringUnit	*pu;
+		unsigned	units, pad;
+
+		units = 1 + (size + sizeof(ringUnit) - 1) / sizeof(ringUnit);
+		while(1) {
+			gfxSystemLock();
+			pad = ringHead + units > RING_UNITS ? RING_UNITS - ringHead : 0;
+			if (ringUsed + pad + units <= RING_UNITS) {
+				if (pad) {
+					gdispRing[ringHead].hdr.size = pad;
+					gdispRing[ringHead].hdr.state = RING_SKIP;
+					ringUsed += pad;
+					ringHead = 0;
 				}
+				pu = &gdispRing[ringHead];
+				pu->hdr.size = units;
+				pu->hdr.state = RING_BUSY;
+				pu->hdr.type = type;
+				ringUsed += units;
+				ringHead += units;
+				if (ringHead >= RING_UNITS)
+					ringHead = 0;
+				gfxSystemUnlock();
+				return pu+1;
 			}
-			gfxMutexExit(&gdispMsgsMutex);
 
-			/* Oops - none found, try again */
-			gfxSemSignal(&gdispMsgsSem);
+			/* Wait for the GDISP thread to free some space */
+			ringWaiters++;
+			gfxSystemUnlock();
+			gfxSemWait(&ringSpaceSem, TIME_INFINITE);
 		}
 	}
+
+	/**
+	 * @brief   Post a record previously reserved with ringAlloc().
+	 *
+	 * @param[in] payload	The payload pointer returned by ringAlloc()
+	 *
+	 * @notapi
+	 */
+	static void ringPost(void *payload) {
+		bool_t	wake;
+
+		gfxSystemLock();
+		((ringUnit *)payload)[-1].hdr.state = RING_READY;
+		wake = ringSleeping;
+		ringSleeping = FALSE;
+		gfxSystemUnlock();
+		if (wake)
+			gfxSemSignal(&ringDataSem);
+	}
+
+	/**
+	 * @brief   Wait until everything queued before this call has been drawn.
+	 *
+	 * @notapi
+	 */
+	static void ringSync(void) {
+		gfxSem	sem;
+		gfxSem	**pp;
+
+		gfxSemInit(&sem, 0, 1);
+		pp = (gfxSem **)ringAlloc(RING_SYNC, sizeof(gfxSem *));
+		*pp = &sem;
+		ringPost(pp);
+		gfxSemWait(&sem, TIME_INFINITE);
+		gfxSemDestroy(&sem);
+	}
+
+	#define gdispAllocMsg(action)		gdispAllocMsgEx(action, 0)
+	#define gdispPostMsg(p)				ringPost(p)
+
+	static gdisp_lld_msg_t *gdispAllocMsgEx(gdisp_msgaction_t action, size_t extra) {
+		gdisp_lld_msg_t	*p;
+
+		p = (gdisp_lld_msg_t *)ringAlloc(RING_MSG, sizeof(gdisp_lld_msg_t) + extra);
+		p->action = action;
+		return p;
+	}
 #endif
 
 /*===========================================================================*/
@@ -99,29 +697,28 @@
 	void _gdispInit(void) {
 		/* Initialise Mutex */
 		gfxMutexInit(&gdispMutex);
+		TCACHE_INIT();
+		ICACHE_INIT();
 
 		/* Initialise driver */
 		gfxMutexEnter(&gdispMutex);
 		gdisp_lld_init();
 		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_START();
 	}
 #elif GDISP_NEED_ASYNC
 	void _gdispInit(void) {
-		unsigned		i;
 		gfxThreadHandle	hth;
 
-		/* Mark all the Messages as free */
-		for(i=0; i < GDISP_QUEUE_SIZE; i++)
-			gdispMsgs[i].action = GDISP_LLD_MSG_NOP;
-
-		/* Initialise our Queue, Mutex's and Counting Semaphore.
-		 * 	A Mutex is required as well as the Queue and Thread because some calls have to be synchronous.
+		/* Initialise our Ring, Mutex and Semaphores.
+		 * 	A Mutex is required as well as the Ring and Thread because some calls have to be synchronous.
 		 *	Synchronous calls get handled by the calling thread, asynchronous by our worker thread.
 		 */
-		gfxQueueInit(&gdispQueue);
 		gfxMutexInit(&gdispMutex);
-		gfxMutexInit(&gdispMsgsMutex);
-		gfxSemInit(&gdispMsgsSem, GDISP_QUEUE_SIZE, GDISP_QUEUE_SIZE);
+		TCACHE_INIT();
+		ICACHE_INIT();
+		gfxSemInit(&ringSpaceSem, 0, MAX_SEMAPHORE_COUNT);
+		gfxSemInit(&ringDataSem, 0, 1);
 
 		hth = gfxThreadCreate(waGDISPThread, sizeof(waGDISPThread), NORMAL_PRIORITY, GDISPThreadHandler, NULL);
 		if (hth) gfxThreadClose(hth);
@@ -130,232 +727,403 @@
 		gfxMutexEnter(&gdispMutex);
 		gdisp_lld_init();
 		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_START();
 	}
 #else
 	void _gdispInit(void) {
 		gdisp_lld_init();
+		AUTOFLUSH_START();
 	}
 #endif
 
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	bool_t gdispIsBusy(void) {
 		return FALSE;
 	}
 #elif GDISP_NEED_ASYNC
 	bool_t gdispIsBusy(void) {
-		return !gfxQueueIsEmpty(&gdispQueue);
+		return ringUsed != 0;
 	}
 #endif
 
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	void gdispClear(color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_CLEAR, 0, 0, 0, 0, color));
+		MUTEX_ENTER();
 		gdisp_lld_clear(color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARKSCREEN();
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ASYNC
 	void gdispClear(color_t color) {
+		LIST_RECORD(listOp(LIST_OP_CLEAR, 0, 0, 0, 0, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_CLEAR);
 		p->clear.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	void gdispDrawPixel(coord_t x, coord_t y, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_DRAWPIXEL, x, y, 0, 0, color));
+		MUTEX_ENTER();
 		gdisp_lld_draw_pixel(x, y, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x, y, 1, 1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ASYNC
 	void gdispDrawPixel(coord_t x, coord_t y, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWPIXEL, x, y, 0, 0, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWPIXEL);
 		p->drawpixel.x = x;
 		p->drawpixel.y = y;
 		p->drawpixel.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 	
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	void gdispDrawLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_DRAWLINE, x0, y0, x1, y1, color));
+		MUTEX_ENTER();
 		gdisp_lld_draw_line(x0, y0, x1, y1, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARKLINE(x0, y0, x1, y1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ASYNC
 	void gdispDrawLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWLINE, x0, y0, x1, y1, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWLINE);
 		p->drawline.x0 = x0;
 		p->drawline.y0 = y0;
 		p->drawline.x1 = x1;
 		p->drawline.y1 = y1;
 		p->drawline.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	void gdispFillArea(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_FILLAREA, x, y, cx, cy, color));
+		MUTEX_ENTER();
 		gdisp_lld_fill_area(x, y, cx, cy, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ASYNC
 	void gdispFillArea(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_FILLAREA, x, y, cx, cy, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FILLAREA);
 		p->fillarea.x = x;
 		p->fillarea.y = y;
 		p->fillarea.cx = cx;
 		p->fillarea.cy = cy;
 		p->fillarea.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 	
-#if GDISP_NEED_MULTITHREAD
+#if GDISP_NEED_SYNCAPI
 	void gdispBlitAreaEx(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listBlitArea(x, y, cx, cy, srcx, srcy, srccx, buffer));
+		MUTEX_ENTER();
 		gdisp_lld_blit_area_ex(x, y, cx, cy, srcx, srcy, srccx, buffer);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ASYNC
 	void gdispBlitAreaEx(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
-		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_BLITAREA);
+		gdisp_lld_msg_t	*p;
+		pixel_t			*pd;
+		size_t			sz;
+		coord_t			i;
+
+		LIST_RECORD(listBlitArea(x, y, cx, cy, srcx, srcy, srccx, buffer));
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		/* If the pixels won't fit in the ring wait for the queue to catch up and draw it ourselves */
+		sz = (size_t)cx * cy * sizeof(pixel_t);
+		if (sizeof(gdisp_lld_msg_t) + sz > RING_MAXPAYLOAD) {
+			ringSync();
+			MUTEX_ENTER();
+			gdisp_lld_blit_area_ex(x, y, cx, cy, srcx, srcy, srccx, buffer);
+			AUTOFLUSH_MARK(x, y, cx, cy);
+			MUTEX_EXIT();
+			return;
+		}
+
+		/* Copy the pixels into the ring so the caller can reuse their buffer */
+		p = gdispAllocMsgEx(GDISP_LLD_MSG_BLITAREA, sz);
+		pd = (pixel_t *)(p+1);
 		p->blitarea.x = x;
 		p->blitarea.y = y;
 		p->blitarea.cx = cx;
 		p->blitarea.cy = cy;
-		p->blitarea.srcx = srcx;
-		p->blitarea.srcy = srcy;
-		p->blitarea.srccx = srccx;
-		p->blitarea.buffer = buffer;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		p->blitarea.srcx = 0;
+		p->blitarea.srcy = 0;
+		p->blitarea.srccx = cx;
+		p->blitarea.buffer = pd;
+		for(buffer += srcy*srccx + srcx, i = 0; i < cy; i++, buffer += srccx, pd += cx)
+			memcpy(pd, buffer, cx * sizeof(pixel_t));
+		gdispPostMsg(p);
 	}
 #endif
 	
-#if (GDISP_NEED_CLIP && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_CLIP && GDISP_NEED_SYNCAPI)
 	void gdispSetClip(coord_t x, coord_t y, coord_t cx, coord_t cy) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_SETCLIP, x, y, cx, cy, 0));
+		MUTEX_ENTER();
 		gdisp_lld_set_clip(x, y, cx, cy);
-		gfxMutexExit(&gdispMutex);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_CLIP && GDISP_NEED_ASYNC
 	void gdispSetClip(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		LIST_RECORD(listOp(LIST_OP_SETCLIP, x, y, cx, cy, 0));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_SETCLIP);
 		p->setclip.x = x;
 		p->setclip.y = y;
 		p->setclip.cx = cx;
 		p->setclip.cy = cy;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_CIRCLE && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_CIRCLE && GDISP_NEED_SYNCAPI)
 	void gdispDrawCircle(coord_t x, coord_t y, coord_t radius, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_DRAWCIRCLE, x, y, radius, 0, color));
+		MUTEX_ENTER();
 		gdisp_lld_draw_circle(x, y, radius, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_CIRCLE && GDISP_NEED_ASYNC
 	void gdispDrawCircle(coord_t x, coord_t y, coord_t radius, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWCIRCLE, x, y, radius, 0, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWCIRCLE);
 		p->drawcircle.x = x;
 		p->drawcircle.y = y;
 		p->drawcircle.radius = radius;
 		p->drawcircle.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 	
-#if (GDISP_NEED_CIRCLE && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_CIRCLE && GDISP_NEED_SYNCAPI)
 	void gdispFillCircle(coord_t x, coord_t y, coord_t radius, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_FILLCIRCLE, x, y, radius, 0, color));
+		MUTEX_ENTER();
 		gdisp_lld_fill_circle(x, y, radius, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_CIRCLE && GDISP_NEED_ASYNC
 	void gdispFillCircle(coord_t x, coord_t y, coord_t radius, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_FILLCIRCLE, x, y, radius, 0, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FILLCIRCLE);
 		p->fillcircle.x = x;
 		p->fillcircle.y = y;
 		p->fillcircle.radius = radius;
 		p->fillcircle.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_ELLIPSE && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_ELLIPSE && GDISP_NEED_SYNCAPI)
 	void gdispDrawEllipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_DRAWELLIPSE, x, y, a, b, color));
+		MUTEX_ENTER();
 		gdisp_lld_draw_ellipse(x, y, a, b, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-a, y-b, 2*a+1, 2*b+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ELLIPSE && GDISP_NEED_ASYNC
 	void gdispDrawEllipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWELLIPSE, x, y, a, b, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWELLIPSE);
 		p->drawellipse.x = x;
 		p->drawellipse.y = y;
 		p->drawellipse.a = a;
 		p->drawellipse.b = b;
 		p->drawellipse.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 	
-#if (GDISP_NEED_ELLIPSE && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_ELLIPSE && GDISP_NEED_SYNCAPI)
 	void gdispFillEllipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp(LIST_OP_FILLELLIPSE, x, y, a, b, color));
+		MUTEX_ENTER();
 		gdisp_lld_fill_ellipse(x, y, a, b, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-a, y-b, 2*a+1, 2*b+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ELLIPSE && GDISP_NEED_ASYNC
 	void gdispFillEllipse(coord_t x, coord_t y, coord_t a, coord_t b, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_FILLELLIPSE, x, y, a, b, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FILLELLIPSE);
 		p->fillellipse.x = x;
 		p->fillellipse.y = y;
 		p->fillellipse.a = a;
 		p->fillellipse.b = b;
 		p->fillellipse.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_ARC && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_ARC && GDISP_NEED_SYNCAPI)
 	void gdispDrawArc(coord_t x, coord_t y, coord_t radius, coord_t start, coord_t end, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp5(LIST_OP_DRAWARC, x, y, radius, start, end, color));
+		MUTEX_ENTER();
 		gdisp_lld_draw_arc(x, y, radius, start, end, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ARC && GDISP_NEED_ASYNC
 	void gdispDrawArc(coord_t x, coord_t y, coord_t radius, coord_t start, coord_t end, color_t color) {
+		LIST_RECORD(listOp5(LIST_OP_DRAWARC, x, y, radius, start, end, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWARC);
 		p->drawarc.x = x;
 		p->drawarc.y = y;
 		p->drawarc.radius = radius;
-		p->drawarc.start = start;
-		p->drawarc.end = end;
+		p->drawarc.startangle = start;
+		p->drawarc.endangle = end;
 		p->drawarc.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_ARC && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_ARC && GDISP_NEED_SYNCAPI)
 	void gdispFillArc(coord_t x, coord_t y, coord_t radius, coord_t start, coord_t end, color_t color) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp5(LIST_OP_FILLARC, x, y, radius, start, end, color));
+		MUTEX_ENTER();
 		gdisp_lld_fill_arc(x, y, radius, start, end, color);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_ARC && GDISP_NEED_ASYNC
 	void gdispFillArc(coord_t x, coord_t y, coord_t radius, coord_t start, coord_t end, color_t color) {
+		LIST_RECORD(listOp5(LIST_OP_FILLARC, x, y, radius, start, end, color));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FILLARC);
 		p->fillarc.x = x;
 		p->fillarc.y = y;
 		p->fillarc.radius = radius;
-		p->fillarc.start = start;
-		p->fillarc.end = end;
+		p->fillarc.startangle = start;
+		p->fillarc.endangle = end;
 		p->fillarc.color = color;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
+	}
+#endif
+
+#if (GDISP_NEED_ALPHA && GDISP_NEED_SYNCAPI)
+	void gdispFillAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha) {
+		LIST_RECORD(listOp5(LIST_OP_FILLAREAALPHA, x, y, cx, cy, alpha, color));
+		MUTEX_ENTER();
+		gdisp_lld_fill_area_alpha(x, y, cx, cy, color, alpha);
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		MUTEX_EXIT();
+	}
+#elif GDISP_NEED_ALPHA && GDISP_NEED_ASYNC
+	void gdispFillAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, uint8_t alpha) {
+		LIST_RECORD(listOp5(LIST_OP_FILLAREAALPHA, x, y, cx, cy, alpha, color));
+		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FILLAREAALPHA);
+		p->fillareaalpha.x = x;
+		p->fillareaalpha.y = y;
+		p->fillareaalpha.cx = cx;
+		p->fillareaalpha.cy = cy;
+		p->fillareaalpha.color = color;
+		p->fillareaalpha.alpha = alpha;
+		gdispPostMsg(p);
+	}
+#endif
+
+#if (GDISP_NEED_ALPHA && GDISP_NEED_SYNCAPI)
+	void gdispBlitAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha) {
+		LIST_RECORD(listBlitAreaAlpha(x, y, cx, cy, srcx, srcy, srccx, buffer, alpha));
+		MUTEX_ENTER();
+		gdisp_lld_blit_area_alpha(x, y, cx, cy, srcx, srcy, srccx, buffer, alpha);
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		MUTEX_EXIT();
+	}
+#elif GDISP_NEED_ALPHA && GDISP_NEED_ASYNC
+	void gdispBlitAreaAlpha(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer, uint8_t alpha) {
+		gdisp_lld_msg_t	*p;
+		pixel_t			*pd;
+		size_t			sz;
+		coord_t			i;
+
+		LIST_RECORD(listBlitAreaAlpha(x, y, cx, cy, srcx, srcy, srccx, buffer, alpha));
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		/* If the pixels won't fit in the ring wait for the queue to catch up and draw it ourselves */
+		sz = (size_t)cx * cy * sizeof(pixel_t);
+		if (sizeof(gdisp_lld_msg_t) + sz > RING_MAXPAYLOAD) {
+			ringSync();
+			MUTEX_ENTER();
+			gdisp_lld_blit_area_alpha(x, y, cx, cy, srcx, srcy, srccx, buffer, alpha);
+			AUTOFLUSH_MARK(x, y, cx, cy);
+			MUTEX_EXIT();
+			return;
+		}
+
+		/* Copy the pixels into the ring so the caller can reuse their buffer */
+		p = gdispAllocMsgEx(GDISP_LLD_MSG_BLITAREAALPHA, sz);
+		pd = (pixel_t *)(p+1);
+		p->blitareaalpha.x = x;
+		p->blitareaalpha.y = y;
+		p->blitareaalpha.cx = cx;
+		p->blitareaalpha.cy = cy;
+		p->blitareaalpha.srcx = 0;
+		p->blitareaalpha.srcy = 0;
+		p->blitareaalpha.srccx = cx;
+		p->blitareaalpha.buffer = pd;
+		p->blitareaalpha.alpha = alpha;
+		for(buffer += srcy*srccx + srcx, i = 0; i < cy; i++, buffer += srccx, pd += cx)
+			memcpy(pd, buffer, cx * sizeof(pixel_t));
+		gdispPostMsg(p);
+	}
+#endif
+
+#if (GDISP_NEED_ALPHA && GDISP_NEED_SYNCAPI)
+	void gdispDrawLineAA(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWLINEAA, x0, y0, x1, y1, color));
+		MUTEX_ENTER();
+		gdisp_lld_draw_line_aa(x0, y0, x1, y1, color);
+		AUTOFLUSH_MARKLINE(x0, y0, x1, y1);
+		MUTEX_EXIT();
+	}
+#elif GDISP_NEED_ALPHA && GDISP_NEED_ASYNC
+	void gdispDrawLineAA(coord_t x0, coord_t y0, coord_t x1, coord_t y1, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWLINEAA, x0, y0, x1, y1, color));
+		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWLINEAA);
+		p->drawlineaa.x0 = x0;
+		p->drawlineaa.y0 = y0;
+		p->drawlineaa.x1 = x1;
+		p->drawlineaa.y1 = y1;
+		p->drawlineaa.color = color;
+		gdispPostMsg(p);
+	}
+#endif
+
+#if (GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE && GDISP_NEED_SYNCAPI)
+	void gdispDrawCircleAA(coord_t x, coord_t y, coord_t radius, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWCIRCLEAA, x, y, radius, 0, color));
+		MUTEX_ENTER();
+		gdisp_lld_draw_circle_aa(x, y, radius, color);
+		AUTOFLUSH_MARK(x-radius-1, y-radius-1, 2*radius+3, 2*radius+3);
+		MUTEX_EXIT();
+	}
+#elif GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE && GDISP_NEED_ASYNC
+	void gdispDrawCircleAA(coord_t x, coord_t y, coord_t radius, color_t color) {
+		LIST_RECORD(listOp(LIST_OP_DRAWCIRCLEAA, x, y, radius, 0, color));
+		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_DRAWCIRCLEAA);
+		p->drawcircleaa.x = x;
+		p->drawcircleaa.y = y;
+		p->drawcircleaa.radius = radius;
+		p->drawcircleaa.color = color;
+		gdispPostMsg(p);
 	}
 #endif
 
@@ -395,27 +1163,30 @@ void gdispFillRoundedBox(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t r
 }
 #endif
 
-#if (GDISP_NEED_PIXELREAD && (GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC))
+#if (GDISP_NEED_PIXELREAD && (GDISP_NEED_SYNCAPI || GDISP_NEED_ASYNC))
 	color_t gdispGetPixelColor(coord_t x, coord_t y) {
 		color_t		c;
 
 		/* Always synchronous as it must return a value */
-		gfxMutexEnter(&gdispMutex);
+		MUTEX_ENTER();
 		c = gdisp_lld_get_pixel_color(x, y);
-		gfxMutexExit(&gdispMutex);
+		MUTEX_EXIT();
 
 		return c;
 	}
 #endif
 
-#if (GDISP_NEED_SCROLL && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_SCROLL && GDISP_NEED_SYNCAPI)
 	void gdispVerticalScroll(coord_t x, coord_t y, coord_t cx, coord_t cy, int lines, color_t bgcolor) {
-		gfxMutexEnter(&gdispMutex);
+		LIST_RECORD(listOp5(LIST_OP_VERTICALSCROLL, x, y, cx, cy, lines, bgcolor));
+		MUTEX_ENTER();
 		gdisp_lld_vertical_scroll(x, y, cx, cy, lines, bgcolor);
-		gfxMutexExit(&gdispMutex);
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_SCROLL && GDISP_NEED_ASYNC
 	void gdispVerticalScroll(coord_t x, coord_t y, coord_t cx, coord_t cy, int lines, color_t bgcolor) {
+		LIST_RECORD(listOp5(LIST_OP_VERTICALSCROLL, x, y, cx, cy, lines, bgcolor));
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_VERTICALSCROLL);
 		p->verticalscroll.x = x;
 		p->verticalscroll.y = y;
@@ -423,36 +1194,214 @@ void gdispFillRoundedBox(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t r
 		p->verticalscroll.cy = cy;
 		p->verticalscroll.lines = lines;
 		p->verticalscroll.bgcolor = bgcolor;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_CONTROL && GDISP_NEED_MULTITHREAD)
+#if (GDISP_NEED_CONTROL && GDISP_NEED_SYNCAPI)
 	void gdispControl(unsigned what, void *value) {
-		gfxMutexEnter(&gdispMutex);
+		MUTEX_ENTER();
+		AUTOFLUSH_CONTROL(what);
 		gdisp_lld_control(what, value);
-		gfxMutexExit(&gdispMutex);
+		MUTEX_EXIT();
 	}
 #elif GDISP_NEED_CONTROL && GDISP_NEED_ASYNC
 	void gdispControl(unsigned what, void *value) {
 		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_CONTROL);
 		p->control.what = what;
 		p->control.value = value;
-		gfxQueuePut(&gdispQueue, &p->qi, TIME_IMMEDIATE);
+		gdispPostMsg(p);
 	}
 #endif
 
-#if (GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC) && GDISP_NEED_QUERY
+#if (GDISP_NEED_SYNCAPI || GDISP_NEED_ASYNC) && GDISP_NEED_QUERY
 	void *gdispQuery(unsigned what) {
 		void *res;
 
-		gfxMutexEnter(&gdispMutex);
+		MUTEX_ENTER();
 		res = gdisp_lld_query(what);
-		gfxMutexExit(&gdispMutex);
+		MUTEX_EXIT();
 		return res;
 	}
 #endif
 
+#if GDISP_NEED_AUTOFLUSH && GDISP_NEED_SYNCAPI
+	void gdispFlush(void) {
+		MUTEX_ENTER();
+		autoflushFlush();
+		MUTEX_EXIT();
+	}
+#elif GDISP_NEED_AUTOFLUSH && GDISP_NEED_ASYNC
+	void gdispFlush(void) {
+		gdisp_lld_msg_t *p = gdispAllocMsg(GDISP_LLD_MSG_FLUSH);
+		gdispPostMsg(p);
+	}
+#endif
+
+#if GDISP_NEED_ASYNC
+	void gdispSync(void) {
+		ringSync();
+	}
+#endif
+
+#if GDISP_NEED_LIST
+	void gdispListBegin(GDisplayList *pl, void *buf, size_t size) {
+		pl->buf = (uint8_t *)buf;
+		pl->size = size;
+		pl->len = 0;
+		pl->overflow = FALSE;
+
+		MUTEX_ENTER();
+		#if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC
+			listThread = gfxThreadMe();
+		#endif
+		listClip[0] = listClip[1] = 0;
+		listClip[2] = GDISP.Width;
+		listClip[3] = GDISP.Height;
+		listCur = pl;
+		MUTEX_EXIT();
+	}
+
+	bool_t gdispListEnd(void) {
+		GDisplayList *	pl;
+
+		MUTEX_ENTER();
+		pl = listCur;
+		listCur = 0;
+		MUTEX_EXIT();
+
+		return pl && !pl->overflow;
+	}
+
+	void gdispListReplay(const GDisplayList *pl, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		listArgs		a;
+		const uint8_t	*p, *pe;
+		uint8_t			op;
+		#if GDISP_NEED_CLIP
+			coord_t		sx0, sy0, sx1, sy1;
+			coord_t		wx0, wy0, wx1, wy1;
+			coord_t		x0, y0, x1, y1;
+
+			/* Save the current clip and then clip to the replay window.
+			 * The window is clipped but the recorded operations are still relative to x,y.
+			 */
+			MUTEX_ENTER();
+			sx0 = GDISP.clipx0; sy0 = GDISP.clipy0;
+			sx1 = GDISP.clipx1; sy1 = GDISP.clipy1;
+			MUTEX_EXIT();
+			wx0 = x < sx0 ? sx0 : x;
+			wy0 = y < sy0 ? sy0 : y;
+			wx1 = x+cx > sx1 ? sx1 : x+cx;
+			wy1 = y+cy > sy1 ? sy1 : y+cy;
+			if (wx1 <= wx0 || wy1 <= wy0)
+				return;
+			gdispSetClip(wx0, wy0, wx1-wx0, wy1-wy0);
+		#endif
+
+		p = pl->buf;
+		pe = p + pl->len;
+		while(p < pe) {
+			op = *p;
+			if (op >= LIST_OP_MAX || p + listSize(op) > pe)
+				break;
+			p++;
+			memcpy(a.c, p, listCoords[op]*sizeof(coord_t));
+			p += listCoords[op]*sizeof(coord_t);
+			if (listIsBlit(op)) {
+				memcpy(&a.buffer, p, sizeof(a.buffer));
+				p += sizeof(a.buffer);
+			} else if (op != LIST_OP_SETCLIP) {
+				memcpy(&a.color, p, sizeof(a.color));
+				p += sizeof(a.color);
+			}
+
+			switch(op) {
+			case LIST_OP_CLEAR:
+				gdispFillArea(x, y, cx, cy, a.color);
+				break;
+			case LIST_OP_DRAWPIXEL:
+				gdispDrawPixel(x+a.c[0], y+a.c[1], a.color);
+				break;
+			case LIST_OP_DRAWLINE:
+				gdispDrawLine(x+a.c[0], y+a.c[1], x+a.c[2], y+a.c[3], a.color);
+				break;
+			case LIST_OP_FILLAREA:
+				gdispFillArea(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.color);
+				break;
+			case LIST_OP_BLITAREA:
+				gdispBlitAreaEx(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.c[4], a.c[5], a.c[6], a.buffer);
+				break;
+			#if GDISP_NEED_CLIP
+				case LIST_OP_SETCLIP:
+					/* A recorded clip can only reduce the replay window */
+					x0 = x+a.c[0]; y0 = y+a.c[1];
+					x1 = x0+a.c[2]; y1 = y0+a.c[3];
+					if (x0 < wx0) x0 = wx0;
+					if (y0 < wy0) y0 = wy0;
+					if (x1 > wx1) x1 = wx1;
+					if (y1 > wy1) y1 = wy1;
+					if (x1 < x0) x1 = x0;
+					if (y1 < y0) y1 = y0;
+					gdispSetClip(x0, y0, x1-x0, y1-y0);
+					break;
+			#endif
+			#if GDISP_NEED_CIRCLE
+				case LIST_OP_DRAWCIRCLE:
+					gdispDrawCircle(x+a.c[0], y+a.c[1], a.c[2], a.color);
+					break;
+				case LIST_OP_FILLCIRCLE:
+					gdispFillCircle(x+a.c[0], y+a.c[1], a.c[2], a.color);
+					break;
+			#endif
+			#if GDISP_NEED_ELLIPSE
+				case LIST_OP_DRAWELLIPSE:
+					gdispDrawEllipse(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.color);
+					break;
+				case LIST_OP_FILLELLIPSE:
+					gdispFillEllipse(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.color);
+					break;
+			#endif
+			#if GDISP_NEED_ARC
+				case LIST_OP_DRAWARC:
+					gdispDrawArc(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.c[4], a.color);
+					break;
+				case LIST_OP_FILLARC:
+					gdispFillArc(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.c[4], a.color);
+					break;
+			#endif
+			#if GDISP_NEED_SCROLL
+				case LIST_OP_VERTICALSCROLL:
+					gdispVerticalScroll(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.c[4], a.color);
+					break;
+			#endif
+			#if GDISP_NEED_ALPHA
+				case LIST_OP_FILLAREAALPHA:
+					gdispFillAreaAlpha(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.color, (uint8_t)a.c[4]);
+					break;
+				case LIST_OP_BLITAREAALPHA:
+					gdispBlitAreaAlpha(x+a.c[0], y+a.c[1], a.c[2], a.c[3], a.c[4], a.c[5], a.c[6], a.buffer, (uint8_t)a.c[7]);
+					break;
+				case LIST_OP_DRAWLINEAA:
+					gdispDrawLineAA(x+a.c[0], y+a.c[1], x+a.c[2], y+a.c[3], a.color);
+					break;
+			#endif
+			#if GDISP_NEED_ALPHA && GDISP_NEED_CIRCLE
+				case LIST_OP_DRAWCIRCLEAA:
+					gdispDrawCircleAA(x+a.c[0], y+a.c[1], a.c[2], a.color);
+					break;
+			#endif
+			default:
+				break;
+			}
+		}
+
+		#if GDISP_NEED_CLIP
+			/* Restore the original clip */
+			gdispSetClip(sx0, sy0, sx1-sx0, sy1-sy0);
+		#endif
+	}
+#endif
+
 /*===========================================================================*/
 /* High Level Driver Routines.                                               */
 /*===========================================================================*/
@@ -493,12 +1442,70 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		gdispDrawLine(tx+p->x, ty+p->y, tx+pntarray->x, ty+pntarray->y, color);
 	}
 
+	#if GDISP_NEED_ALPHA
+		void gdispDrawPolyAA(coord_t tx, coord_t ty, const point *pntarray, unsigned cnt, color_t color) {
+			const point	*epnt, *p;
+
+			epnt = &pntarray[cnt-1];
+			for(p = pntarray; p < epnt; p++)
+				gdispDrawLineAA(tx+p->x, ty+p->y, tx+p[1].x, ty+p[1].y, color);
+			gdispDrawLineAA(tx+p->x, ty+p->y, tx+pntarray->x, ty+pntarray->y, color);
+		}
+	#endif
+
+	#if GDISP_NEED_LIST
+		static void listSpans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+			for(; cnt; cnt--, spans++)
+				listOp(LIST_OP_FILLAREA, spans->x, spans->y, spans->cx, 1, color);
+		}
+	#endif
+
+	/**
+	 * @brief   Fill a batch of horizontal spans with a color.
+	 *
+	 * @notapi
+	 */
+	#if GDISP_NEED_ASYNC
+		static void fillSpans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+			gdisp_lld_msg_t	*p;
+			unsigned		n;
+
+			LIST_RECORD(listSpans(spans, cnt, color));
+
+			/* Copy the spans into the ring so the caller can reuse their buffer */
+			for(; cnt; cnt -= n, spans += n) {
+				n = (RING_MAXPAYLOAD - sizeof(gdisp_lld_msg_t)) / sizeof(gdisp_lld_span_t);
+				if (n > cnt)
+					n = cnt;
+				p = gdispAllocMsgEx(GDISP_LLD_MSG_FILLSPANS, n * sizeof(gdisp_lld_span_t));
+				memcpy(p+1, spans, n * sizeof(gdisp_lld_span_t));
+				p->fillspans.cnt = n;
+				p->fillspans.spans = (const gdisp_lld_span_t *)(p+1);
+				p->fillspans.color = color;
+				gdispPostMsg(p);
+			}
+		}
+	#else
+		static void fillSpans(const gdisp_lld_span_t *spans, unsigned cnt, color_t color) {
+			LIST_RECORD(listSpans(spans, cnt, color));
+			MUTEX_ENTER();
+			gdisp_lld_fill_spans(spans, cnt, color);
+			#if GDISP_NEED_AUTOFLUSH
+				autoflushSpans(spans, cnt);
+			#endif
+			MUTEX_EXIT();
+		}
+	#endif
+
 	void gdispFillConvexPoly(coord_t tx, coord_t ty, const point *pntarray, unsigned cnt, color_t color) {
 		const point	*lpnt, *rpnt, *epnts;
 		fixed		lx, rx, lk, rk;
 		coord_t		y, ymax, lxc, rxc;
+		gdisp_lld_span_t	spans[GDISP_SPAN_BUFFER_SIZE];
+		unsigned	nspans;
 
 		epnts = &pntarray[cnt-1];
+		nspans = 0;
 
 		/* Find a top point */
 		rpnt = pntarray;
@@ -514,13 +1521,13 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		while (lpnt->y == y) {
 			lx = FIXED(lpnt->x);
 			lpnt = lpnt <= pntarray ? epnts : lpnt-1;
-			if (!cnt--) return;
+			if (!cnt--) goto polydone;
 		}
 		rpnt = rpnt >= epnts ? pntarray : rpnt+1;
 		while (rpnt->y == y) {
 			rx = rpnt->x<<16;
 			rpnt = rpnt >= epnts ? pntarray : rpnt+1;
-			if (!cnt--) return;
+			if (!cnt--) goto polydone;
 		}
 		lk = (FIXED(lpnt->x) - lx) / (lpnt->y - y);
 		rk = (FIXED(rpnt->x) - rx) / (rpnt->y - y);
@@ -538,23 +1545,22 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 				 * Also ensures that we draw from left to right with the minimum number
 				 * of pixels.
 				 */
-				if (lxc < rxc) {
-					if (rxc - lxc == 1)
-						gdispDrawPixel(tx+lxc, ty+y, color);
-					else
-						gdispDrawLine(tx+lxc, ty+y, tx+rxc-1, ty+y, color);
-				} else if (lxc > rxc) {
-					if (lxc - rxc == 1)
-						gdispDrawPixel(tx+rxc, ty+y, color);
-					else
-						gdispDrawLine(tx+rxc, ty+y, tx+lxc-1, ty+y, color);
+				if (lxc != rxc) {
+					if (nspans >= GDISP_SPAN_BUFFER_SIZE) {
+						fillSpans(spans, nspans, color);
+						nspans = 0;
+					}
+					spans[nspans].x = tx + (lxc < rxc ? lxc : rxc);
+					spans[nspans].y = ty + y;
+					spans[nspans].cx = lxc < rxc ? rxc - lxc : lxc - rxc;
+					nspans++;
 				}
 
 				lx += lk;
 				rx += rk;
 			}
 
-			if (!cnt--) return;
+			if (!cnt--) goto polydone;
 
 			/* Replace the appropriate point */
 			if (ymax == lpnt->y) {
@@ -562,7 +1568,7 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 				while (lpnt->y == y) {
 					lx = FIXED(lpnt->x);
 					lpnt = lpnt <= pntarray ? epnts : lpnt-1;
-					if (!cnt--) return;
+					if (!cnt--) goto polydone;
 				}
 				lk = (FIXED(lpnt->x) - lx) / (lpnt->y - y);
 			} else {
@@ -570,18 +1576,32 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 				while (rpnt->y == y) {
 					rx = FIXED(rpnt->x);
 					rpnt = rpnt >= epnts ? pntarray : rpnt+1;
-					if (!cnt--) return;
+					if (!cnt--) goto polydone;
 				}
 				rk = (FIXED(rpnt->x) - rx) / (rpnt->y - y);
 			}
 		}
+
+	polydone:
+		if (nspans)
+			fillSpans(spans, nspans, color);
 	}
 #endif
 
 #if GDISP_NEED_TEXT
 	#include "mcufont.h"
 
-	#if GDISP_NEED_ANTIALIAS && GDISP_NEED_PIXELREAD
+	#if GDISP_NEED_ANTIALIAS && GDISP_NEED_ALPHA
+		static void text_draw_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+			if (alpha == 255) {
+				if (count == 1)
+					gdispDrawPixel(x, y, ((color_t *)state)[0]);
+				else
+					gdispFillArea(x, y, count, 1, ((color_t *)state)[0]);
+			} else
+				gdispFillAreaAlpha(x, y, count, 1, ((color_t *)state)[0], alpha);
+		}
+	#elif GDISP_NEED_ANTIALIAS && GDISP_NEED_PIXELREAD
 		static void text_draw_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
 			if (alpha == 255) {
 				if (count == 1)
@@ -606,11 +1626,6 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		}
 	#endif
 
-	void gdispDrawChar(coord_t x, coord_t y, uint16_t c, font_t font, color_t color) {
-		/* No mutex required as we only call high level functions which have their own mutex */
-		mf_render_character(font, x, y, c, text_draw_char_callback, &color);
-	}
-
 	#if GDISP_NEED_ANTIALIAS
 		static void text_fill_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
 			if (alpha == 255) {
@@ -629,15 +1644,423 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		#define text_fill_char_callback	text_draw_char_callback
 	#endif
 
-	void gdispFillChar(coord_t x, coord_t y, uint16_t c, font_t font, color_t color, color_t bgcolor) {
-		/* No mutex required as we only call high level functions which have their own mutex */
+	#if GDISP_NEED_ASYNC || GDISP_NEED_CONTEXT
+		/* Text queued to the GDISP thread or drawn through a context is drawn directly as the display is already owned */
+		static void textFillArea(bool_t direct, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
+			if (!direct) {
+				gdispFillArea(x, y, cx, cy, color);
+				return;
+			}
+			if (cx == 1 && cy == 1)
+				gdisp_lld_draw_pixel(x, y, color);
+			else
+				gdisp_lld_fill_area(x, y, cx, cy, color);
+			AUTOFLUSH_MARK(x, y, cx, cy);
+		}
+
+		#if GDISP_NEED_ANTIALIAS && GDISP_NEED_ALPHA
+			static void text_lld_draw_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+				if (alpha == 255)
+					textFillArea(TRUE, x, y, count, 1, ((color_t *)state)[0]);
+				else {
+					gdisp_lld_fill_area_alpha(x, y, count, 1, ((color_t *)state)[0], alpha);
+					AUTOFLUSH_MARK(x, y, count, 1);
+				}
+			}
+		#elif GDISP_NEED_ANTIALIAS && GDISP_NEED_PIXELREAD
+			static void text_lld_draw_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+				if (alpha == 255)
+					textFillArea(TRUE, x, y, count, 1, ((color_t *)state)[0]);
+				else {
+					while (count--) {
+						textFillArea(TRUE, x, y, 1, 1, gdispBlendColor(((color_t *)state)[0], gdisp_lld_get_pixel_color(x, y), alpha));
+						x++;
+					}
+				}
+			}
+		#else
+			static void text_lld_draw_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+				if (alpha > 0x80)			// A best approximation when using anti-aliased fonts but we can't actually draw them anti-aliased
+					textFillArea(TRUE, x, y, count, 1, ((color_t *)state)[0]);
+			}
+		#endif
+
+		#if GDISP_NEED_ANTIALIAS
+			static void text_lld_fill_char_callback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+				if (alpha == 255)
+					textFillArea(TRUE, x, y, count, 1, ((color_t *)state)[0]);
+				else {
+					while (count--) {
+						textFillArea(TRUE, x, y, 1, 1, gdispBlendColor(((color_t *)state)[0], ((color_t *)state)[1], alpha));
+						x++;
+					}
+				}
+			}
+		#else
+			#define text_lld_fill_char_callback	text_lld_draw_char_callback
+		#endif
+
+		#define TEXT_DRAW_CALLBACK(direct)	((direct) ? text_lld_draw_char_callback : text_draw_char_callback)
+		#define TEXT_FILL_CALLBACK(direct)	((direct) ? text_lld_fill_char_callback : text_fill_char_callback)
+	#else
+		#define textFillArea(direct, x, y, cx, cy, color)	gdispFillArea(x, y, cx, cy, color)
+		#define TEXT_DRAW_CALLBACK(direct)	text_draw_char_callback
+		#define TEXT_FILL_CALLBACK(direct)	text_fill_char_callback
+	#endif
+
+	#if GDISP_NEED_TEXT_CACHE
+		/**
+		 * The glyph cache.
+		 *	Each entry holds the inked area of one rendered glyph. Filled text is cached as pixels
+		 *	already colored for its foreground and background so that it can be drawn with a single
+		 *	blit. Transparent text is cached as a coverage mask that is replayed through the normal
+		 *	pixel callback. Entries are found through a small hash table and the least recently used
+		 *	are discarded when the cache would grow beyond GDISP_TEXT_CACHE_SIZE bytes.
+		 */
+		#define TCACHE_HASH			32			// Must be a power of 2
+		#define TCACHE_MASK			0			// An array of uint8_t alpha values
+		#define TCACHE_PIXELS		1			// An array of pixel_t
+
+		typedef struct textCacheEntry {
+			struct textCacheEntry *	next;		// The LRU list - most recently used first
+			struct textCacheEntry *	prev;
+			struct textCacheEntry *	hnext;		// The hash chain
+			font_t					font;
+			color_t					color;		// The colors for TCACHE_PIXELS
+			color_t					bgcolor;
+			uint16_t				c;
+			uint8_t					type;		// TCACHE_MASK or TCACHE_PIXELS
+			uint8_t					busy;		// The number of threads drawing it - it can't be discarded
+			coord_t					x, y;		// The inked area relative to the glyph origin
+			coord_t					cx, cy;
+			size_t					size;		// The allocated size
+			// The mask or pixels follow
+		} textCacheEntry;
+
+		typedef struct textCacheCapture {
+			uint8_t *	mask;
+			coord_t		w, h;
+			coord_t		x0, y0, x1, y1;			// The inked area (x1, y1 are exclusive)
+		} textCacheCapture;
+
+		static textCacheEntry *	tcacheHash[TCACHE_HASH];
+		static textCacheEntry *	tcacheHead;
+		static textCacheEntry *	tcacheTail;
+		static size_t			tcacheUsed;
+
+		#define tcacheHashOf(font, c, type, color, bgcolor)	\
+					((((unsigned)(size_t)(font) >> 4) ^ (c) ^ ((type) ? (unsigned)(color) ^ ((unsigned)(bgcolor) << 3) : 0)) & (TCACHE_HASH-1))
+
+		/* Unlink an entry and free it. The cache must be locked. */
+		static void tcacheDiscard(textCacheEntry *pe) {
+			textCacheEntry **pp;
+
+			for(pp = &tcacheHash[tcacheHashOf(pe->font, pe->c, pe->type, pe->color, pe->bgcolor)]; *pp != pe; pp = &(*pp)->hnext);
+			*pp = pe->hnext;
+			if (pe->prev) pe->prev->next = pe->next;
+			else tcacheHead = pe->next;
+			if (pe->next) pe->next->prev = pe->prev;
+			else tcacheTail = pe->prev;
+			tcacheUsed -= pe->size;
+			gfxFree(pe);
+		}
+
+		/* Record the pixels of a glyph as it is rendered */
+		static void tcacheCaptureCallback(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+			textCacheCapture *	pc;
+
+			pc = (textCacheCapture *)state;
+			if (!alpha || y < 0 || y >= pc->h || x < 0)
+				return;
+			if (x + count > pc->w) {
+				if (x >= pc->w)
+					return;
+				count = pc->w - x;
+			}
+			memset(pc->mask + y*pc->w + x, alpha, count);
+			if (x < pc->x0) pc->x0 = x;
+			if (x + count > pc->x1) pc->x1 = x + count;
+			if (y < pc->y0) pc->y0 = y;
+			if (y >= pc->y1) pc->y1 = y + 1;
+		}
+
+		/**
+		 * @brief	Find a glyph in the cache, rendering it into the cache if it isn't there.
+		 * @return	The entry (marked busy) or NULL if it can't be cached
+		 * @note	The entry must be released with tcacheRelease() once it has been drawn.
+		 *
+		 * @notapi
+		 */
+		static textCacheEntry *tcacheGet(font_t font, uint16_t c, uint8_t type, color_t color, color_t bgcolor) {
+			textCacheEntry *	pe;
+			textCacheCapture	cap;
+			pixel_t *			pp;
+			const uint8_t *		pm;
+			size_t				size;
+			coord_t				i, j;
+
+			if (type == TCACHE_MASK)
+				color = bgcolor = 0;
+
+			TCACHE_LOCK();
+
+			/* Look for it - a hit becomes the most recently used */
+			for(pe = tcacheHash[tcacheHashOf(font, c, type, color, bgcolor)]; pe; pe = pe->hnext) {
+				if (pe->font == font && pe->c == c && pe->type == type && pe->color == color && pe->bgcolor == bgcolor) {
+					if (pe->prev) {
+						pe->prev->next = pe->next;
+						if (pe->next) pe->next->prev = pe->prev;
+						else tcacheTail = pe->prev;
+						pe->prev = 0;
+						pe->next = tcacheHead;
+						tcacheHead->prev = pe;
+						tcacheHead = pe;
+					}
+					pe->busy++;
+					TCACHE_UNLOCK();
+					return pe;
+				}
+			}
+
+			/* Render the glyph to find its inked area */
+			cap.w = font->width;
+			cap.h = font->height;
+			if (!(cap.mask = (uint8_t *)gfxAlloc((size_t)cap.w * cap.h))) {
+				TCACHE_UNLOCK();
+				return 0;
+			}
+			memset(cap.mask, 0, (size_t)cap.w * cap.h);
+			cap.x0 = cap.w; cap.y0 = cap.h;
+			cap.x1 = cap.y1 = 0;
+			mf_render_character(font, 0, 0, c, tcacheCaptureCallback, &cap);
+			if (cap.x1 <= cap.x0)
+				cap.x0 = cap.x1 = cap.y0 = cap.y1 = 0;
+
+			/* Make room for it */
+			size = sizeof(textCacheEntry) + (size_t)(cap.x1 - cap.x0) * (cap.y1 - cap.y0) * (type == TCACHE_PIXELS ? sizeof(pixel_t) : 1);
+			if (size > GDISP_TEXT_CACHE_SIZE) {
+				gfxFree(cap.mask);
+				TCACHE_UNLOCK();
+				return 0;
+			}
+			for(pe = tcacheTail; pe && tcacheUsed + size > GDISP_TEXT_CACHE_SIZE; ) {
+				textCacheEntry *prev = pe->prev;
+				if (!pe->busy)
+					tcacheDiscard(pe);
+				pe = prev;
+			}
+			if (tcacheUsed + size > GDISP_TEXT_CACHE_SIZE || !(pe = (textCacheEntry *)gfxAlloc(size))) {
+				gfxFree(cap.mask);
+				TCACHE_UNLOCK();
+				return 0;
+			}
+
+			/* Fill it in */
+			pe->font = font;
+			pe->color = color;
+			pe->bgcolor = bgcolor;
+			pe->c = c;
+			pe->type = type;
+			pe->busy = 1;
+			pe->x = cap.x0;
+			pe->y = cap.y0;
+			pe->cx = cap.x1 - cap.x0;
+			pe->cy = cap.y1 - cap.y0;
+			pe->size = size;
+			pp = (pixel_t *)(pe+1);
+			for(j = cap.y0; j < cap.y1; j++) {
+				pm = cap.mask + j*cap.w + cap.x0;
+				if (type == TCACHE_MASK) {
+					memcpy((uint8_t *)(pe+1) + (j-cap.y0)*pe->cx, pm, pe->cx);
+					continue;
+				}
+				for(i = pe->cx; i; i--, pm++) {
+					#if GDISP_NEED_ANTIALIAS
+						*pp++ = *pm == 255 ? color : gdispBlendColor(color, bgcolor, *pm);
+					#else
+						*pp++ = *pm > 0x80 ? color : bgcolor;
+					#endif
+				}
+			}
+			gfxFree(cap.mask);
+
+			/* Link it in as the most recently used */
+			pe->hnext = tcacheHash[tcacheHashOf(font, c, type, color, bgcolor)];
+			tcacheHash[tcacheHashOf(font, c, type, color, bgcolor)] = pe;
+			pe->prev = 0;
+			pe->next = tcacheHead;
+			if (tcacheHead) tcacheHead->prev = pe;
+			else tcacheTail = pe;
+			tcacheHead = pe;
+			tcacheUsed += size;
+			TCACHE_UNLOCK();
+			return pe;
+		}
+
+		static void tcacheRelease(textCacheEntry *pe) {
+			TCACHE_LOCK();
+			pe->busy--;
+			TCACHE_UNLOCK();
+		}
+
+		/**
+		 * @brief	Discard the cached glyphs for a font.
+		 * @note	Called by gdispCloseFont(). Glyphs that are being drawn are left alone.
+		 *
+		 * @param[in] font	The font or NULL for all fonts
+		 *
+		 * @notapi
+		 */
+		void _gdispTextCacheFlush(font_t font) {
+			textCacheEntry	*pe, *next;
+
+			TCACHE_LOCK();
+			for(pe = tcacheHead; pe; pe = next) {
+				next = pe->next;
+				if (!pe->busy && (!font || pe->font == font))
+					tcacheDiscard(pe);
+			}
+			TCACHE_UNLOCK();
+		}
+
+		/* Draw a glyph from the cache */
+		static void tcacheDraw(bool_t direct, const textCacheEntry *pe, coord_t x, coord_t y, mf_pixel_callback_t callback, void *state) {
+			const uint8_t	*pm;
+			coord_t			i, j, n;
+
+			if (!pe->cx)
+				return;
+			x += pe->x;
+			y += pe->y;
+
+			/* Pre-colored pixels are a single blit */
+			if (pe->type == TCACHE_PIXELS) {
+				#if GDISP_NEED_ASYNC || GDISP_NEED_CONTEXT
+					if (direct) {
+						gdisp_lld_blit_area_ex(x, y, pe->cx, pe->cy, 0, 0, pe->cx, (const pixel_t *)(pe+1));
+						AUTOFLUSH_MARK(x, y, pe->cx, pe->cy);
+						return;
+					}
+				#else
+					(void) direct;
+				#endif
+				gdispBlitAreaEx(x, y, pe->cx, pe->cy, 0, 0, pe->cx, (const pixel_t *)(pe+1));
+				return;
+			}
+
+			/* A mask is replayed as runs of the same alpha */
+			for(pm = (const uint8_t *)(pe+1), j = 0; j < pe->cy; j++) {
+				for(i = 0; i < pe->cx; i += n, pm += n) {
+					for(n = 1; i+n < pe->cx && pm[n] == pm[0]; n++);
+					if (pm[0])
+						callback(x+i, y+j, n, pm[0], state);
+				}
+			}
+		}
+	#endif
+
+	/**
+	 * @brief	Render a character, using the glyph cache if there is one.
+	 *
+	 * @param[in] direct	TRUE if the display is already owned
+	 * @param[in] colors	The foreground color followed (for fill) by the background color
+	 * @param[in] fill		TRUE to draw the background as well
+	 * @param[in,out] pinkend	For filled strings the right edge of the ink already drawn. Can be NULL.
+	 *
+	 * @notapi
+	 */
+	static void textRenderChar(bool_t direct, font_t font, coord_t x, coord_t y, uint16_t c, color_t *colors, bool_t fill, coord_t *pinkend) {
+		#if GDISP_NEED_TEXT_CACHE
+			textCacheEntry	*pe;
+
+			/* A blit is only possible if it won't paint over the ink of an earlier glyph */
+			pe = 0;
+			#if !GDISP_PACKED_PIXELS
+				if (fill) {
+					#if GDISP_NEED_LIST
+						/* A recorded blit would point at the cache */
+						if (!direct && LIST_RECORDING())
+							goto usemask;
+					#endif
+					if ((pe = tcacheGet(font, c, TCACHE_PIXELS, colors[0], colors[1]))
+							&& pe->cx && pinkend && x + pe->x < *pinkend) {
+						tcacheRelease(pe);
+						pe = 0;
+					}
+				}
+			#endif
+			#if GDISP_NEED_LIST
+				usemask:
+			#endif
+			if (!pe && !(pe = tcacheGet(font, c, TCACHE_MASK, 0, 0))) {
+				mf_render_character(font, x, y, c, fill ? TEXT_FILL_CALLBACK(direct) : TEXT_DRAW_CALLBACK(direct), colors);
+				if (pinkend)
+					*pinkend = x + font->width;
+				return;
+			}
+			tcacheDraw(direct, pe, x, y, fill ? TEXT_FILL_CALLBACK(direct) : TEXT_DRAW_CALLBACK(direct), colors);
+			if (pinkend && pe->cx && x + pe->x + pe->cx > *pinkend)
+				*pinkend = x + pe->x + pe->cx;
+			tcacheRelease(pe);
+		#else
+			#if !GDISP_NEED_ASYNC && !GDISP_NEED_CONTEXT
+				(void) direct;
+			#endif
+			(void) pinkend;
+			mf_render_character(font, x, y, c, fill ? TEXT_FILL_CALLBACK(direct) : TEXT_DRAW_CALLBACK(direct), colors);
+		#endif
+	}
+
+	#if GDISP_NEED_ASYNC
+		/* Queue a text operation to the GDISP thread. Returns FALSE if it must be drawn by the caller instead. */
+		static bool_t textQueue(uint8_t mode, coord_t x, coord_t y, coord_t cx, coord_t cy, uint16_t c, const char *str, font_t font, color_t color, color_t bgcolor, justify_t justify) {
+			ringText	*pt;
+			size_t		len;
+
+			#if GDISP_NEED_LIST
+				/* Display lists record the individual drawing operations */
+				if (LIST_RECORDING())
+					return FALSE;
+			#endif
+			len = str ? strlen(str) + 1 : 0;
+			if (sizeof(ringText) + len > RING_MAXPAYLOAD)
+				return FALSE;
+
+			pt = (ringText *)ringAlloc(RING_TEXT, sizeof(ringText) + len);
+			pt->font = font;
+			pt->x = x;
+			pt->y = y;
+			pt->cx = cx;
+			pt->cy = cy;
+			pt->color = color;
+			pt->bgcolor = bgcolor;
+			pt->c = c;
+			pt->mode = mode;
+			pt->justify = (uint8_t)justify;
+			if (len)
+				memcpy(pt+1, str, len);
+			ringPost(pt);
+			return TRUE;
+		}
+		#define TEXT_QUEUE(mode, x, y, cx, cy, c, str, font, color, bgcolor, justify)	\
+					{ if (textQueue(mode, x, y, cx, cy, c, str, font, color, bgcolor, justify)) return; }
+	#else
+		#define TEXT_QUEUE(mode, x, y, cx, cy, c, str, font, color, bgcolor, justify)
+	#endif
+
+	/* The text drawing routines. If direct is TRUE they are being run by the GDISP thread. */
+	static void textDrawChar(bool_t direct, coord_t x, coord_t y, uint16_t c, font_t font, color_t color) {
+		textRenderChar(direct, font, x, y, c, &color, FALSE, 0);
+	}
+
+	static void textFillChar(bool_t direct, coord_t x, coord_t y, uint16_t c, font_t font, color_t color, color_t bgcolor) {
 		color_t		state[2];
 
 		state[0] = color;
 		state[1] = bgcolor;
 
-		gdispFillArea(x, y, mf_character_width(font, c) + font->baseline_x, font->height, bgcolor);
-		mf_render_character(font, x, y, c, text_fill_char_callback, state);
+		textFillArea(direct, x, y, mf_character_width(font, c) + font->baseline_x, font->height, bgcolor);
+		textRenderChar(direct, font, x, y, c, state, TRUE, 0);
 	}
 
 	typedef struct
@@ -646,6 +2069,7 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		color_t color;
 		coord_t	x, y;
 		coord_t	cx, cy;
+		bool_t direct;
 	} gdispDrawString_state_t;
 
 	/* Callback to render characters. */
@@ -656,12 +2080,11 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		
 		w = mf_character_width(s->font, character);
 		if (x >= s->x && x+w < s->x + s->cx && y >= s->y && y+s->font->height <= s->y + s->cy)
-			mf_render_character(s->font, x, y, character, text_draw_char_callback, &s->color);
+			textRenderChar(s->direct, s->font, x, y, character, &s->color, FALSE, 0);
 		return w;
 	}
 
-	void gdispDrawString(coord_t x, coord_t y, const char *str, font_t font, color_t color) {
-		/* No mutex required as we only call high level functions which have their own mutex */
+	static void textDrawString(bool_t direct, coord_t x, coord_t y, const char *str, font_t font, color_t color) {
 		gdispDrawString_state_t state;
 		
 		state.font = font;
@@ -670,6 +2093,7 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		state.y = y;
 		state.cx = GDISP.Width - x;
 		state.cy = GDISP.Height - y;
+		state.direct = direct;
 		
 		x += font->baseline_x;
 		mf_render_aligned(font, x, y, MF_ALIGN_LEFT, str, 0, gdispDrawString_callback, &state);
@@ -681,6 +2105,8 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		color_t color[2];
 		coord_t	x, y;
 		coord_t	cx, cy;
+		coord_t inkend;
+		bool_t direct;
 	} gdispFillString_state_t;
 
 	/* Callback to render characters. */
@@ -691,12 +2117,11 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 
 		w = mf_character_width(s->font, character);
 		if (x >= s->x && x+w < s->x + s->cx && y >= s->y && y+s->font->height <= s->y + s->cy)
-			mf_render_character(s->font, x, y, character, text_fill_char_callback, s->color);
+			textRenderChar(s->direct, s->font, x, y, character, s->color, TRUE, &s->inkend);
 		return w;
 	}
 
-	void gdispFillString(coord_t x, coord_t y, const char *str, font_t font, color_t color, color_t bgcolor) {
-		/* No mutex required as we only call high level functions which have their own mutex */
+	static void textFillString(bool_t direct, coord_t x, coord_t y, const char *str, font_t font, color_t color, color_t bgcolor) {
 		gdispFillString_state_t state;
 		
 		state.font = font;
@@ -706,13 +2131,14 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		state.y = y;
 		state.cx = mf_get_string_width(font, str, 0, 0);
 		state.cy = font->height;
+		state.inkend = x;
+		state.direct = direct;
 		
-		gdispFillArea(x, y, state.cx, state.cy, bgcolor);
+		textFillArea(direct, x, y, state.cx, state.cy, bgcolor);
 		mf_render_aligned(font, x+font->baseline_x, y, MF_ALIGN_LEFT, str, 0, gdispFillString_callback, &state);
 	}
 
-	void gdispDrawStringBox(coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, justify_t justify) {
-		/* No mutex required as we only call high level functions which have their own mutex */
+	static void textDrawStringBox(bool_t direct, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, justify_t justify) {
 		gdispDrawString_state_t state;
 		
 		state.font = font;
@@ -721,6 +2147,7 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		state.y = y;
 		state.cx = cx;
 		state.cy = cy;
+		state.direct = direct;
 		
 		/* Select the anchor position */
 		switch(justify) {
@@ -739,8 +2166,7 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		mf_render_aligned(font, x, y, justify, str, 0, gdispDrawString_callback, &state);
 	}
 
-	void gdispFillStringBox(coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, color_t bgcolor, justify_t justify) {
-		/* No mutex required as we only call high level functions which have their own mutex */
+	static void textFillStringBox(bool_t direct, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, color_t bgcolor, justify_t justify) {
 		gdispFillString_state_t state;
 
 		state.font = font;
@@ -750,8 +2176,10 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		state.y = y;
 		state.cx = cx;
 		state.cy = cy;
+		state.inkend = x;
+		state.direct = direct;
 
-		gdispFillArea(x, y, cx, cy, bgcolor);
+		textFillArea(direct, x, y, cx, cy, bgcolor);
 		
 		/* Select the anchor position */
 		switch(justify) {
@@ -771,6 +2199,76 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		mf_render_aligned(font, x, y, justify, str, 0, gdispFillString_callback, &state);
 	}
 
+	#if GDISP_NEED_ASYNC
+		/**
+		 * @brief   Draw a text record from the command ring.
+		 * @pre		The gdisp mutex must be held.
+		 *
+		 * @notapi
+		 */
+		static void textRenderRing(const ringText *pt) {
+			const char	*str;
+
+			str = (const char *)(pt+1);
+			switch(pt->mode) {
+			case TEXT_CHAR:
+				textDrawChar(TRUE, pt->x, pt->y, pt->c, pt->font, pt->color);
+				break;
+			case TEXT_CHAR|TEXT_FILL:
+				textFillChar(TRUE, pt->x, pt->y, pt->c, pt->font, pt->color, pt->bgcolor);
+				break;
+			case TEXT_STRING:
+				textDrawString(TRUE, pt->x, pt->y, str, pt->font, pt->color);
+				break;
+			case TEXT_STRING|TEXT_FILL:
+				textFillString(TRUE, pt->x, pt->y, str, pt->font, pt->color, pt->bgcolor);
+				break;
+			case TEXT_STRINGBOX:
+				textDrawStringBox(TRUE, pt->x, pt->y, pt->cx, pt->cy, str, pt->font, pt->color, (justify_t)pt->justify);
+				break;
+			case TEXT_STRINGBOX|TEXT_FILL:
+				textFillStringBox(TRUE, pt->x, pt->y, pt->cx, pt->cy, str, pt->font, pt->color, pt->bgcolor, (justify_t)pt->justify);
+				break;
+			}
+		}
+	#endif
+
+	void gdispDrawChar(coord_t x, coord_t y, uint16_t c, font_t font, color_t color) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_CHAR, x, y, 0, 0, c, 0, font, color, color, justifyLeft);
+		textDrawChar(FALSE, x, y, c, font, color);
+	}
+
+	void gdispFillChar(coord_t x, coord_t y, uint16_t c, font_t font, color_t color, color_t bgcolor) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_CHAR|TEXT_FILL, x, y, 0, 0, c, 0, font, color, bgcolor, justifyLeft);
+		textFillChar(FALSE, x, y, c, font, color, bgcolor);
+	}
+
+	void gdispDrawString(coord_t x, coord_t y, const char *str, font_t font, color_t color) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_STRING, x, y, 0, 0, 0, str, font, color, color, justifyLeft);
+		textDrawString(FALSE, x, y, str, font, color);
+	}
+
+	void gdispFillString(coord_t x, coord_t y, const char *str, font_t font, color_t color, color_t bgcolor) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_STRING|TEXT_FILL, x, y, 0, 0, 0, str, font, color, bgcolor, justifyLeft);
+		textFillString(FALSE, x, y, str, font, color, bgcolor);
+	}
+
+	void gdispDrawStringBox(coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, justify_t justify) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_STRINGBOX, x, y, cx, cy, 0, str, font, color, color, justify);
+		textDrawStringBox(FALSE, x, y, cx, cy, str, font, color, justify);
+	}
+
+	void gdispFillStringBox(coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, color_t color, color_t bgcolor, justify_t justify) {
+		/* No mutex required as we only call high level functions which have their own mutex */
+		TEXT_QUEUE(TEXT_STRINGBOX|TEXT_FILL, x, y, cx, cy, 0, str, font, color, bgcolor, justify);
+		textFillStringBox(FALSE, x, y, cx, cy, str, font, color, bgcolor, justify);
+	}
+
 	coord_t gdispGetFontMetric(font_t font, fontmetric_t metric) {
 		/* No mutex required as we only read static data */
 		switch(metric) {
@@ -793,39 +2291,598 @@ void gdispDrawBox(coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
 		/* No mutex required as we only read static data */
 		return mf_get_string_width(font, str, 0, 0);
 	}
+
+	#if GDISP_NEED_TEXT_LAYOUT
+		#define TLAYOUT_GROW		32				// The number of characters to add to a layout at a time
+
+		typedef struct textLayoutState {
+			GTextLayout *	pl;
+			int16_t			y;						// The top of the current line
+			bool_t			nomem;
+		} textLayoutState;
+
+		/* Callback to save each character of a line */
+		static uint8_t textLayoutChar(int16_t x, int16_t y, mf_char c, void *state) {
+			textLayoutState *	ps;
+			GTextLayout *		pl;
+			GTextLayoutGlyph *	pg;
+			uint8_t				w;
+
+			ps = (textLayoutState *)state;
+			pl = ps->pl;
+			w = mf_character_width(pl->font, c);
+			if (pl->count >= pl->size) {
+				if (ps->nomem)
+					return w;
+				if (!(pg = (GTextLayoutGlyph *)gfxRealloc(pl->glyphs, pl->size * sizeof(GTextLayoutGlyph), (pl->size + TLAYOUT_GROW) * sizeof(GTextLayoutGlyph)))) {
+					ps->nomem = TRUE;
+					return w;
+				}
+				pl->glyphs = pg;
+				pl->size += TLAYOUT_GROW;
+			}
+			pg = &pl->glyphs[pl->count++];
+			pg->x = x;
+			pg->y = y;
+			pg->c = c;
+			pg->width = w;
+			return w;
+		}
+
+		/* Callback to position each line from the word wrapper */
+		static bool textLayoutLine(mf_str line, uint16_t count, void *state) {
+			textLayoutState *	ps;
+			GTextLayout *		pl;
+			GTextLayoutGlyph *	pg;
+			uint16_t			first;
+			coord_t				x0, x1;
+
+			// A count of 0 would mean the rest of the string
+			if (!count)
+				return FALSE;
+
+			ps = (textLayoutState *)state;
+			pl = ps->pl;
+			first = pl->count;
+			mf_render_aligned(pl->font, 0, ps->y, (enum mf_align_t)pl->justify, line, count, textLayoutChar, ps);
+
+			/* Right justified lines are laid out from the end so find the extent of the line */
+			if (pl->count > first) {
+				x0 = 0x7FFF;
+				x1 = -0x7FFF;
+				for(pg = &pl->glyphs[first]; pg < &pl->glyphs[pl->count]; pg++) {
+					if (pg->x < x0)
+						x0 = pg->x;
+					if (pg->x + pg->width > x1)
+						x1 = pg->x + pg->width;
+				}
+				if (x1 - x0 > pl->width)
+					pl->width = x1 - x0;
+			}
+			ps->y += pl->font->line_height;
+			pl->lines++;
+			return !ps->nomem;
+		}
+
+		/* Draw a layout. If direct is TRUE the display is already owned. */
+		static void textRenderLayout(bool_t direct, const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t *colors, bool_t fill) {
+			const GTextLayoutGlyph	*pg, *pe;
+			coord_t					ax, ay, gx, gy, liney, inkend;
+
+			if (fill)
+				textFillArea(direct, x, y, cx, cy, colors[1]);
+			if (!pl->font || !pl->count)
+				return;
+
+			/* The same anchor position as the string box routines */
+			switch(pl->justify) {
+			case justifyCenter:
+				ax = x + (cx + 1) / 2;
+				break;
+			case justifyRight:
+				ax = x + cx;
+				break;
+			default:	// justifyLeft
+				ax = x + pl->font->baseline_x;
+				break;
+			}
+			ay = y + (cy+1 - pl->height)/2;
+
+			liney = ay + pl->glyphs[0].y;
+			inkend = x;
+			for(pg = pl->glyphs, pe = pg + pl->count; pg < pe; pg++) {
+				gx = ax + pg->x;
+				gy = ay + pg->y;
+				if (gx < x || gx + pg->width >= x + cx || gy < y || gy + pl->font->height > y + cy)
+					continue;
+				if (gy != liney) {
+					liney = gy;
+					inkend = x;
+				}
+				textRenderChar(direct, pl->font, gx, gy, pg->c, colors, fill, fill ? &inkend : 0);
+			}
+		}
+
+		void gdispTextLayoutInit(GTextLayout *pl) {
+			pl->glyphs = 0;
+			pl->count = 0;
+			pl->size = 0;
+			pl->lines = 0;
+			pl->width = 0;
+			pl->height = 0;
+			pl->font = 0;
+			pl->justify = justifyLeft;
+			pl->wrapwidth = 0;
+			pl->len = 0;
+			pl->hash = 0;
+		}
+
+		bool_t gdispTextLayoutSet(GTextLayout *pl, const char *str, font_t font, justify_t justify, coord_t wrapwidth) {
+			textLayoutState	state;
+			const char *	p;
+			uint32_t		hash;
+
+			/* Keep the layout if nothing has changed */
+			for(hash = 2166136261UL, p = str; *p; p++)
+				hash = (hash ^ (uint8_t)*p) * 16777619UL;
+			if (pl->font == font && pl->justify == justify && pl->wrapwidth == wrapwidth && pl->len == (size_t)(p - str) && pl->hash == hash)
+				return TRUE;
+
+			pl->count = 0;
+			pl->lines = 0;
+			pl->width = 0;
+			pl->height = 0;
+			pl->font = font;
+			pl->justify = justify;
+			pl->wrapwidth = wrapwidth;
+			pl->len = p - str;
+			pl->hash = hash;
+
+			state.pl = pl;
+			state.y = 0;
+			state.nomem = FALSE;
+			if (wrapwidth < 0) {
+				/* One line - any newlines are drawn just as the string box routines draw them */
+				textLayoutLine(str, (uint16_t)pl->len, &state);
+			} else {
+				/* Every line must fit at least one character or the word wrapper can't make progress */
+				if (!wrapwidth)
+					wrapwidth = 0x7FFF;
+				else if (wrapwidth < font->max_x_advance)
+					wrapwidth = font->max_x_advance;
+				mf_wordwrap(font, wrapwidth, str, textLayoutLine, &state);
+			}
+			if (state.nomem) {
+				gdispTextLayoutFree(pl);
+				return FALSE;
+			}
+			if (pl->lines)
+				pl->height = (pl->lines - 1) * font->line_height + font->height;
+			return TRUE;
+		}
+
+		void gdispTextLayoutFree(GTextLayout *pl) {
+			if (pl->glyphs)
+				gfxFree(pl->glyphs);
+			gdispTextLayoutInit(pl);
+		}
+
+		void gdispDrawTextLayout(const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color) {
+			/* No mutex required as we only call high level functions which have their own mutex */
+			textRenderLayout(FALSE, pl, x, y, cx, cy, &color, FALSE);
+		}
+
+		void gdispFillTextLayout(const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy, color_t color, color_t bgcolor) {
+			color_t		state[2];
+
+			/* No mutex required as we only call high level functions which have their own mutex */
+			state[0] = color;
+			state[1] = bgcolor;
+			textRenderLayout(FALSE, pl, x, y, cx, cy, state, TRUE);
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_CONTEXT
+	static coord_t	ctxSaved[4];		// The gdisp clip area while drawing through a context (protected by the mutex)
+
+	/**
+	 * @brief   Clip an area (in display coordinates) to a context.
+	 * @return	FALSE if nothing is left to draw
+	 *
+	 * @notapi
+	 */
+	static bool_t ctxClipArea(const GDisplayContext *pc, coord_t *px, coord_t *py, coord_t *pcx, coord_t *pcy) {
+		coord_t		x1, y1;
+
+		x1 = *px + *pcx;
+		y1 = *py + *pcy;
+		if (*px < pc->clipx0) *px = pc->clipx0;
+		if (*py < pc->clipy0) *py = pc->clipy0;
+		if (x1 > pc->clipx1) x1 = pc->clipx1;
+		if (y1 > pc->clipy1) y1 = pc->clipy1;
+		*pcx = x1 - *px;
+		*pcy = y1 - *py;
+		return *pcx > 0 && *pcy > 0;
+	}
+
+	/**
+	 * @brief   Lock the display and clip to a context for drawing that can't easily be clipped beforehand.
+	 * @return	FALSE (and the display is not locked) if nothing in the context is visible
+	 * @note	The gdisp clip is restored by ctxExit() before the display is unlocked
+	 * 			so other threads never see the context clip.
+	 *
+	 * @notapi
+	 */
+	static bool_t ctxEnter(const GDisplayContext *pc) {
+		coord_t		x0, y0, x1, y1;
+
+		MUTEX_ENTER();
+		ctxSaved[0] = GDISP.clipx0; ctxSaved[1] = GDISP.clipy0;
+		ctxSaved[2] = GDISP.clipx1; ctxSaved[3] = GDISP.clipy1;
+		x0 = pc->clipx0 > ctxSaved[0] ? pc->clipx0 : ctxSaved[0];
+		y0 = pc->clipy0 > ctxSaved[1] ? pc->clipy0 : ctxSaved[1];
+		x1 = pc->clipx1 < ctxSaved[2] ? pc->clipx1 : ctxSaved[2];
+		y1 = pc->clipy1 < ctxSaved[3] ? pc->clipy1 : ctxSaved[3];
+		if (x1 <= x0 || y1 <= y0) {
+			MUTEX_EXIT();
+			return FALSE;
+		}
+		gdisp_lld_set_clip(x0, y0, x1-x0, y1-y0);
+		return TRUE;
+	}
+
+	/**
+	 * @brief   Restore the gdisp clip and unlock the display after ctxEnter().
+	 *
+	 * @param[in] x,y,cx,cy		The area that may have been drawn (for GDISP_NEED_AUTOFLUSH)
+	 *
+	 * @notapi
+	 */
+	static void ctxExit(coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		AUTOFLUSH_MARK(x, y, cx, cy);
+		gdisp_lld_set_clip(ctxSaved[0], ctxSaved[1], ctxSaved[2]-ctxSaved[0], ctxSaved[3]-ctxSaved[1]);
+		MUTEX_EXIT();
+		(void) x; (void) y; (void) cx; (void) cy;
+	}
+
+	#if GDISP_NEED_LIST
+		/* While recording a display list, context drawing is recorded as a clip change, the drawing
+		 * and then a change back to the clip the list had before.
+		 */
+		static void ctxRecordClip(const GDisplayContext *pc, coord_t *saved) {
+			memcpy(saved, listClip, sizeof(listClip));
+			listOp(LIST_OP_SETCLIP, pc->clipx0, pc->clipy0, pc->clipx1-pc->clipx0, pc->clipy1-pc->clipy0, 0);
+		}
+		#define CTX_RECORD(pc, fn)		{ if (LIST_RECORDING()) { coord_t sc[4]; ctxRecordClip(pc, sc); fn; listOp(LIST_OP_SETCLIP, sc[0], sc[1], sc[2], sc[3], 0); return; } }
+	#else
+		#define CTX_RECORD(pc, fn)
+	#endif
+
+	void gdispCtxInit(GDisplayContext *pc) {
+		pc->clipx0 = 0;
+		pc->clipy0 = 0;
+		pc->clipx1 = GDISP.Width;
+		pc->clipy1 = GDISP.Height;
+		pc->ox = 0;
+		pc->oy = 0;
+		pc->color = White;
+		pc->bgcolor = Black;
+	}
+
+	void gdispCtxSetClip(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		if (cx < 0) cx = 0;
+		if (cy < 0) cy = 0;
+		pc->clipx0 = pc->ox + x;
+		pc->clipy0 = pc->oy + y;
+		pc->clipx1 = pc->clipx0 + cx;
+		pc->clipy1 = pc->clipy0 + cy;
+	}
+
+	void gdispCtxClear(GDisplayContext *pc) {
+		gdispFillArea(pc->clipx0, pc->clipy0, pc->clipx1-pc->clipx0, pc->clipy1-pc->clipy0, pc->bgcolor);
+	}
+
+	/* Rectangular drawing is clipped here and then drawn normally so the clip is never changed */
+
+	void gdispCtxDrawPixel(GDisplayContext *pc, coord_t x, coord_t y) {
+		x += pc->ox;
+		y += pc->oy;
+		if (x >= pc->clipx0 && x < pc->clipx1 && y >= pc->clipy0 && y < pc->clipy1)
+			gdispDrawPixel(x, y, pc->color);
+	}
+
+	void gdispCtxFillArea(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		x += pc->ox;
+		y += pc->oy;
+		if (ctxClipArea(pc, &x, &y, &cx, &cy))
+			gdispFillArea(x, y, cx, cy, pc->color);
+	}
+
+	void gdispCtxBlitAreaEx(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const pixel_t *buffer) {
+		coord_t		x0, y0;
+
+		x0 = x += pc->ox;
+		y0 = y += pc->oy;
+		if (ctxClipArea(pc, &x, &y, &cx, &cy))
+			gdispBlitAreaEx(x, y, cx, cy, srcx + x - x0, srcy + y - y0, srccx, buffer);
+	}
+
+	void gdispCtxDrawBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+		if (cx <= 0 || cy <= 0)
+			return;
+		gdispCtxFillArea(pc, x, y, cx, 1);
+		if (cy > 1) {
+			gdispCtxFillArea(pc, x, y+cy-1, cx, 1);
+			if (cy > 2) {
+				gdispCtxFillArea(pc, x, y+1, 1, cy-2);
+				if (cx > 1)
+					gdispCtxFillArea(pc, x+cx-1, y+1, 1, cy-2);
+			}
+		}
+	}
+
+	/* Everything else is drawn with the context clip applied while the display is locked */
+
+	void gdispCtxDrawLine(GDisplayContext *pc, coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+		x0 += pc->ox; y0 += pc->oy;
+		x1 += pc->ox; y1 += pc->oy;
+		CTX_RECORD(pc, gdispDrawLine(x0, y0, x1, y1, pc->color));
+		if (!ctxEnter(pc))
+			return;
+		gdisp_lld_draw_line(x0, y0, x1, y1, pc->color);
+		ctxExit(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, (x0 < x1 ? x1-x0 : x0-x1)+1, (y0 < y1 ? y1-y0 : y0-y1)+1);
+	}
+
+	#if GDISP_NEED_CIRCLE
+		void gdispCtxDrawCircle(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispDrawCircle(x, y, radius, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_draw_circle(x, y, radius, pc->color);
+			ctxExit(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		}
+
+		void gdispCtxFillCircle(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispFillCircle(x, y, radius, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_fill_circle(x, y, radius, pc->color);
+			ctxExit(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		}
+	#endif
+
+	#if GDISP_NEED_ELLIPSE
+		void gdispCtxDrawEllipse(GDisplayContext *pc, coord_t x, coord_t y, coord_t a, coord_t b) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispDrawEllipse(x, y, a, b, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_draw_ellipse(x, y, a, b, pc->color);
+			ctxExit(x-a, y-b, 2*a+1, 2*b+1);
+		}
+
+		void gdispCtxFillEllipse(GDisplayContext *pc, coord_t x, coord_t y, coord_t a, coord_t b) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispFillEllipse(x, y, a, b, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_fill_ellipse(x, y, a, b, pc->color);
+			ctxExit(x-a, y-b, 2*a+1, 2*b+1);
+		}
+	#endif
+
+	#if GDISP_NEED_ARC
+		void gdispCtxDrawArc(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispDrawArc(x, y, radius, startangle, endangle, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_draw_arc(x, y, radius, startangle, endangle, pc->color);
+			ctxExit(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		}
+
+		void gdispCtxFillArc(GDisplayContext *pc, coord_t x, coord_t y, coord_t radius, coord_t startangle, coord_t endangle) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, gdispFillArc(x, y, radius, startangle, endangle, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			gdisp_lld_fill_arc(x, y, radius, startangle, endangle, pc->color);
+			ctxExit(x-radius, y-radius, 2*radius+1, 2*radius+1);
+		}
+	#endif
+
+	#if GDISP_NEED_TEXT
+		/* Text is rendered directly to the low level driver which marks what it draws */
+
+		void gdispCtxDrawString(GDisplayContext *pc, coord_t x, coord_t y, const char *str, font_t font) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, textDrawString(FALSE, x, y, str, font, pc->color));
+			if (!ctxEnter(pc))
+				return;
+			textDrawString(TRUE, x, y, str, font, pc->color);
+			ctxExit(0, 0, 0, 0);
+		}
+
+		void gdispCtxFillString(GDisplayContext *pc, coord_t x, coord_t y, const char *str, font_t font) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, textFillString(FALSE, x, y, str, font, pc->color, pc->bgcolor));
+			if (!ctxEnter(pc))
+				return;
+			textFillString(TRUE, x, y, str, font, pc->color, pc->bgcolor);
+			ctxExit(0, 0, 0, 0);
+		}
+
+		void gdispCtxDrawStringBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, justify_t justify) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, textDrawStringBox(FALSE, x, y, cx, cy, str, font, pc->color, justify));
+			if (!ctxEnter(pc))
+				return;
+			textDrawStringBox(TRUE, x, y, cx, cy, str, font, pc->color, justify);
+			ctxExit(0, 0, 0, 0);
+		}
+
+		void gdispCtxFillStringBox(GDisplayContext *pc, coord_t x, coord_t y, coord_t cx, coord_t cy, const char* str, font_t font, justify_t justify) {
+			x += pc->ox;
+			y += pc->oy;
+			CTX_RECORD(pc, textFillStringBox(FALSE, x, y, cx, cy, str, font, pc->color, pc->bgcolor, justify));
+			if (!ctxEnter(pc))
+				return;
+			textFillStringBox(TRUE, x, y, cx, cy, str, font, pc->color, pc->bgcolor, justify);
+			ctxExit(0, 0, 0, 0);
+		}
+
+		#if GDISP_NEED_TEXT_LAYOUT
+			void gdispCtxDrawTextLayout(GDisplayContext *pc, const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+				x += pc->ox;
+				y += pc->oy;
+				CTX_RECORD(pc, textRenderLayout(FALSE, pl, x, y, cx, cy, &pc->color, FALSE));
+				if (!ctxEnter(pc))
+					return;
+				textRenderLayout(TRUE, pl, x, y, cx, cy, &pc->color, FALSE);
+				ctxExit(0, 0, 0, 0);
+			}
+
+			void gdispCtxFillTextLayout(GDisplayContext *pc, const GTextLayout *pl, coord_t x, coord_t y, coord_t cx, coord_t cy) {
+				color_t		state[2];
+
+				x += pc->ox;
+				y += pc->oy;
+				state[0] = pc->color;
+				state[1] = pc->bgcolor;
+				CTX_RECORD(pc, textRenderLayout(FALSE, pl, x, y, cx, cy, state, TRUE));
+				if (!ctxEnter(pc))
+					return;
+				textRenderLayout(TRUE, pl, x, y, cx, cy, state, TRUE);
+				ctxExit(0, 0, 0, 0);
+			}
+		#endif
+	#endif
 #endif
 
 color_t gdispBlendColor(color_t fg, color_t bg, uint8_t alpha)
 {
-	uint16_t fg_ratio = alpha + 1;
-	uint16_t bg_ratio = 256 - alpha;
-	uint16_t r, g, b;
-	
-	r = RED_OF(fg) * fg_ratio;
-	g = GREEN_OF(fg) * fg_ratio;
-	b = BLUE_OF(fg) * fg_ratio;
-	
-	r += RED_OF(bg) * bg_ratio;
-	g += GREEN_OF(bg) * bg_ratio;
-	b += BLUE_OF(bg) * bg_ratio;
-	
-	r /= 256;
-	g /= 256;
-	b /= 256;
-	
-	return RGB2COLOR(r, g, b);
+	return gdisp_lld_blend_color(fg, bg, alpha);
 }
 
-#if (!defined(gdispPackPixels) && !defined(GDISP_PIXELFORMAT_CUSTOM))
+#if GDISP_NEED_CONVERT
+	/**
+	 * How many pixels gdispBlitConvert() converts at a time
+	 */
+	#define CONVERT_BLIT_SIZE	64
+
+	/* Blit some converted pixels */
+	static void blitConverted(coord_t x, coord_t y, coord_t cx, coord_t cy, pixel_t *buf) {
+		#if GDISP_NEED_LIST
+			/* The buffer is about to be reused so record the colors instead of a pointer to it */
+			if (LIST_RECORDING()) {
+				coord_t		i, j, n;
+
+				for(j = 0; j < cy; j++, buf += cx) {
+					for(i = 0; i < cx; i += n) {
+						for(n = 1; i+n < cx && buf[i+n] == buf[i]; n++);
+						gdispFillArea(x+i, y+j, n, 1, buf[i]);
+					}
+				}
+				return;
+			}
+		#endif
+		#if GDISP_PACKED_PIXELS
+		{
+			coord_t		i, j;
+
+			/* A packed pixel is never bigger than a color_t so this can be done in place */
+			for(j = 0; j < cy; j++)
+				for(i = 0; i < cx; i++)
+					gdispPackPixels(buf, cx, i, j, buf[j*cx+i]);
+		}
+		#endif
+		gdispBlitAreaEx(x, y, cx, cy, 0, 0, cx, buf);
+	}
+
+	void gdispBlitConvert(coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t srcx, coord_t srcy, coord_t srccx, const void *buffer, unsigned srcfmt, const color_t *palette) {
+		pixel_t			buf[CONVERT_BLIT_SIZE];
+		const uint8_t *	src;
+		size_t			stride;
+		coord_t			i, j, n, rows;
+
+		#if !GDISP_PACKED_PIXELS
+			/* Nothing to convert */
+			if (srcfmt == GDISP_PIXELFORMAT) {
+				gdispBlitAreaEx(x, y, cx, cy, srcx, srcy, srccx, (const pixel_t *)buffer);
+				return;
+			}
+		#endif
+
+		if (cx <= 0 || cy <= 0 || !(stride = gdispConvertSize(srcfmt, srccx)))
+			return;
+		src = (const uint8_t *)buffer + srcy * stride;
+
+		/* Narrow areas are converted several lines at a time */
+		if (cx <= CONVERT_BLIT_SIZE) {
+			rows = CONVERT_BLIT_SIZE / cx;
+			for(; cy > 0; cy -= n, y += n) {
+				n = cy > rows ? rows : cy;
+				for(j = 0; j < n; j++, src += stride) {
+					if (!gdispConvertPixelsEx(buf + j*cx, GDISP_PIXELFORMAT, src, srcfmt, srcx, cx, palette))
+						return;
+				}
+				blitConverted(x, y, cx, n, buf);
+			}
+			return;
+		}
+
+		/* Wide areas are converted a piece of a line at a time */
+		for(; cy > 0; cy--, y++, src += stride) {
+			for(i = 0; i < cx; i += n) {
+				n = cx - i > CONVERT_BLIT_SIZE ? CONVERT_BLIT_SIZE : cx - i;
+				if (!gdispConvertPixelsEx(buf, GDISP_PIXELFORMAT, src, srcfmt, srcx+i, n, palette))
+					return;
+				blitConverted(x+i, y, n, 1, buf);
+			}
+		}
+	}
+#endif
+
+#if !defined(gdispPackPixels) && GDISP_PIXELFORMAT != GDISP_PIXELFORMAT_CUSTOM
 	void gdispPackPixels(pixel_t *buf, coord_t cx, coord_t x, coord_t y, color_t color) {
+		uint8_t		*p;
+
 		/* No mutex required as we only read static data */
-		#if defined(GDISP_PIXELFORMAT_RGB888)
-			#error "GDISP: Packed pixels not supported yet"
-		#elif defined(GDISP_PIXELFORMAT_RGB444)
-			#error "GDISP: Packed pixels not supported yet"
-		#elif defined(GDISP_PIXELFORMAT_RGB666)
-			#error "GDISP: Packed pixels not supported yet"
-		#elif
+		#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+			/* 3 bytes per pixel - R, G, B */
+			p = (uint8_t *)buf + ((size_t)y * cx + x) * 3;
+			p[0] = RED_OF(color);
+			p[1] = GREEN_OF(color);
+			p[2] = BLUE_OF(color);
+		#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB444
+			/* 2 pixels in 3 bytes - RRRRGGGG BBBBRRRR GGGGBBBB. Each line starts on a byte boundary. */
+			p = (uint8_t *)buf + (size_t)y * ((cx * 3 + 1) / 2) + (x >> 1) * 3;
+			if (x & 1) {
+				p[1] = (uint8_t)((p[1] & 0xF0) | ((color >> 8) & 0x0F));
+				p[2] = (uint8_t)color;
+			} else {
+				p[0] = (uint8_t)(color >> 4);
+				p[1] = (uint8_t)((p[1] & 0x0F) | ((color & 0x0F) << 4));
+			}
+		#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB666
+			/* 3 bytes per pixel - R, G, B each in the top 6 bits of the byte */
+			p = (uint8_t *)buf + ((size_t)y * cx + x) * 3;
+			p[0] = (uint8_t)((color >> 10) & 0xFC);
+			p[1] = (uint8_t)((color >> 4) & 0xFC);
+			p[2] = (uint8_t)((color << 2) & 0xFC);
+		#else
 			#error "GDISP: Unsupported packed pixel format"
 		#endif
 	}
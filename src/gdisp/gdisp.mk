@@ -1,5 +1,6 @@
 GFXSRC +=   $(GFXLIB)/src/gdisp/gdisp.c \
 			$(GFXLIB)/src/gdisp/fonts.c \
+			$(GFXLIB)/src/gdisp/convert.c \
 			$(GFXLIB)/src/gdisp/image.c \
 			$(GFXLIB)/src/gdisp/image_native.c \
 			$(GFXLIB)/src/gdisp/image_gif.c \
@@ -28,36 +28,72 @@ typedef struct gdispImageHandlers {
 							coord_t cx, coord_t cy,
 							coord_t sx, coord_t sy);	/* The draw function */
 	delaytime_t		(*next)(gdispImage *img);			/* The next frame function */
+	#if GDISP_NEED_IMAGE_TRANSFORM
+		gdispImageError	(*rows)(gdispImage *img,
+								gdispImageRows *pr);		/* The decode whole rows function */
+	#endif
 } gdispImageHandlers;
 
 static gdispImageHandlers ImageHandlers[] = {
 	#if GDISP_NEED_IMAGE_NATIVE
 		{	gdispImageOpen_NATIVE,	gdispImageClose_NATIVE,
 			gdispImageCache_NATIVE,	gdispImageDraw_NATIVE,	gdispImageNext_NATIVE,
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				gdispImageRows_NATIVE,
+			#endif
 		},
 	#endif
 	#if GDISP_NEED_IMAGE_GIF
 		{	gdispImageOpen_GIF,		gdispImageClose_GIF,
 			gdispImageCache_GIF,	gdispImageDraw_GIF,		gdispImageNext_GIF,
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				gdispImageRows_GIF,
+			#endif
 		},
 	#endif
 	#if GDISP_NEED_IMAGE_BMP
 		{	gdispImageOpen_BMP,		gdispImageClose_BMP,
 			gdispImageCache_BMP,	gdispImageDraw_BMP,		gdispImageNext_BMP,
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				gdispImageRows_BMP,
+			#endif
 		},
 	#endif
 	#if GDISP_NEED_IMAGE_JPG
 		{	gdispImageOpen_JPG,		gdispImageClose_JPG,
 			gdispImageCache_JPG,	gdispImageDraw_JPG,		gdispImageNext_JPG,
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				gdispImageRows_JPG,
+			#endif
 		},
 	#endif
 	#if GDISP_NEED_IMAGE_PNG
 		{	gdispImageOpen_PNG,		gdispImageClose_PNG,
 			gdispImageCache_PNG,	gdispImageDraw_PNG,		gdispImageNext_PNG,
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				gdispImageRows_PNG,
+			#endif
 		},
 	#endif
 };
 
+#if GDISP_NEED_IMAGE_SHARED_CACHE
+	/* Identify an image file by a hash of its name, its modification time and its size */
+	static void imageSourceFile(gdispImage *img, const char *filename, uint32_t stamp, uint32_t size) {
+		uint32_t	h;
+
+		for(h = 2166136261UL; *filename; filename++)
+			h = (h ^ (uint8_t)*filename) * 16777619UL;
+		img->src.ptr = 0;
+		img->src.hash = h;
+		img->src.stamp = stamp;
+		img->src.size = size;
+	}
+	#define imageSourceClear(img)		memset(&(img)->src, 0, sizeof((img)->src))
+#else
+	#define imageSourceClear(img)
+#endif
+
 static size_t ImageMemoryRead(struct gdispImageIO *pio, void *buf, size_t len) {
 	if (pio->fd == (void *)-1) return 0;
 	memcpy(buf, ((const char *)pio->fd)+pio->pos, len);
@@ -75,13 +111,24 @@ static void ImageMemoryClose(struct gdispImageIO *pio) {
 	pio->pos = 0;
 }
 
+static const void *ImageMemoryPeek(struct gdispImageIO *pio, size_t len) {
+	(void) len;
+
+	if (pio->fd == (void *)-1) return 0;
+	return ((const char *)pio->fd)+pio->pos;
+}
+
 static const gdispImageIOFunctions ImageMemoryFunctions =
-	{ ImageMemoryRead, ImageMemorySeek, ImageMemoryClose };
+	{ ImageMemoryRead, ImageMemorySeek, ImageMemoryClose, ImageMemoryPeek };
 
 bool_t gdispImageSetMemoryReader(gdispImage *img, const void *memimage) {
 	img->io.fns = &ImageMemoryFunctions;
 	img->io.pos = 0;
 	img->io.fd = memimage;
+	#if GDISP_NEED_IMAGE_SHARED_CACHE
+		imageSourceClear(img);
+		img->src.ptr = memimage;
+	#endif
 	return TRUE;
 }
 
@@ -109,18 +156,23 @@ bool_t gdispImageSetMemoryReader(gdispImage *img, const void *memimage) {
 	}
 
 	static const gdispImageIOFunctions ImageBaseFileStreamFunctions =
-		{ ImageBaseFileStreamRead, ImageBaseFileStreamSeek, ImageBaseFileStreamClose };
+		{ ImageBaseFileStreamRead, ImageBaseFileStreamSeek, ImageBaseFileStreamClose, 0 };
 
 	bool_t gdispImageSetBaseFileStreamReader(gdispImage *img, void *BaseFileStreamPtr) {
 		img->io.fns = &ImageBaseFileStreamFunctions;
 		img->io.pos = 0;
 		img->io.fd = BaseFileStreamPtr;
+		imageSourceClear(img);
 		return TRUE;
 	}
 #endif
 
 #if defined(WIN32) || GFX_USE_OS_WIN32 || GFX_USE_OS_LINUX || GFX_USE_OS_OSX
 	#include <stdio.h>
+	#if GDISP_NEED_IMAGE_SHARED_CACHE
+		#include <sys/types.h>
+		#include <sys/stat.h>
+	#endif
 
 	static size_t ImageFileRead(struct gdispImageIO *pio, void *buf, size_t len) {
 		if (!pio->fd) return 0;
@@ -146,7 +198,7 @@ bool_t gdispImageSetMemoryReader(gdispImage *img, const void *memimage) {
 	}
 
 	static const gdispImageIOFunctions ImageFileFunctions =
-		{ ImageFileRead, ImageFileSeek, ImageFileClose };
+		{ ImageFileRead, ImageFileSeek, ImageFileClose, 0 };
 
 	bool_t gdispImageSetFileReader(gdispImage *img, const char *filename) {
 		img->io.fns = &ImageFileFunctions;
@@ -156,15 +208,108 @@ bool_t gdispImageSetMemoryReader(gdispImage *img, const void *memimage) {
 		#else
 			img->io.fd = (void *)fopen(filename, "r");
 		#endif
+		#if GDISP_NEED_IMAGE_SHARED_CACHE
+			{
+				struct stat	st;
+
+				if (img->io.fd && !stat(filename, &st))
+					imageSourceFile(img, filename, (uint32_t)st.st_mtime, (uint32_t)st.st_size);
+				else
+					imageSourceClear(img);
+			}
+		#endif
 
 		return img->io.fd != 0;
 	}
 #endif
 
+#if GFX_USE_OS_LINUX
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+
+	typedef struct ImageMappedFile {
+		const uint8_t *	base;
+		size_t			size;
+	} ImageMappedFile;
+
+	static size_t ImageMappedFileRead(struct gdispImageIO *pio, void *buf, size_t len) {
+		const ImageMappedFile *	mf;
+
+		if (!(mf = (const ImageMappedFile *)pio->fd) || pio->pos >= mf->size) return 0;
+		if (len > mf->size - pio->pos)
+			len = mf->size - pio->pos;
+		memcpy(buf, mf->base+pio->pos, len);
+		pio->pos += len;
+		return len;
+	}
+
+	static void ImageMappedFileSeek(struct gdispImageIO *pio, size_t pos) {
+		if (!pio->fd) return;
+		pio->pos = pos;
+	}
+
+	static void ImageMappedFileClose(struct gdispImageIO *pio) {
+		const ImageMappedFile *	mf;
+
+		if (!(mf = (const ImageMappedFile *)pio->fd)) return;
+		munmap((void *)mf->base, mf->size);
+		gfxFree((void *)mf);
+		pio->fd = 0;
+		pio->pos = 0;
+	}
+
+	static const void *ImageMappedFilePeek(struct gdispImageIO *pio, size_t len) {
+		const ImageMappedFile *	mf;
+
+		if (!(mf = (const ImageMappedFile *)pio->fd) || pio->pos > mf->size || len > mf->size - pio->pos) return 0;
+		return mf->base+pio->pos;
+	}
+
+	static const gdispImageIOFunctions ImageMappedFileFunctions =
+		{ ImageMappedFileRead, ImageMappedFileSeek, ImageMappedFileClose, ImageMappedFilePeek };
+
+	bool_t gdispImageSetMappedFileReader(gdispImage *img, const char *filename) {
+		ImageMappedFile *	mf;
+		struct stat			st;
+		void *				p;
+		int					fd;
+
+		img->io.fns = &ImageMappedFileFunctions;
+		img->io.pos = 0;
+		img->io.fd = 0;
+		imageSourceClear(img);
+
+		if ((fd = open(filename, O_RDONLY)) < 0)
+			return FALSE;
+		if (fstat(fd, &st) || st.st_size <= 0 || (p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+			close(fd);
+			return FALSE;
+		}
+		close(fd);									// The mapping doesn't need the file to stay open
+
+		if (!(mf = (ImageMappedFile *)gfxAlloc(sizeof(ImageMappedFile)))) {
+			munmap(p, st.st_size);
+			return FALSE;
+		}
+		mf->base = (const uint8_t *)p;
+		mf->size = st.st_size;
+		img->io.fd = mf;
+		#if GDISP_NEED_IMAGE_SHARED_CACHE
+			imageSourceFile(img, filename, (uint32_t)st.st_mtime, (uint32_t)st.st_size);
+		#endif
+		return TRUE;
+	}
+#endif
+
 gdispImageError gdispImageOpen(gdispImage *img) {
 	gdispImageError err;
 
 	img->bgcolor = White;
+	#if GDISP_NEED_IMAGE_SHARED_CACHE
+		img->shared = 0;
+	#endif
 	for(img->fns = ImageHandlers; img->fns < ImageHandlers+sizeof(ImageHandlers)/sizeof(ImageHandlers[0]); img->fns++) {
 		err = img->fns->open(img);
 		if (err != GDISP_IMAGE_ERR_BADFORMAT) {
@@ -190,6 +335,7 @@ void gdispImageClose(gdispImage *img) {
 	img->flags = 0;
 	img->fns = 0;
 	img->priv = 0;
+	imageSourceClear(img);
 }
 
 bool_t gdispImageIsOpen(gdispImage *img) {
@@ -244,5 +390,635 @@ void gdispImageFree(gdispImage *img, void *ptr, size_t sz) {
 	#endif
 }
 
+const void *gdispImageGetBytes(gdispImage *img, void *buf, size_t len) {
+	const void *p;
+
+	/* Use the data in place if we can */
+	if (img->io.fns->peek && (p = img->io.fns->peek(&img->io, len))) {
+		img->io.fns->seek(&img->io, img->io.pos+len);
+		return p;
+	}
+	return img->io.fns->read(&img->io, buf, len) == len ? buf : 0;
+}
+
+#if GDISP_NEED_IMAGE_SHARED_CACHE
+	/**
+	 * The shared image cache.
+	 *	Each entry holds the frame0 cache pixels of one image source. Entries are kept in least
+	 *	recently used order and those that no open image is using are discarded when the cache
+	 *	would grow beyond GDISP_IMAGE_SHARED_CACHE_SIZE bytes. There are only ever a few entries
+	 *	so a list is all that is needed to find them.
+	 */
+	typedef struct gdispImageCacheEntry {
+		struct gdispImageCacheEntry *	next;		// The LRU list - most recently used first
+		struct gdispImageCacheEntry *	prev;
+		gdispImageSource				src;
+		gdispImageType					type;
+		color_t							bgcolor;	// Images with transparency are decoded against this
+		coord_t							width, height;
+		unsigned						refs;		// The number of open images using it
+		size_t							size;		// The size of the pixels
+		pixel_t *						pixels;
+	} gdispImageCacheEntry;
+
+	static gdispImageCacheEntry *	icacheHead;
+	static gdispImageCacheEntry *	icacheTail;
+	static gdispImageCacheStats		icacheStats;
+
+	#if GDISP_NEED_MULTITHREAD || GDISP_NEED_ASYNC
+		static gfxMutex			icacheMutex;
+		#define ICACHE_LOCK()	gfxMutexEnter(&icacheMutex)
+		#define ICACHE_UNLOCK()	gfxMutexExit(&icacheMutex)
+
+		/* Called by _gdispInit() */
+		void _gdispImageCacheInit(void) {
+			gfxMutexInit(&icacheMutex);
+		}
+	#else
+		#define ICACHE_LOCK()
+		#define ICACHE_UNLOCK()
+	#endif
+
+	static bool_t icacheMatch(const gdispImageCacheEntry *pe, const gdispImage *img) {
+		return pe->src.ptr == img->src.ptr && pe->src.hash == img->src.hash && pe->src.stamp == img->src.stamp
+				&& pe->src.size == img->src.size && pe->type == img->type && pe->bgcolor == img->bgcolor
+				&& pe->width == img->width && pe->height == img->height;
+	}
+
+	/* Unlink an entry. The cache must be locked. */
+	static void icacheUnlink(gdispImageCacheEntry *pe) {
+		if (pe->prev) pe->prev->next = pe->next;
+		else icacheHead = pe->next;
+		if (pe->next) pe->next->prev = pe->prev;
+		else icacheTail = pe->prev;
+	}
+
+	/* Link an entry in as the most recently used. The cache must be locked. */
+	static void icacheLinkHead(gdispImageCacheEntry *pe) {
+		pe->prev = 0;
+		pe->next = icacheHead;
+		if (icacheHead) icacheHead->prev = pe;
+		else icacheTail = pe;
+		icacheHead = pe;
+	}
+
+	/* Unlink an entry and free it. The cache must be locked. */
+	static void icacheDiscard(gdispImageCacheEntry *pe) {
+		icacheUnlink(pe);
+		icacheStats.entries--;
+		icacheStats.used -= pe->size;
+		gfxFree(pe->pixels);
+		gfxFree(pe);
+	}
+
+	pixel_t *gdispImageCacheFind(gdispImage *img) {
+		gdispImageCacheEntry *	pe;
+
+		if (!img->src.ptr && !img->src.hash)
+			return 0;
+
+		ICACHE_LOCK();
+		for(pe = icacheHead; pe; pe = pe->next) {
+			if (icacheMatch(pe, img)) {
+				if (pe->prev) {
+					icacheUnlink(pe);
+					icacheLinkHead(pe);
+				}
+				if (!pe->refs++)
+					icacheStats.inuse++;
+				icacheStats.hits++;
+				img->shared = pe;
+				ICACHE_UNLOCK();
+				return pe->pixels;
+			}
+		}
+		icacheStats.misses++;
+		ICACHE_UNLOCK();
+		return 0;
+	}
+
+	void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels) {
+		gdispImageCacheEntry *	pe;
+		gdispImageCacheEntry *	prev;
+		size_t					size;
+
+		if ((!img->src.ptr && !img->src.hash) || img->shared)
+			return;
+		size = (size_t)img->width * img->height * sizeof(pixel_t);
+		if (size > GDISP_IMAGE_SHARED_CACHE_SIZE)
+			return;
+
+		ICACHE_LOCK();
+
+		/* Another image may have got there first */
+		for(pe = icacheHead; pe; pe = pe->next) {
+			if (icacheMatch(pe, img)) {
+				ICACHE_UNLOCK();
+				return;
+			}
+		}
+
+		/* Make room for it. If we can't, the pixels just stay with this image */
+		for(pe = icacheTail; pe && icacheStats.used + size > GDISP_IMAGE_SHARED_CACHE_SIZE; pe = prev) {
+			prev = pe->prev;
+			if (!pe->refs) {
+				icacheDiscard(pe);
+				icacheStats.evictions++;
+			}
+		}
+		if (icacheStats.used + size > GDISP_IMAGE_SHARED_CACHE_SIZE || !(pe = (gdispImageCacheEntry *)gfxAlloc(sizeof(gdispImageCacheEntry)))) {
+			ICACHE_UNLOCK();
+			return;
+		}
+
+		/* The cache now owns the pixels */
+		pe->src = img->src;
+		pe->type = img->type;
+		pe->bgcolor = img->bgcolor;
+		pe->width = img->width;
+		pe->height = img->height;
+		pe->refs = 1;
+		pe->size = size;
+		pe->pixels = pixels;
+		icacheLinkHead(pe);
+		icacheStats.entries++;
+		icacheStats.inuse++;
+		icacheStats.used += size;
+		img->shared = pe;
+		#if GDISP_NEED_IMAGE_ACCOUNTING
+			img->memused -= size;
+		#endif
+		ICACHE_UNLOCK();
+	}
+
+	void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels) {
+		gdispImageCacheEntry *	pe;
+
+		if (!(pe = img->shared) || pe->pixels != pixels) {
+			gdispImageFree(img, (void *)pixels, (size_t)img->width * img->height * sizeof(pixel_t));
+			return;
+		}
+		ICACHE_LOCK();
+		if (!--pe->refs)
+			icacheStats.inuse--;
+		ICACHE_UNLOCK();
+		img->shared = 0;
+	}
+
+	void gdispImageGetCacheStats(gdispImageCacheStats *stats) {
+		ICACHE_LOCK();
+		*stats = icacheStats;
+		ICACHE_UNLOCK();
+		stats->size = GDISP_IMAGE_SHARED_CACHE_SIZE;
+	}
+
+	void gdispImageFlushCache(void) {
+		gdispImageCacheEntry *	pe;
+		gdispImageCacheEntry *	next;
+
+		ICACHE_LOCK();
+		for(pe = icacheHead; pe; pe = next) {
+			next = pe->next;
+			if (!pe->refs)
+				icacheDiscard(pe);
+		}
+		ICACHE_UNLOCK();
+	}
+#else
+	pixel_t *gdispImageCacheFind(gdispImage *img) {
+		(void) img;
+		return 0;
+	}
+
+	void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels) {
+		(void) img;
+		(void) pixels;
+	}
+
+	void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels) {
+		gdispImageFree(img, (void *)pixels, (size_t)img->width * img->height * sizeof(pixel_t));
+	}
+#endif
+
+#if GDISP_NEED_IMAGE_TRANSFORM
+	#include <math.h>
+
+	/**
+	 * How many pixels to collect before blitting them.
+	 * Bigger is faster but uses more stack.
+	 */
+	#define TRANSFORM_BUFFER_SIZE	64
+	#define TRANSFORM_MAX			8191			// The biggest image or area - keeps the 16.16 sums in range
+
+	#define FIX_ONE		((int32_t)1 << 16)
+	#define FIX_HALF	((int32_t)1 << 15)
+
+	/**
+	 * Scaled and rotated drawing.
+	 *	Every display pixel maps back to a point in the image. As the decoder delivers each row
+	 *	the display pixels whose point lies in the strip around that row are drawn. For bilinear
+	 *	filtering the strip lies between two rows so the previous row is kept. Neighbouring
+	 *	display pixels are collected into rectangles before they are blitted.
+	 */
+	typedef struct imageTransform {
+		gdispImageRows		rows;						// Must be first - it is what the decoder calls back with
+		gdispImage *		img;
+		gdispImageFilter	filter;
+		gdispImageError		err;
+		coord_t				x, y, cx, cy;				// The display area being drawn
+		int32_t				u0, v0;						// The image point (16.16) of the center of the first display pixel
+		int32_t				ux, vx, uy, vy;				// How the image point changes across and down the display
+		// The current area of rows - all in decoded pixels
+		bool_t				started;
+		coord_t				ax, ay, acx, acy;
+		int32_t				su0, sv0;					// The mapping reduced by the shift
+		// The previous row (bilinear only)
+		pixel_t *			last;
+		uint8_t *			lastmask;
+		size_t				lastsize;
+		coord_t				lasty;						// -1 if there is none
+		bool_t				pending;					// The strip below the previous row still needs drawing
+		// Output
+		coord_t				bx, by, bcx, bcy;			// A rectangle of pixels waiting to be blitted
+		coord_t				rx, ry, rcx;				// The run of pixels being added after it
+		pixel_t				out[TRANSFORM_BUFFER_SIZE];
+	} imageTransform;
+
+	/* Integer division rounding down (b > 0) */
+	static int32_t floorDiv(int32_t a, int32_t b) {
+		return a >= 0 ? a / b : -((b - 1 - a) / b);
+	}
+
+	/* Narrow [*ps, *pe) to the n for which lo <= a + n*step < hi. Returns FALSE if none are left. */
+	static bool_t transformRange(int32_t a, int32_t step, int32_t lo, int32_t hi, coord_t *ps, coord_t *pe) {
+		int32_t		s, e;
+
+		if (step > 0) {
+			s = -floorDiv(a - lo, step);
+			e = -floorDiv(a - hi, step);
+		} else if (step < 0) {
+			s = floorDiv(a - hi, -step) + 1;
+			e = floorDiv(a - lo, -step) + 1;
+		} else if (a >= lo && a < hi)
+			return *ps < *pe;
+		else
+			return FALSE;
+		if (s < *ps) s = *ps;
+		if (e > *pe) e = *pe;
+		if (s >= e)
+			return FALSE;
+		*ps = (coord_t)s;
+		*pe = (coord_t)e;
+		return TRUE;
+	}
+
+	static void transformFlush(imageTransform *t) {
+		if (t->bcy) {
+			gdispBlitAreaEx(t->bx, t->by, t->bcx, t->bcy, 0, 0, t->bcx, t->out);
+			t->bcy = 0;
+		}
+	}
+
+	static void transformEndRun(imageTransform *t) {
+		coord_t		n;
+
+		if (!t->rcx)
+			return;
+
+		// Does it extend the rectangle?
+		if (t->bcy && t->rx == t->bx && t->rcx == t->bcx && t->ry == t->by + t->bcy)
+			t->bcy++;
+		else {
+			// Start a new rectangle with it
+			n = t->bcy ? t->bcx * t->bcy : 0;
+			transformFlush(t);
+			if (n)
+				memmove(t->out, t->out + n, t->rcx * sizeof(pixel_t));
+			t->bx = t->rx;
+			t->by = t->ry;
+			t->bcx = t->rcx;
+			t->bcy = 1;
+		}
+		t->rcx = 0;
+	}
+
+	static void transformPixel(imageTransform *t, coord_t x, coord_t y, pixel_t c) {
+		if (t->rcx && (y != t->ry || x != t->rx + t->rcx))
+			transformEndRun(t);
+		if (!t->rcx) {
+			// Make sure there is room for a whole run after the rectangle
+			if (t->bcy && t->bcx * (t->bcy + 1) > TRANSFORM_BUFFER_SIZE)
+				transformFlush(t);
+			t->rx = x;
+			t->ry = y;
+		} else if (t->bcx * t->bcy + t->rcx >= TRANSFORM_BUFFER_SIZE) {
+			transformEndRun(t);
+			transformFlush(t);
+			t->rx = x;
+			t->ry = y;
+		}
+		t->out[t->bcx * t->bcy + t->rcx++] = c;
+	}
+
+	/**
+	 * Draw the display pixels whose image point lies in the strip of row s.
+	 * r0 is row s. r1 is the row on the other side of the strip or NULL if there isn't one.
+	 */
+	static void transformStrip(imageTransform *t, coord_t s, const pixel_t *r0, const uint8_t *m0, const pixel_t *r1, const uint8_t *m1) {
+		int32_t		lo, hi, ulo, uhi, a, b, u, v, tu, tv, umin, umax, vmin, vmax;
+		coord_t		dx, dx0, dx1, dy, dy0, dy1, i, i1;
+		uint8_t		fx, fy;
+		pixel_t		c, c1;
+
+		lo = (int32_t)s << 16;
+		hi = lo + FIX_ONE;
+		if (t->filter != GDISP_IMAGE_FILTER_NEAREST) {
+			if (s != t->ay) lo += FIX_HALF;
+			if (s != t->ay + t->acy - 1) hi += FIX_HALF;
+		}
+		ulo = (int32_t)t->ax << 16;
+		uhi = (int32_t)(t->ax + t->acx) << 16;
+
+		// Which display rows can reach the strip
+		if (t->vx > 0)	{ vmin = 0; vmax = (t->cx - 1) * (t->vx >> t->rows.shift); }
+		else			{ vmax = 0; vmin = (t->cx - 1) * (t->vx >> t->rows.shift); }
+		if (t->ux > 0)	{ umin = 0; umax = (t->cx - 1) * (t->ux >> t->rows.shift); }
+		else			{ umax = 0; umin = (t->cx - 1) * (t->ux >> t->rows.shift); }
+		dy0 = 0;
+		dy1 = t->cy;
+		if (!transformRange(t->sv0, t->vy >> t->rows.shift, lo - vmax, hi - vmin, &dy0, &dy1)
+				|| !transformRange(t->su0, t->uy >> t->rows.shift, ulo - umax, uhi - umin, &dy0, &dy1))
+			return;
+
+		for(dy = dy0; dy < dy1; dy++) {
+			a = t->sv0 + dy * (t->vy >> t->rows.shift);
+			b = t->su0 + dy * (t->uy >> t->rows.shift);
+			dx0 = 0;
+			dx1 = t->cx;
+			if (!transformRange(a, t->vx >> t->rows.shift, lo, hi, &dx0, &dx1)
+					|| !transformRange(b, t->ux >> t->rows.shift, ulo, uhi, &dx0, &dx1))
+				continue;
+			v = a + dx0 * (t->vx >> t->rows.shift);
+			u = b + dx0 * (t->ux >> t->rows.shift);
+			for(dx = dx0; dx < dx1; dx++, u += t->ux >> t->rows.shift, v += t->vx >> t->rows.shift) {
+				if (t->filter == GDISP_IMAGE_FILTER_NEAREST) {
+					i = (u >> 16) - t->ax;
+					if (m0 && !m0[i]) {
+						transformEndRun(t);
+						continue;
+					}
+					transformPixel(t, t->x + dx, t->y + dy, r0[i]);
+					continue;
+				}
+
+				// The 4 nearest pixels and how far between them we are
+				tu = u - FIX_HALF;
+				if (tu < ulo) tu = ulo;
+				if (tu > uhi - FIX_ONE) tu = uhi - FIX_ONE;
+				i = (tu >> 16) - t->ax;
+				i1 = i + 1 < t->acx ? i + 1 : i;
+				fx = (uint8_t)(tu >> 8);
+				fy = 0;
+				if (r1) {
+					tv = v - ((int32_t)s << 16) - FIX_HALF;			// From the center of row s
+					if (tv > 0) fy = tv >= FIX_ONE ? 255 : (uint8_t)(tv >> 8);
+				}
+
+				// Anything transparent nearby - just use the nearest pixel
+				if ((m0 && (!m0[i] || !m0[i1])) || (r1 && m1 && (!m1[i] || !m1[i1]))) {
+					i = (u >> 16) - t->ax;
+					if (r1 && fy >= 128) {
+						if (m1 && !m1[i]) { transformEndRun(t); continue; }
+						c = r1[i];
+					} else {
+						if (m0 && !m0[i]) { transformEndRun(t); continue; }
+						c = r0[i];
+					}
+					transformPixel(t, t->x + dx, t->y + dy, c);
+					continue;
+				}
+
+				c = r0[i];
+				if (fx) c = gdispBlendColor(r0[i1], c, fx);
+				if (fy) {
+					c1 = r1[i];
+					if (fx) c1 = gdispBlendColor(r1[i1], c1, fx);
+					c = gdispBlendColor(c1, c, fy);
+				}
+				transformPixel(t, t->x + dx, t->y + dy, c);
+			}
+			transformEndRun(t);
+		}
+	}
+
+	/* Draw anything still waiting for a row that will never come */
+	static void transformFinish(imageTransform *t) {
+		if (t->pending) {
+			transformStrip(t, t->lasty, t->last, t->lastmask, 0, 0);
+			t->pending = FALSE;
+		}
+		transformEndRun(t);
+		transformFlush(t);
+	}
+
+	static void transformRow(gdispImageRows *pr, coord_t y, const pixel_t *pixels, const uint8_t *mask) {
+		imageTransform *	t;
+		size_t				sz;
+
+		t = (imageTransform *)pr;
+		if (t->err != GDISP_IMAGE_ERR_OK)
+			return;
+
+		// Starting a new area?
+		if (!t->started || pr->x != t->ax || pr->y != t->ay || pr->cx != t->acx || pr->cy != t->acy) {
+			transformFinish(t);
+			if (pr->cx <= 0 || pr->cy <= 0 || pr->cx > TRANSFORM_MAX || pr->cy > TRANSFORM_MAX || pr->shift > 3) {
+				t->err = GDISP_IMAGE_ERR_BADDATA;
+				return;
+			}
+			t->started = TRUE;
+			t->ax = pr->x;
+			t->ay = pr->y;
+			t->acx = pr->cx;
+			t->acy = pr->cy;
+			t->su0 = t->u0 >> pr->shift;
+			t->sv0 = t->v0 >> pr->shift;
+			t->lasty = -1;
+			if (t->filter != GDISP_IMAGE_FILTER_NEAREST) {
+				sz = t->acx * (sizeof(pixel_t) + 1);
+				if (sz > t->lastsize) {
+					if (t->last)
+						gdispImageFree(t->img, t->last, t->lastsize);
+					if (!(t->last = (pixel_t *)gdispImageAlloc(t->img, sz))) {
+						t->lastsize = 0;
+						t->err = GDISP_IMAGE_ERR_NOMEMORY;
+						return;
+					}
+					t->lastsize = sz;
+				}
+			}
+		}
+		if (y < t->ay || y >= t->ay + t->acy)
+			return;
+
+		if (t->filter == GDISP_IMAGE_FILTER_NEAREST) {
+			transformStrip(t, y, pixels, mask, 0, 0);
+			return;
+		}
+
+		// The strip above this row
+		if (y > t->ay && t->lasty == y - 1)
+			transformStrip(t, t->lasty, t->last, t->lastmask, pixels, mask);
+		else if (t->pending)
+			transformStrip(t, t->lasty, t->last, t->lastmask, 0, 0);
+		t->pending = FALSE;
+
+		// The strip below this row
+		if (t->lasty == y + 1)
+			transformStrip(t, y, pixels, mask, t->last, t->lastmask);
+		else if (y == t->ay + t->acy - 1)
+			transformStrip(t, y, pixels, mask, 0, 0);
+		else
+			t->pending = TRUE;
+
+		// Keep it for the next row
+		memcpy(t->last, pixels, t->acx * sizeof(pixel_t));
+		if (mask) {
+			t->lastmask = (uint8_t *)(t->last + t->acx);
+			memcpy(t->lastmask, mask, t->acx);
+		} else
+			t->lastmask = 0;
+		t->lasty = y;
+	}
+
+	static gdispImageError transformDraw(gdispImage *img, imageTransform *t, coord_t x, coord_t y, coord_t cx, coord_t cy, gdispImageFilter filter, uint8_t shift) {
+		coord_t			x0, y0, x1, y1, d;
+		gdispImageError	err;
+
+		if (!img->fns->rows)
+			return GDISP_IMAGE_ERR_UNSUPPORTED;
+
+		// Clip to the display
+		#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+			x0 = GDISP.clipx0; y0 = GDISP.clipy0;
+			x1 = GDISP.clipx1; y1 = GDISP.clipy1;
+		#else
+			x0 = 0; y0 = 0;
+			x1 = GDISP.Width; y1 = GDISP.Height;
+		#endif
+		if (x + cx > x1) cx = x1 - x;
+		if (y + cy > y1) cy = y1 - y;
+		if (x < x0) {
+			d = x0 - x;
+			if (d >= cx) return GDISP_IMAGE_ERR_OK;
+			t->u0 += d * t->ux;
+			t->v0 += d * t->vx;
+			cx -= d;
+			x = x0;
+		}
+		if (y < y0) {
+			d = y0 - y;
+			if (d >= cy) return GDISP_IMAGE_ERR_OK;
+			t->u0 += d * t->uy;
+			t->v0 += d * t->vy;
+			cy -= d;
+			y = y0;
+		}
+		if (cx <= 0 || cy <= 0)
+			return GDISP_IMAGE_ERR_OK;
+
+		t->rows.fn = transformRow;
+		t->rows.shift = shift;
+		t->img = img;
+		t->filter = filter;
+		t->err = GDISP_IMAGE_ERR_OK;
+		t->x = x;
+		t->y = y;
+		t->cx = cx;
+		t->cy = cy;
+		t->started = FALSE;
+		t->last = 0;
+		t->lastmask = 0;
+		t->lastsize = 0;
+		t->lasty = -1;
+		t->pending = FALSE;
+		t->bcx = t->bcy = 0;
+		t->rcx = 0;
+
+		err = img->fns->rows(img, &t->rows);
+		if (t->started)
+			transformFinish(t);
+		if (t->last)
+			gdispImageFree(img, t->last, t->lastsize);
+		return err != GDISP_IMAGE_ERR_OK ? err : t->err;
+	}
+
+	gdispImageError gdispImageDrawScaled(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, gdispImageFilter filter) {
+		imageTransform	t;
+		uint8_t			shift;
+
+		if (!img->fns) return GDISP_IMAGE_ERR_BADFORMAT;
+		if (cx <= 0 || cy <= 0) return GDISP_IMAGE_ERR_OK;
+		if (img->width <= 0 || img->height <= 0 || img->width > TRANSFORM_MAX || img->height > TRANSFORM_MAX
+				|| cx > TRANSFORM_MAX || cy > TRANSFORM_MAX)
+			return GDISP_IMAGE_ERR_UNSUPPORTED;
+
+		t.ux = ((int32_t)img->width << 16) / cx;
+		t.vy = ((int32_t)img->height << 16) / cy;
+		t.uy = t.vx = 0;
+		t.u0 = t.ux / 2;
+		t.v0 = t.vy / 2;
+
+		// If it is being made at least half the size the decoder can make it smaller to start with
+		for(shift = 0; shift < 3 && (img->width >> (shift + 1)) >= cx && (img->height >> (shift + 1)) >= cy; shift++);
+
+		return transformDraw(img, &t, x, y, cx, cy, filter, shift);
+	}
+
+	gdispImageError gdispImageDrawRotated(gdispImage *img, coord_t x, coord_t y, int16_t angle, gdispImageFilter filter) {
+		imageTransform	t;
+		int32_t			c, s, ac, as;
+		coord_t			cx, cy;
+
+		if (!img->fns) return GDISP_IMAGE_ERR_BADFORMAT;
+		if (img->width <= 0 || img->height <= 0 || img->width > TRANSFORM_MAX || img->height > TRANSFORM_MAX)
+			return GDISP_IMAGE_ERR_UNSUPPORTED;
+
+		// The cosine and sine in 16.16 - right angles are exact
+		angle %= 360;
+		if (angle < 0) angle += 360;
+		switch(angle) {
+		case 0:		c = FIX_ONE;	s = 0;			break;
+		case 90:	c = 0;			s = FIX_ONE;	break;
+		case 180:	c = -FIX_ONE;	s = 0;			break;
+		case 270:	c = 0;			s = -FIX_ONE;	break;
+		default:
+			c = (int32_t)floor(cos(angle * M_PI / 180) * FIX_ONE + 0.5);
+			s = (int32_t)floor(sin(angle * M_PI / 180) * FIX_ONE + 0.5);
+			break;
+		}
+
+		// The box around the rotated image
+		ac = c < 0 ? -c : c;
+		as = s < 0 ? -s : s;
+		if (((int32_t)img->width * ac + (int32_t)img->height * as) >> 16 >= TRANSFORM_MAX
+				|| ((int32_t)img->width * as + (int32_t)img->height * ac) >> 16 >= TRANSFORM_MAX)
+			return GDISP_IMAGE_ERR_UNSUPPORTED;
+		cx = (coord_t)(((int32_t)img->width * ac + (int32_t)img->height * as + FIX_ONE - 1) >> 16);
+		cy = (coord_t)(((int32_t)img->width * as + (int32_t)img->height * ac + FIX_ONE - 1) >> 16);
+
+		// Rotate each display pixel back the other way about the centers.
+		// The first pixel is (1-cx)/2, (1-cy)/2 from the center of the box.
+		t.ux = c;
+		t.uy = -s;
+		t.vx = s;
+		t.vy = c;
+		t.u0 = ((int32_t)img->width << 15) + ((int32_t)(1 - cx) * c - (int32_t)(1 - cy) * s) / 2;
+		t.v0 = ((int32_t)img->height << 15) + ((int32_t)(1 - cx) * s + (int32_t)(1 - cy) * c) / 2;
+
+		return transformDraw(img, &t, x, y, cx, cy, filter, 0);
+	}
+#endif
+
 #endif /* GFX_USE_GDISP && GDISP_NEED_IMAGE */
 /** @} */
@@ -46,6 +46,10 @@
  */
 void *gdispImageAlloc(gdispImage *img, size_t sz);
 void gdispImageFree(gdispImage *img, void *ptr, size_t sz);
+pixel_t *gdispImageCacheFind(gdispImage *img);
+void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels);
+void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels);
+const void *gdispImageGetBytes(gdispImage *img, void *buf, size_t len);
 
 /**
  * How big a pixel array to allocate for blitting (in pixels)
@@ -158,9 +162,10 @@ gdispImageError gdispImageOpen_BMP(gdispImage *img) {
 		goto baddatacleanup;
 
 	/* Get the offset to the bitmap data */
-	if (img->io.fns->read(&img->io, &priv->frame0pos, 4) != 4)
+	if (img->io.fns->read(&img->io, &adword, 4) != 4)
 		goto baddatacleanup;
-	CONVERT_FROM_DWORD_LE(priv->frame0pos);
+	CONVERT_FROM_DWORD_LE(adword);
+	priv->frame0pos = adword;
 
 	/* Process the BITMAPCOREHEADER structure */
 
@@ -327,20 +332,21 @@ gdispImageError gdispImageOpen_BMP(gdispImage *img) {
 #if GDISP_NEED_IMAGE_BMP_1 || GDISP_NEED_IMAGE_BMP_4 || GDISP_NEED_IMAGE_BMP_4_RLE || GDISP_NEED_IMAGE_BMP_8 || GDISP_NEED_IMAGE_BMP_8_RLE
 	/* Load the palette tables */
 	if (priv->bmpflags & BMP_PALETTE) {
+		uint16_t	cnt, sz;
+
 		img->io.fns->seek(&img->io, offsetColorTable);
 
 		if (!(priv->palette = (color_t *)gdispImageAlloc(img, priv->palsize*sizeof(color_t))))
 			return GDISP_IMAGE_ERR_NOMEMORY;
-		if (priv->bmpflags & BMP_V2) {
-			for(aword = 0; aword < priv->palsize; aword++) {
-				if (img->io.fns->read(&img->io, &priv->buf, 3) != 3) goto baddatacleanup;
-				priv->palette[aword] = RGB2COLOR(((uint8_t *)priv->buf)[2], ((uint8_t *)priv->buf)[1], ((uint8_t *)priv->buf)[0]);
-			}
-		} else {
-			for(aword = 0; aword < priv->palsize; aword++) {
-				if (img->io.fns->read(&img->io, &priv->buf, 4) != 4) goto baddatacleanup;
-				priv->palette[aword] = RGB2COLOR(((uint8_t *)priv->buf)[2], ((uint8_t *)priv->buf)[1], ((uint8_t *)priv->buf)[0]);
-			}
+
+		// Read and convert a buffer full of palette entries at a time. V2 entries are BGR, later ones are BGRx.
+		sz = (priv->bmpflags & BMP_V2) ? 3 : 4;
+		for(aword = 0; aword < priv->palsize; aword += cnt) {
+			cnt = sizeof(priv->buf) / sz;
+			if (cnt > priv->palsize - aword)
+				cnt = priv->palsize - aword;
+			if (img->io.fns->read(&img->io, priv->buf, cnt*sz) != cnt*sz) goto baddatacleanup;
+			gdispConvertPixels(priv->palette+aword, GDISP_PIXELFORMAT, priv->buf, sz == 3 ? GDISP_PIXELFORMAT_BGR24 : GDISP_PIXELFORMAT_BGRA8888, cnt, 0);
 		}
 
 	}
@@ -426,7 +432,7 @@ void gdispImageClose_BMP(gdispImage *img) {
 			gdispImageFree(img, (void *)img->priv->palette, img->priv->palsize*sizeof(color_t));
 #endif
 		if (img->priv->frame0cache)
-			gdispImageFree(img, (void *)img->priv->frame0cache, img->width*img->height*sizeof(pixel_t));
+			gdispImageCacheRelease(img, img->priv->frame0cache);
 		gdispImageFree(img, (void *)img->priv, sizeof(gdispImagePrivate));
 		img->priv = 0;
 	}
@@ -447,7 +453,6 @@ static coord_t getPixels(gdispImage *img, coord_t x) {
 	case 1:
 		{
 		uint8_t		b[4];
-		uint8_t		m;
 
 			priv = img->priv;
 			pc = priv->buf;
@@ -457,14 +462,8 @@ static coord_t getPixels(gdispImage *img, coord_t x) {
 				if (img->io.fns->read(&img->io, &b, 4) != 4)
 					return 0;
 
-				for(m=0x80; m; m >>= 1, pc++)
-					pc[0] = priv->palette[(m&b[0]) ? 1 : 0];
-				for(m=0x80; m; m >>= 1, pc++)
-					pc[0] = priv->palette[(m&b[1]) ? 1 : 0];
-				for(m=0x80; m; m >>= 1, pc++)
-					pc[0] = priv->palette[(m&b[2]) ? 1 : 0];
-				for(m=0x80; m; m >>= 1, pc++)
-					pc[0] = priv->palette[(m&b[3]) ? 1 : 0];
+				gdispConvertPixels(pc, GDISP_PIXELFORMAT, b, GDISP_PIXELFORMAT_MONO1, 32, priv->palette);
+				pc += 32;
 				len += 32;
 				x += 32;
 			}
@@ -650,19 +649,15 @@ static coord_t getPixels(gdispImage *img, coord_t x) {
 	#endif
 	#if GDISP_NEED_IMAGE_BMP_8
 		{
-			uint8_t		b[4];
-
-			while(x < img->width && len <= BLIT_BUFFER_SIZE-4) {
-				if (img->io.fns->read(&img->io, &b, 4) != 4)
-					return 0;
-
-				*pc++ = priv->palette[b[0]];
-				*pc++ = priv->palette[b[1]];
-				*pc++ = priv->palette[b[2]];
-				*pc++ = priv->palette[b[3]];
-				len += 4;
-				x += 4;
-			}
+			const uint8_t	*b;
+
+			// Lines are padded to 4 bytes. Read the indexes into the end of the buffer and convert them in place.
+			len = ((img->width + 3) & ~3) - x;
+			if (len > BLIT_BUFFER_SIZE)
+				len = BLIT_BUFFER_SIZE;
+			if (!(b = (const uint8_t *)gdispImageGetBytes(img, (uint8_t *)priv->buf + sizeof(priv->buf) - len, len)))
+				return 0;
+			gdispConvertPixels(pc, GDISP_PIXELFORMAT, b, GDISP_PIXELFORMAT_INDEX8, len, priv->palette);
 			return len;
 		}
 	#endif
@@ -717,15 +712,19 @@ static coord_t getPixels(gdispImage *img, coord_t x) {
 #if GDISP_NEED_IMAGE_BMP_24
 	case 24:
 		{
-		uint8_t		b[3];
-
-			while(x < img->width && len < BLIT_BUFFER_SIZE) {
-				if (img->io.fns->read(&img->io, &b, 3) != 3)
-					return 0;
-				*pc++ = RGB2COLOR(b[2], b[1], b[0]);
-				x++;
-				len++;
-			}
+		uint8_t			b[3];
+		const uint8_t *	pb;
+
+			// Read the pixels into the end of the buffer and convert them in place
+			len = img->width - x;
+			if (len > BLIT_BUFFER_SIZE)
+				len = BLIT_BUFFER_SIZE;
+			if (len > (coord_t)(sizeof(priv->buf) / 3))
+				len = sizeof(priv->buf) / 3;
+			if (!(pb = (const uint8_t *)gdispImageGetBytes(img, (uint8_t *)priv->buf + sizeof(priv->buf) - len*3, len*3)))
+				return 0;
+			gdispConvertPixels(pc, GDISP_PIXELFORMAT, pb, GDISP_PIXELFORMAT_BGR24, len, 0);
+			x += len;
 
 			if (x >= img->width) {
 				// Make sure we have read a multiple of 4 bytes for the line
@@ -784,6 +783,10 @@ gdispImageError gdispImageCache_BMP(gdispImage *img) {
 	if (priv->frame0cache)
 		return GDISP_IMAGE_ERR_OK;
 
+	/* Another image from the same source may have already decoded it */
+	if ((priv->frame0cache = gdispImageCacheFind(img)))
+		return GDISP_IMAGE_ERR_OK;
+
 	/* We need to allocate the cache */
 	len = img->width * img->height * sizeof(pixel_t);
 	priv->frame0cache = (pixel_t *)gdispImageAlloc(img, len);
@@ -825,6 +828,7 @@ gdispImageError gdispImageCache_BMP(gdispImage *img) {
 		}
 	}
 
+	gdispImageCacheAdd(img, priv->frame0cache);
 	return GDISP_IMAGE_ERR_OK;
 }
 
@@ -894,6 +898,55 @@ gdispImageError gdispImageDraw_BMP(gdispImage *img, coord_t x, coord_t y, coord_
 	return GDISP_IMAGE_ERR_OK;
 }
 
+#if GDISP_NEED_IMAGE_TRANSFORM
+	gdispImageError gdispImageRows_BMP(gdispImage *img, gdispImageRows *pr) {
+		gdispImagePrivate *	priv;
+		pixel_t *			row;
+		color_t *			pcs;
+		coord_t				pos, x, y, i;
+
+		priv = img->priv;
+		pr->shift = 0;
+		pr->x = pr->y = 0;
+		pr->cx = img->width;
+		pr->cy = img->height;
+
+		/* Deliver the rows straight from the image cache - if it exists */
+		if (priv->frame0cache) {
+			for(y = 0; y < img->height; y++)
+				pr->fn(pr, y, priv->frame0cache + (size_t)y * img->width, 0);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		if (!(row = (pixel_t *)gdispImageAlloc(img, img->width * sizeof(pixel_t))))
+			return GDISP_IMAGE_ERR_NOMEMORY;
+
+		/* Start decoding from the beginning */
+		img->io.fns->seek(&img->io, priv->frame0pos);
+	#if GDISP_NEED_IMAGE_BMP_4_RLE || GDISP_NEED_IMAGE_BMP_8_RLE
+		priv->rlerun = 0;
+		priv->rlecode = 0;
+	#endif
+
+		/* The rows are delivered in the order they are stored */
+		for(i = 0; i < img->height; i++) {
+			for(x = 0; x < img->width; ) {
+				if (!(pos = getPixels(img, x))) {
+					gdispImageFree(img, row, img->width * sizeof(pixel_t));
+					return GDISP_IMAGE_ERR_BADDATA;
+				}
+				for(pcs = priv->buf; pos && x < img->width; pos--)
+					row[x++] = *pcs++;
+			}
+			y = (priv->bmpflags & BMP_TOP_TO_BOTTOM) ? i : img->height - 1 - i;
+			pr->fn(pr, y, row, 0);
+		}
+
+		gdispImageFree(img, row, img->width * sizeof(pixel_t));
+		return GDISP_IMAGE_ERR_OK;
+	}
+#endif
+
 delaytime_t gdispImageNext_BMP(gdispImage *img) {
 	(void) img;
 
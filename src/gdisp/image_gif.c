@@ -16,11 +16,14 @@
 
 #if GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_GIF
 
+#include <string.h>
+
 /**
  * Helper Routines Needed
  */
 void *gdispImageAlloc(gdispImage *img, size_t sz);
 void gdispImageFree(gdispImage *img, void *ptr, size_t sz);
+const void *gdispImageGetBytes(gdispImage *img, void *buf, size_t len);
 
 /**
  * How big an array to allocate for blitting (in pixels)
@@ -64,39 +67,45 @@ static const uint8_t	dwordOrder[4]	= { 1, 2, 3, 4 };
 
 #define MAX_CODE_BITS		12
 #define CODE_MAX			((1<<MAX_CODE_BITS)-1)	// Maximum legal code value
-#define CODE_FLUSH			(CODE_MAX+1)			// Illegal code to signal flush
-#define CODE_FIRST			(CODE_MAX+2)			// Illegal code to signal first
 #define CODE_NONE			(CODE_MAX+3)			// Illegal code to signal empty
 
-// Convert bits to masks for that number of bits
-static const uint16_t BitMask[] = {
-		0x0000, 0x0001, 0x0003, 0x0007,
-		0x000f, 0x001f, 0x003f, 0x007f,
-		0x00ff, 0x01ff, 0x03ff, 0x07ff,
-		0x0fff
-		};
-
 // Structure for decoding a single frame
 typedef struct imgdecode {
-	uint8_t		blocksz;								// The size of the block currently being processed
-	uint8_t		maxpixel;								// The maximum allowed pixel value
+	uint8_t		state;									// The state of the decode
+		#define GIFD_RUN			0						// Decoding
+		#define GIFD_END			1						// All the data blocks have been read
+		#define GIFD_BAD			2						// The image data is corrupt
 	uint8_t		bitsperpixel;
 	uint8_t		bitspercode;
 	uint8_t		shiftbits;
-	uint16_t	maxcodesz;
-	uint16_t	stackcnt;								// The number of items on the stack
+	uint8_t		blocklen;								// The size of the data block in block[]
+	uint8_t		blockpos;								// The next byte to use in block[]
+	uint8_t		first;									// The first pixel of the last string
+	uint16_t	codemask;
 	uint16_t	code_clear;
 	uint16_t	code_eof;
-	uint16_t	code_max;
+	uint16_t	code_next;								// The next free entry in the string table
 	uint16_t	code_last;
+	uint16_t	pendcode;								// A string that didn't fit in the last request
+	uint16_t	pendpos;								// How much of that string has been output
 	uint32_t	shiftdata;
 	color_t *	palette;
-	uint8_t		buf[BLIT_BUFFER_SIZE];					// Buffer for decoded pixels
-	uint16_t	prefix[1<<MAX_CODE_BITS];				// The LZW table
-    uint8_t		suffix[1<<MAX_CODE_BITS]; 				// So we can trace the codes
-    uint8_t 	stack[1<<MAX_CODE_BITS];				// Decoded pixels might be stacked here
+	uint8_t *	row;									// Buffer for a row of pixel indexes
+	const uint8_t *	data;								// The current data block - in block[] or used in place
+	uint8_t		block[255];								// A buffer for the data block
+	uint16_t	prefix[1<<MAX_CODE_BITS];				// The string table - the string this extends
+	uint16_t	length[1<<MAX_CODE_BITS];				//		- the length of the string
+	uint8_t		suffix[1<<MAX_CODE_BITS];				//		- the last pixel of the string
 } imgdecode;
 
+// How much memory the decode of the current frame needs - the structure, a local palette and a row buffer
+#define DECODE_SIZE(priv)	(sizeof(imgdecode) + (priv)->frame.palsize*sizeof(color_t) + (priv)->frame.width)
+
+// The rows of each pass - an interlaced frame uses passes 0 to 3, a sequential frame just pass 4
+static const struct { uint8_t start, step; } gifPasses[] = { {0, 8}, {4, 8}, {2, 4}, {1, 2}, {0, 1} };
+#define GIF_PASS_INTERLACED	0
+#define GIF_PASS_SEQUENTIAL	4
+
 // The data on a single frame
 typedef struct imgframe {
 	coord_t				x, y;							// position relative to full image
@@ -120,6 +129,8 @@ typedef struct imgcache {
 	imgframe			frame;
 	color_t *			palette;						// Local palette
 	uint8_t *			imagebits;						// Image bits - only saved when caching
+	uint16_t *			runs;							// The non-transparent runs of each row (if created)
+	size_t				runsize;						// The number of entries in runs
 	struct imgcache *	next;							// Next cached frame
 } imgcache;
 
@@ -135,6 +146,8 @@ typedef struct gdispImagePrivate {
 	uint8_t		flags;							// Flags (global)
 		#define GIF_LOOP			0x01		// Loop back to first frame
 		#define GIF_LOOPFOREVER		0x02		// Looping is forever
+		#define GIF_DRAWN			0x04		// The canvas has been drawn since the last frame change
+		#define GIF_DELTA			0x08		// The display has the previous canvas so only changes need drawing
 	uint8_t		bgcolor;						// Background Color (global)
 	uint16_t	loops;							// Remaining frame loops (if animated)
 	uint16_t	palsize;						// Global palette size (global)
@@ -145,6 +158,15 @@ typedef struct gdispImagePrivate {
 	imgdecode *	decode;							// The decode data for the decode in progress
 	imgframe	frame;
 	imgdispose	dispose;
+	#if GDISP_NEED_IMAGE_GIF_CANVAS
+		color_t *	canvas;						// The composited image (if created)
+		color_t *	saved;						// The canvas under a frame that is disposed by restoring
+		size_t		savedsize;					// The number of pixels in saved
+		size_t		canvaspos;					// The frame in the canvas (0 = none)
+		coord_t		dirtyx, dirtyy;				// The area of the canvas changed since it was last drawn
+		coord_t		dirtyfx, dirtyfy;
+		coord_t		lastx, lasty, lastcx, lastcy, lastsx, lastsy;	// The last canvas draw
+	#endif
 	pixel_t		buf[BLIT_BUFFER_SIZE];			// Buffer for reading and blitting
 	} gdispImagePrivate;
 
@@ -156,31 +178,32 @@ typedef struct gdispImagePrivate {
 static gdispImageError startDecode(gdispImage *img) {
 	gdispImagePrivate *	priv;
 	imgdecode *			decode;
-	uint16_t			cnt;
+	uint16_t			cnt, n, maxpixel;
 
 	priv = img->priv;
 
 	// We need the decode ram, and possibly a palette
-	if (!(decode = (imgdecode *)gdispImageAlloc(img, sizeof(imgdecode)+priv->frame.palsize*sizeof(color_t))))
+	if (!(decode = (imgdecode *)gdispImageAlloc(img, DECODE_SIZE(priv))))
 		return GDISP_IMAGE_ERR_NOMEMORY;
-
-	// We currently have not read any image data block
-	decode->blocksz = 0;
+	decode->row = (uint8_t *)(decode+1) + priv->frame.palsize*sizeof(color_t);
 
 	// Set the palette
 	if (priv->frame.palsize) {
 		// Local palette
-		decode->maxpixel = priv->frame.palsize-1;
+		maxpixel = priv->frame.palsize-1;
 		decode->palette = (color_t *)(decode+1);
 		img->io.fns->seek(&img->io, priv->frame.pospal);
-		for(cnt = 0; cnt < priv->frame.palsize; cnt++) {
-			if (img->io.fns->read(&img->io, &decode->buf, 3) != 3)
+		for(cnt = 0; cnt < priv->frame.palsize; cnt += n) {
+			n = priv->frame.palsize - cnt;
+			if (n > sizeof(decode->block)/3)
+				n = sizeof(decode->block)/3;
+			if (img->io.fns->read(&img->io, decode->block, n*3) != (size_t)n*3)
 				goto baddatacleanup;
-			decode->palette[cnt] = RGB2COLOR(decode->buf[0], decode->buf[1], decode->buf[2]);
+			gdispConvertPixels(decode->palette+cnt, GDISP_PIXELFORMAT, decode->block, GDISP_PIXELFORMAT_RGB24, n, 0);
 		}
 	} else if (priv->palette) {
 		// Global palette
-		decode->maxpixel = priv->palsize-1;
+		maxpixel = priv->palsize-1;
 		decode->palette = priv->palette;
 	} else {
 		// Oops - we must have a palette
@@ -191,24 +214,31 @@ static gdispImageError startDecode(gdispImage *img) {
 	img->io.fns->seek(&img->io, priv->frame.posimg);
 	if (img->io.fns->read(&img->io, &decode->bitsperpixel, 1) != 1 || decode->bitsperpixel >= MAX_CODE_BITS)
 		goto baddatacleanup;
+	decode->state = GIFD_RUN;
+	decode->blocklen = decode->blockpos = 0;
 	decode->code_clear = 1 << decode->bitsperpixel;
 	decode->code_eof = decode->code_clear + 1;
-	decode->code_max = decode->code_clear + 2;
+	decode->code_next = decode->code_clear + 2;
 	decode->code_last = CODE_NONE;
+	decode->pendcode = CODE_NONE;
 	decode->bitspercode = decode->bitsperpixel+1;
-	decode->maxcodesz = 1 << decode->bitspercode;
+	decode->codemask = (1 << decode->bitspercode) - 1;
 	decode->shiftbits = 0;
 	decode->shiftdata = 0;
-	decode->stackcnt = 0;
-	for(cnt = 0; cnt <= CODE_MAX; cnt++)
-		decode->prefix[cnt] = CODE_NONE;
+
+	// The single pixel strings. Pixels outside the palette are mapped to pixel 0.
+	for(cnt = 0; cnt < decode->code_clear; cnt++) {
+		decode->prefix[cnt] = 0;
+		decode->length[cnt] = 1;
+		decode->suffix[cnt] = cnt <= maxpixel ? cnt : 0;
+	}
 
 	// All ready to go
 	priv->decode = decode;
 	return GDISP_IMAGE_ERR_OK;
 
 baddatacleanup:
-	gdispImageFree(img, decode, sizeof(imgdecode)+priv->frame.palsize*sizeof(color_t));
+	gdispImageFree(img, decode, DECODE_SIZE(priv));
 	return GDISP_IMAGE_ERR_BADDATA;
 }
 
@@ -224,156 +254,261 @@ static void stopDecode(gdispImage *img) {
 
 	// Free the decode data
 	if (priv->decode) {
-		gdispImageFree(img, (void *)priv->decode, sizeof(imgdecode)+priv->frame.palsize*sizeof(color_t));
+		gdispImageFree(img, (void *)priv->decode, DECODE_SIZE(priv));
 		priv->decode = 0;
 	}
 }
 
-static uint16_t getPrefix(imgdecode *decode, uint16_t code) {
-	uint16_t i;
-
-	for(i=0; code > decode->code_clear && i <= CODE_MAX; i++, code = decode->prefix[code]) {
-		if (code > CODE_MAX)
-			return CODE_NONE;
+/**
+ * Skip any data blocks we haven't read so that the file position is at the end of the frame.
+ */
+static void skipData(gdispImage *img) {
+	imgdecode *	decode;
+	uint8_t		blocksz;
+
+	decode = img->priv->decode;
+	if (decode->state == GIFD_RUN) {
+		while(img->io.fns->read(&img->io, &blocksz, 1) == 1 && blocksz)
+			img->io.fns->seek(&img->io, img->io.pos+blocksz);
+		decode->state = GIFD_END;
 	}
-    return code;
 }
 
 /**
- * Decode some pixels from a frame.
- *
- * Pre:		We are ready for decoding.
+ * Get the next code - a code is made up of decode->bitspercode bits.
+ * The data is read a whole data block at a time.
  *
- * Return:	The number of pixels decoded 0 .. BLIT_BUFFER_SIZE-1. 0 means EOF
- *
- * Note:	The resulting pixels are stored in decode->buf
+ * Return:	The code. Running out of data returns the EOF code - some encoders seem to just end the file
  */
-static uint16_t getbytes(gdispImage *img) {
-	gdispImagePrivate *	priv;
-	imgdecode *			decode;
-	uint16_t			cnt;
-	uint16_t			code, prefix;
-	uint8_t				bdata;
+static uint16_t getCode(gdispImage *img) {
+	imgdecode *	decode;
+	uint16_t	code;
+
+	decode = img->priv->decode;
+	while (decode->shiftbits < decode->bitspercode) {
+		if (decode->blockpos >= decode->blocklen) {
+			// Get the next data block - a zero length block is the end of the data
+			if (img->io.fns->read(&img->io, &decode->blocklen, 1) != 1 || !decode->blocklen
+					|| !(decode->data = (const uint8_t *)gdispImageGetBytes(img, decode->block, decode->blocklen))) {
+				decode->state = GIFD_END;
+				return decode->code_eof;
+			}
+			decode->blockpos = 0;
+		}
+		decode->shiftdata |= ((uint32_t)decode->data[decode->blockpos++]) << decode->shiftbits;
+		decode->shiftbits += 8;
+	}
+	code = decode->shiftdata & decode->codemask;
+	decode->shiftdata >>= decode->bitspercode;
+	decode->shiftbits -= decode->bitspercode;
+	return code;
+}
 
-	priv = img->priv;
-	decode = priv->decode;
-	cnt = 0;
+/**
+ * Add a string to the table - the last string plus one pixel.
+ * The code size goes up when the table outgrows it.
+ */
+static void addCode(imgdecode *decode, uint8_t pixel) {
+	uint16_t	code;
+
+	code = decode->code_next++;
+	decode->prefix[code] = decode->code_last;
+	decode->suffix[code] = pixel;
+	decode->length[code] = decode->length[decode->code_last] + 1;
+	if (decode->code_next > decode->codemask && decode->bitspercode < MAX_CODE_BITS) {
+		decode->bitspercode++;
+		decode->codemask = (decode->codemask << 1) | 1;
+	}
+}
 
-	// At EOF
-	if (decode->code_last == decode->code_eof)
-		return 0;
+/**
+ * Output the pixels from .. to-1 of the string for a code.
+ * Strings are stored backwards so we walk back from the end of the string filling from the end.
+ */
+static void putString(imgdecode *decode, uint8_t *dst, uint16_t code, uint16_t from, uint16_t to) {
+	uint16_t	pos;
+
+	for(pos = decode->length[code]; pos > to; pos--)
+		code = decode->prefix[code];
+	for(dst += to - from; pos > from; pos--) {
+		*--dst = decode->suffix[code];
+		code = decode->prefix[code];
+	}
+}
 
-	while(cnt < sizeof(decode->buf)) {
-		// Use the stack up first
-		if (decode->stackcnt > 0) {
-			decode->buf[cnt++] = decode->stack[--decode->stackcnt];
-			continue;
-		}
+/**
+ * Decode the next pixels of a frame.
+ *
+ * Pre:		We are ready for decoding.
+ *
+ * Return:	The number of pixels decoded. Less than cnt means the image data has ended or
+ * 			is corrupt (decode->state is GIFD_BAD).
+ */
+static coord_t decodePixels(gdispImage *img, uint8_t *dst, coord_t cnt) {
+	imgdecode *	decode;
+	coord_t		got;
+	uint16_t	code, n;
+	bool_t		added;
+
+	decode = img->priv->decode;
+	got = 0;
+
+	// Finish off a string that didn't fit last time
+	if (decode->pendcode != CODE_NONE) {
+		n = decode->length[decode->pendcode] - decode->pendpos;
+		if (n > cnt)
+			n = cnt;
+		putString(decode, dst, decode->pendcode, decode->pendpos, decode->pendpos+n);
+		decode->pendpos += n;
+		if (decode->pendpos >= decode->length[decode->pendcode])
+			decode->pendcode = CODE_NONE;
+		got = n;
+	}
 
-	    // Get another code - a code is made up of decode->bitspercode bits.
-	    while (decode->shiftbits < decode->bitspercode) {
-	    	// Get a byte - we may have to start a new data block
-	    	if ((!decode->blocksz && (img->io.fns->read(&img->io, &decode->blocksz, 1) != 1 || !decode->blocksz))
-	    			|| img->io.fns->read(&img->io, &bdata, 1) != 1) {
-	    		// Pretend we got the EOF code - some encoders seem to just end the file
-	    		decode->code_last = decode->code_eof;
-	    		return cnt;
-	    	}
-   	    	decode->blocksz--;
-
-	        decode->shiftdata |= ((unsigned long)bdata) << decode->shiftbits;
-	        decode->shiftbits += 8;
-	    }
-	    code = decode->shiftdata & BitMask[decode->bitspercode];
-	    decode->shiftdata >>= decode->bitspercode;
-	    decode->shiftbits -= decode->bitspercode;
-	    /**
-	     * If code cannot fit into bitspercode bits we must raise its size.
-	     * Note that codes above CODE_MAX are used for special signaling.
-	     * If we're using MAX_CODE_BITS bits already and we're at the max code, just
-	     * keep using the table as it is, don't increment decode->bitspercode.
-	     */
-	    if (decode->code_max < CODE_MAX + 2 && ++decode->code_max > decode->maxcodesz && decode->bitspercode < MAX_CODE_BITS) {
-	        decode->maxcodesz <<= 1;
-	        decode->bitspercode++;
-	    }
+	while(got < cnt && decode->state == GIFD_RUN) {
+		code = getCode(img);
 
 		// EOF - the appropriate way to stop decoding
 		if (code == decode->code_eof) {
-			// Skip to the end of the data blocks
-			do {
-				img->io.fns->seek(&img->io, img->io.pos+decode->blocksz);
-			} while (img->io.fns->read(&img->io, &decode->blocksz, 1) == 1 && decode->blocksz);
-
-			// Mark the end
-			decode->code_last = decode->code_eof;
+			skipData(img);
 			break;
 		}
 
+		// Start again
 		if (code == decode->code_clear) {
-			// Start again
-			for(prefix = 0; prefix <= CODE_MAX; prefix++)
-				decode->prefix[prefix] = CODE_NONE;
-			decode->code_max = decode->code_eof + 1;
+			decode->code_next = decode->code_eof + 1;
 			decode->bitspercode = decode->bitsperpixel + 1;
-			decode->maxcodesz = 1 << decode->bitspercode;
+			decode->codemask = (1 << decode->bitspercode) - 1;
 			decode->code_last = CODE_NONE;
 			continue;
 		}
 
-		if (code < decode->code_clear) {
-			// Simple unencoded pixel - add it
-			decode->buf[cnt++] = code;
-
-		} else {
-			/**
-			 * Its a LZW code - trace the linked list until the prefix is a
-			 * valid pixel while pushing the suffix pixels on the stack.
-			 * If done, pop the stack in reverse order adding the pixels
-			 */
-			if (decode->prefix[code] != CODE_NONE)
-				prefix = code;
-
-			/**
-			 * Only allowed if the code equals the partial code.
-			 * In that case code = XXXCode, CrntCode or the
-			 * prefix code is last code and the suffix char is
-			 * exactly the prefix of last code!
-			 */
-			else if (code == decode->code_max - 2 && decode->stackcnt < sizeof(decode->stack)) {
-				prefix = decode->code_last;
-				decode->suffix[decode->code_max - 2] = decode->stack[decode->stackcnt++] = getPrefix(decode, decode->code_last);
-			} else
-				return 0;
-
-			/**
-			 * If the image is OK we should not get a CODE_NONE while tracing.
-			 * To prevent looping with a bad image we use StackPtr as loop counter
-			 * and stop before overflowing Stack[].
-			 */
-			while (decode->stackcnt < sizeof(decode->stack) && prefix > decode->code_clear && prefix <= CODE_MAX) {
-				decode->stack[decode->stackcnt++] = decode->suffix[prefix];
-				prefix = decode->prefix[prefix];
+		// The first code after a clear must be a single pixel
+		if (decode->code_last == CODE_NONE) {
+			if (code > decode->code_clear) {
+				decode->state = GIFD_BAD;
+				break;
 			}
-			if (decode->stackcnt >= sizeof(decode->stack) || prefix > CODE_MAX)
-				return 0;
-
-			/* Push the last character on stack: */
-			decode->stack[decode->stackcnt++] = prefix;
+			dst[got++] = decode->first = decode->suffix[code];
+			decode->code_last = code;
+			continue;
 		}
 
-		if (decode->code_last != CODE_NONE && decode->prefix[decode->code_max - 2] == CODE_NONE) {
-			decode->prefix[decode->code_max - 2] = decode->code_last;
+		/**
+		 * A code can only be used before it is in the table if it is the next one to be added.
+		 * That string is the last string plus the first pixel of the last string.
+		 */
+		added = FALSE;
+		if (code >= decode->code_next) {
+			if (code != decode->code_next || code > CODE_MAX) {
+				decode->state = GIFD_BAD;
+				break;
+			}
+			addCode(decode, decode->first);
+			added = TRUE;
+		}
 
-			/* Only allowed if code is exactly the running code:
-			* In that case code = XXXCode, CrntCode or the
-			* prefix code is last code and the suffix char is
-			* exactly the prefix of last code! */
-			decode->suffix[decode->code_max - 2] = getPrefix(decode, code == decode->code_max - 2 ? decode->code_last : code);
+		// Output the string - anything that doesn't fit is output next time
+		n = cnt - got;
+		if (decode->length[code] <= n)
+			n = decode->length[code];
+		else {
+			decode->pendcode = code;
+			decode->pendpos = n;
 		}
+		putString(decode, dst+got, code, 0, n);
+		decode->first = dst[got];
+		got += n;
+
+		// The new string is the last string plus the first pixel of this one
+		if (!added && decode->code_next <= CODE_MAX)
+			addCode(decode, decode->first);
 		decode->code_last = code;
 	}
-	return cnt;
+	return got;
+}
+
+/**
+ * Find the next run of non-transparent pixels in a row between mx and fx.
+ *
+ * Return:	The start of the run (fx if there isn't one). The end of the run is returned in *pex.
+ */
+static coord_t findRun(const uint8_t *q, coord_t mx, coord_t fx, uint8_t trans, coord_t *pex) {
+	coord_t		ex;
+
+	for(; mx < fx && q[mx] == trans; mx++);
+	for(ex = mx; ex < fx && q[ex] != trans; ex++);
+	*pex = ex;
+	return mx;
+}
+
+/**
+ * Draw pixels mx .. mx+len-1 of a row of pixel indexes at x, y.
+ */
+static void drawRun(coord_t x, coord_t y, const uint8_t *q, coord_t mx, coord_t len, const color_t *palette) {
+	switch(len) {
+	case 0:																								break;
+	case 1:		gdispDrawPixel(x, y, palette[q[mx]]);													break;
+	default:	gdispBlitConvert(x, y, len, 1, mx, 0, mx+len, q, GDISP_PIXELFORMAT_INDEX8, palette);	break;
+	}
+}
+
+/**
+ * Draw pixels sx .. fx-1 of a row of pixel indexes at x, y skipping any transparent pixels.
+ */
+static void drawRow(gdispImage *img, coord_t x, coord_t y, const uint8_t *q, coord_t sx, coord_t fx, const color_t *palette) {
+	gdispImagePrivate *	priv;
+	coord_t				mx, ex;
+
+	priv = img->priv;
+	if (!(priv->frame.flags & GIFL_TRANSPARENT)) {
+		drawRun(x, y, q, sx, fx-sx, palette);
+		return;
+	}
+	for(mx = sx; mx < fx; mx = ex) {
+		mx = findRun(q, mx, fx, priv->frame.paltrans, &ex);
+		drawRun(x+mx-sx, y, q, mx, ex-mx, palette);
+	}
+}
+
+/**
+ * Build the run-length mask of the non-transparent pixels of a cached frame.
+ * Each row is a count followed by that many start, length pairs.
+ * If there isn't enough memory the runs are found again each time the frame is drawn.
+ */
+static void cacheRuns(gdispImage *img, imgcache *cache) {
+	const uint8_t *	q;
+	uint16_t *		r;
+	uint16_t *		pcnt;
+	size_t			sz;
+	coord_t			mx, ex, my;
+
+	cache->runs = 0;
+	if (!(cache->frame.flags & GIFL_TRANSPARENT))
+		return;
+
+	// Count the runs
+	for(sz = 0, q = cache->imagebits, my = 0; my < cache->frame.height; my++, q += cache->frame.width) {
+		for(sz++, mx = 0; mx < cache->frame.width; mx = ex) {
+			if ((mx = findRun(q, mx, cache->frame.width, cache->frame.paltrans, &ex)) < ex)
+				sz += 2;
+		}
+	}
+	if (!(r = (uint16_t *)gdispImageAlloc(img, sz*sizeof(uint16_t))))
+		return;
+	cache->runs = r;
+	cache->runsize = sz;
+
+	// Save them
+	for(q = cache->imagebits, my = 0; my < cache->frame.height; my++, q += cache->frame.width) {
+		for(pcnt = r++, *pcnt = 0, mx = 0; mx < cache->frame.width; mx = ex) {
+			if ((mx = findRun(q, mx, cache->frame.width, cache->frame.paltrans, &ex)) < ex) {
+				*r++ = mx;
+				*r++ = ex - mx;
+				(*pcnt)++;
+			}
+		}
+	}
 }
 
 /**
@@ -384,6 +519,7 @@ static uint16_t getbytes(gdispImage *img) {
 static gdispImageError initFrame(gdispImage *img) {
 	gdispImagePrivate *	priv;
 	imgcache *			cache;
+	uint16_t			aword;
 	uint8_t				blocktype;
 	uint8_t				blocksz;
 
@@ -423,14 +559,24 @@ static gdispImageError initFrame(gdispImage *img) {
 			// Read the Image Descriptor
 			if (img->io.fns->read(&img->io, priv->buf, 9) != 9)
 				return GDISP_IMAGE_ERR_BADDATA;
-			priv->frame.x = *(uint16_t *)(((uint8_t *)priv->buf)+0);
-			CONVERT_FROM_WORD_LE(priv->frame.x);
-			priv->frame.y = *(uint16_t *)(((uint8_t *)priv->buf)+2);
-			CONVERT_FROM_WORD_LE(priv->frame.y);
-			priv->frame.width = *(uint16_t *)(((uint8_t *)priv->buf)+4);
-			CONVERT_FROM_WORD_LE(priv->frame.width);
-			priv->frame.height = *(uint16_t *)(((uint8_t *)priv->buf)+6);
-			CONVERT_FROM_WORD_LE(priv->frame.height);
+			// The fields are unsigned. A size that doesn't fit a coord_t can't be drawn and
+			// a frame that starts past the edge of the image is moved to the edge (nothing of it is visible).
+			aword = *(uint16_t *)(((uint8_t *)priv->buf)+4);
+			CONVERT_FROM_WORD_LE(aword);
+			if (aword > 0x7FFF)
+				return GDISP_IMAGE_ERR_UNSUPPORTED;
+			priv->frame.width = aword;
+			aword = *(uint16_t *)(((uint8_t *)priv->buf)+6);
+			CONVERT_FROM_WORD_LE(aword);
+			if (aword > 0x7FFF)
+				return GDISP_IMAGE_ERR_UNSUPPORTED;
+			priv->frame.height = aword;
+			aword = *(uint16_t *)(((uint8_t *)priv->buf)+0);
+			CONVERT_FROM_WORD_LE(aword);
+			priv->frame.x = aword > (uint16_t)img->width ? img->width : aword;
+			aword = *(uint16_t *)(((uint8_t *)priv->buf)+2);
+			CONVERT_FROM_WORD_LE(aword);
+			priv->frame.y = aword > (uint16_t)img->height ? img->height : aword;
 			if (((uint8_t *)priv->buf)[8] & 0x80)				// Local color table?
 				priv->frame.palsize = 2 << (((uint8_t *)priv->buf)[8] & 0x07);
 			if (((uint8_t *)priv->buf)[8] & 0x40)				// Interlaced?
@@ -546,10 +692,247 @@ static gdispImageError initFrame(gdispImage *img) {
 	}
 }
 
+/**
+ * Find the end of the current frame.
+ *
+ * Post:	The file position is at the end of the frame.
+ *
+ * Return:	FALSE if the file ended early
+ */
+static bool_t findFrameEnd(gdispImage *img) {
+	gdispImagePrivate *	priv;
+	uint8_t				blocksz;
+
+	priv = img->priv;
+
+	// We don't know where the end of the frame is yet - find it!
+	if (!priv->frame.posend) {
+		img->io.fns->seek(&img->io, priv->frame.posimg+1);				// Skip the code size byte too
+		while(1) {
+			if (img->io.fns->read(&img->io, &blocksz, 1) != 1)
+				return FALSE;
+			if (!blocksz)
+				break;
+			img->io.fns->seek(&img->io, img->io.pos + blocksz);
+		}
+		priv->frame.posend = img->io.pos;
+	}
+
+	img->io.fns->seek(&img->io, priv->frame.posend);
+	return TRUE;
+}
+
+#if GDISP_NEED_IMAGE_GIF_CANVAS
+	/**
+	 * Add an area of the image to the area of the canvas that has changed.
+	 */
+	static void canvasDirty(gdispImagePrivate *priv, coord_t x, coord_t y, coord_t fx, coord_t fy) {
+		if (fx <= x || fy <= y)
+			return;
+		if (priv->dirtyfx <= priv->dirtyx || priv->dirtyfy <= priv->dirtyy) {
+			priv->dirtyx = x; priv->dirtyy = y;
+			priv->dirtyfx = fx; priv->dirtyfy = fy;
+			return;
+		}
+		if (x < priv->dirtyx) priv->dirtyx = x;
+		if (y < priv->dirtyy) priv->dirtyy = y;
+		if (fx > priv->dirtyfx) priv->dirtyfx = fx;
+		if (fy > priv->dirtyfy) priv->dirtyfy = fy;
+	}
+
+	/**
+	 * Fill an area of the canvas with the background color.
+	 * The spec says to use the backgound color (priv->bgcolor) but in practice if there is transparency
+	 * image decoders tend to use the transparent color instead.
+	 */
+	static void canvasClear(gdispImage *img, uint8_t flags, coord_t x, coord_t y, coord_t fx, coord_t fy) {
+		gdispImagePrivate *	priv;
+		color_t *			p;
+		color_t				c;
+		coord_t				mx;
+
+		priv = img->priv;
+		if ((flags & GIFL_TRANSPARENT) || priv->bgcolor >= priv->palsize)
+			c = img->bgcolor;
+		else
+			c = priv->palette[priv->bgcolor];
+		for(; y < fy; y++)
+			for(p = priv->canvas + y*img->width + x, mx = x; mx < fx; mx++)
+				*p++ = c;
+	}
+
+	/**
+	 * Convert a row of pixel indexes into the canvas at x, y skipping any transparent pixels.
+	 * The row must already be clipped to the width of the image.
+	 */
+	static void canvasRow(gdispImage *img, coord_t x, coord_t y, const uint8_t *q, coord_t cnt, const color_t *palette) {
+		gdispImagePrivate *	priv;
+		color_t *			p;
+		coord_t				mx, ex;
+
+		priv = img->priv;
+		if (y >= img->height)
+			return;
+		p = priv->canvas + y*img->width + x;
+		if (!(priv->frame.flags & GIFL_TRANSPARENT)) {
+			gdispConvertPixels(p, GDISP_PIXELFORMAT, q, GDISP_PIXELFORMAT_INDEX8, cnt, palette);
+			return;
+		}
+		for(mx = 0; mx < cnt; mx = ex) {
+			if ((mx = findRun(q, mx, cnt, priv->frame.paltrans, &ex)) < ex)
+				gdispConvertPixels(p+mx, GDISP_PIXELFORMAT, q+mx, GDISP_PIXELFORMAT_INDEX8, ex-mx, palette);
+		}
+	}
+
+	/**
+	 * Composite the current frame into the canvas.
+	 * The previous frame is disposed of first - including restoring what was under it.
+	 */
+	static gdispImageError canvasCompose(gdispImage *img) {
+		gdispImagePrivate *	priv;
+		imgdecode *			decode;
+		const uint8_t *		q;
+		coord_t				x, y, fx, fy, my, cnt;
+		uint8_t				pass, lastpass;
+
+		priv = img->priv;
+		if (priv->canvaspos == priv->frame.posstart)
+			return GDISP_IMAGE_ERR_OK;
+
+		// Start again on the first frame (or if we have lost track of the frames)
+		if (!priv->canvaspos || priv->frame.posstart == priv->frame0pos) {
+			canvasClear(img, priv->frame.flags, 0, 0, img->width, img->height);
+			canvasDirty(priv, 0, 0, img->width, img->height);
+
+		// Otherwise dispose of the previous frame
+		} else if (priv->dispose.flags & (GIFL_DISPOSECLEAR|GIFL_DISPOSEREST)) {
+			x = priv->dispose.x;
+			y = priv->dispose.y;
+			fx = x + priv->dispose.width;
+			fy = y + priv->dispose.height;
+			if (fx > img->width) fx = img->width;
+			if (fy > img->height) fy = img->height;
+			if (fx > x && fy > y) {
+				if ((priv->dispose.flags & GIFL_DISPOSEREST) && priv->saved && priv->savedsize == (size_t)(fx-x)*(fy-y)) {
+					for(q = (const uint8_t *)priv->saved, my = y; my < fy; my++, q += (fx-x)*sizeof(color_t))
+						memcpy(priv->canvas + my*img->width + x, q, (fx-x)*sizeof(color_t));
+				} else
+					canvasClear(img, priv->dispose.flags, x, y, fx, fy);
+				canvasDirty(priv, x, y, fx, fy);
+			}
+		}
+		priv->canvaspos = priv->frame.posstart;
+
+		// Clip to the image
+		x = priv->frame.x;
+		y = priv->frame.y;
+		fx = x + priv->frame.width;
+		fy = y + priv->frame.height;
+		if (fx > img->width) fx = img->width;
+		if (fy > img->height) fy = img->height;
+		if (fx <= x || fy <= y)
+			return GDISP_IMAGE_ERR_OK;
+		canvasDirty(priv, x, y, fx, fy);
+
+		// Save what is under a frame that gets disposed by restoring. If there isn't the memory it gets cleared instead.
+		if (priv->frame.flags & GIFL_DISPOSEREST) {
+			if (priv->saved && priv->savedsize != (size_t)(fx-x)*(fy-y)) {
+				gdispImageFree(img, (void *)priv->saved, priv->savedsize*sizeof(color_t));
+				priv->saved = 0;
+			}
+			if (!priv->saved) {
+				priv->savedsize = (size_t)(fx-x)*(fy-y);
+				priv->saved = (color_t *)gdispImageAlloc(img, priv->savedsize*sizeof(color_t));
+			}
+			if (priv->saved) {
+				uint8_t *	p;
+
+				for(p = (uint8_t *)priv->saved, my = y; my < fy; my++, p += (fx-x)*sizeof(color_t))
+					memcpy(p, priv->canvas + my*img->width + x, (fx-x)*sizeof(color_t));
+			}
+		}
+
+		// From the image cache - if it exists
+		if (priv->curcache) {
+			for(q = priv->curcache->imagebits, my = 0; my < priv->frame.height; my++, q += priv->frame.width)
+				canvasRow(img, x, y+my, q, fx-x, priv->curcache->palette);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		// Otherwise decode it
+		switch(startDecode(img)) {
+		case GDISP_IMAGE_ERR_OK:			break;
+		case GDISP_IMAGE_ERR_NOMEMORY:		return GDISP_IMAGE_ERR_NOMEMORY;
+		case GDISP_IMAGE_ERR_BADDATA:
+		default:							return GDISP_IMAGE_ERR_BADDATA;
+		}
+		decode = priv->decode;
+		if (priv->frame.flags & GIFL_INTERLACE) {
+			pass = GIF_PASS_INTERLACED;
+			lastpass = GIF_PASS_SEQUENTIAL-1;
+		} else
+			pass = lastpass = GIF_PASS_SEQUENTIAL;
+		for(; pass <= lastpass; pass++) {
+			for(my = gifPasses[pass].start; my < priv->frame.height; my += gifPasses[pass].step) {
+				// Sometimes the image EOF is a bit early - treat the rest as transparent
+				cnt = decodePixels(img, decode->row, priv->frame.width);
+				canvasRow(img, x, y+my, decode->row, cnt < fx-x ? cnt : fx-x, decode->palette);
+				if (decode->state == GIFD_BAD) {
+					stopDecode(img);
+					return GDISP_IMAGE_ERR_BADDATA;
+				}
+			}
+		}
+		skipData(img);
+		priv->frame.posend = img->io.pos;
+		stopDecode(img);
+		return GDISP_IMAGE_ERR_OK;
+	}
+
+	/**
+	 * Draw from the canvas.
+	 * If the display still has the last canvas drawn in the same place only the changes are drawn.
+	 */
+	static gdispImageError canvasDraw(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy) {
+		gdispImagePrivate *	priv;
+		gdispImageError		err;
+		coord_t				mx, my, fx, fy;
+
+		priv = img->priv;
+		err = canvasCompose(img);
+
+		// Clip to the image
+		if (sx >= img->width || sy >= img->height) return err;
+		if (sx+cx > img->width) cx = img->width - sx;
+		if (sy+cy > img->height) cy = img->height - sy;
+		mx = sx; my = sy;
+		fx = sx + cx; fy = sy + cy;
+
+		// Clip to the changes
+		if ((priv->flags & GIF_DELTA) && x == priv->lastx && y == priv->lasty && cx == priv->lastcx
+				&& cy == priv->lastcy && sx == priv->lastsx && sy == priv->lastsy) {
+			if (priv->dirtyx > mx) mx = priv->dirtyx;
+			if (priv->dirtyy > my) my = priv->dirtyy;
+			if (priv->dirtyfx < fx) fx = priv->dirtyfx;
+			if (priv->dirtyfy < fy) fy = priv->dirtyfy;
+		}
+		if (fx > mx && fy > my)
+			gdispBlitAreaEx(x+mx-sx, y+my-sy, fx-mx, fy-my, mx, my, img->width, priv->canvas);
+
+		// Remember what the display now has
+		priv->lastx = x; priv->lasty = y;
+		priv->lastcx = cx; priv->lastcy = cy;
+		priv->lastsx = sx; priv->lastsy = sy;
+		priv->dirtyx = priv->dirtyy = priv->dirtyfx = priv->dirtyfy = 0;
+		priv->flags = (priv->flags & ~GIF_DELTA) | GIF_DRAWN;
+		return err;
+	}
+#endif
+
 gdispImageError gdispImageOpen_GIF(gdispImage *img) {
 	gdispImagePrivate *priv;
 	uint8_t		hdr[6];
-	uint16_t	aword;
+	uint16_t	aword, cnt;
 
 	/* Read the file identifier */
 	if (img->io.fns->read(&img->io, hdr, 6) != 6)
@@ -576,32 +959,47 @@ gdispImageError gdispImageOpen_GIF(gdispImage *img) {
 	priv->frame.flags = 0;
 	priv->cache = 0;
 	priv->curcache = 0;
+	#if GDISP_NEED_IMAGE_GIF_CANVAS
+		priv->canvas = 0;
+		priv->saved = 0;
+		priv->canvaspos = 0;
+		priv->dirtyx = priv->dirtyy = priv->dirtyfx = priv->dirtyfy = 0;
+	#endif
 
 	/* Process the Screen Descriptor structure */
 
 	// Read the screen descriptor
 	if (img->io.fns->read(&img->io, priv->buf, 7) != 7)
 		goto baddatacleanup;
-	// Get the width
-	img->width = *(uint16_t *)(((uint8_t *)priv->buf)+0);
-	CONVERT_FROM_WORD_LE(img->width);
-	// Get the height
-	img->height = *(uint16_t *)(((uint8_t *)priv->buf)+2);
-	CONVERT_FROM_WORD_LE(img->height);
+	// Get the width and height. They are unsigned but must fit a coord_t.
+	aword = *(uint16_t *)(((uint8_t *)priv->buf)+0);
+	CONVERT_FROM_WORD_LE(aword);
+	if (!aword || aword > 0x7FFF)
+		goto unsupportedcleanup;
+	img->width = aword;
+	aword = *(uint16_t *)(((uint8_t *)priv->buf)+2);
+	CONVERT_FROM_WORD_LE(aword);
+	if (!aword || aword > 0x7FFF)
+		goto unsupportedcleanup;
+	img->height = aword;
+	// Get the background color index (before the global palette overwrites the buffer)
+	priv->bgcolor = ((uint8_t *)priv->buf)[5];
 	if (((uint8_t *)priv->buf)[4] & 0x80) {
 		// Global color table
 		priv->palsize = 2 << (((uint8_t *)priv->buf)[4] & 0x07);
 		// Allocate the global palette
 		if (!(priv->palette = (color_t *)gdispImageAlloc(img, priv->palsize*sizeof(color_t))))
 			goto nomemcleanup;
-		// Read the global palette
-		for(aword = 0; aword < priv->palsize; aword++) {
-			if (img->io.fns->read(&img->io, &priv->buf, 3) != 3)
+		// Read the global palette a buffer full at a time
+		for(aword = 0; aword < priv->palsize; aword += cnt) {
+			cnt = priv->palsize - aword;
+			if (cnt > sizeof(priv->buf)/3)
+				cnt = sizeof(priv->buf)/3;
+			if (img->io.fns->read(&img->io, priv->buf, cnt*3) != (size_t)cnt*3)
 				goto baddatacleanup;
-			priv->palette[aword] = RGB2COLOR(((uint8_t *)priv->buf)[0], ((uint8_t *)priv->buf)[1], ((uint8_t *)priv->buf)[2]);
+			gdispConvertPixels(priv->palette+aword, GDISP_PIXELFORMAT, priv->buf, GDISP_PIXELFORMAT_RGB24, cnt, 0);
 		}
 	}
-	priv->bgcolor = ((uint8_t *)priv->buf)[5];
 
 	// Save the fram0pos
 	priv->frame0pos = img->io.pos;
@@ -609,9 +1007,27 @@ gdispImageError gdispImageOpen_GIF(gdispImage *img) {
 	// Read the first frame descriptor
 	switch(initFrame(img)) {
 	case GDISP_IMAGE_ERR_OK:					// Everything OK
+		#if GDISP_NEED_IMAGE_GIF_CANVAS
+			// Look past the first frame so we know now if we are animated.
+			// Only another image makes it animated - a still image may be followed by extensions (eg comments).
+			if (findFrameEnd(img)) {
+				while(img->io.fns->read(&img->io, hdr, 2) == 2) {
+					if (hdr[0] == 0x2C) {
+						img->flags |= GDISP_IMAGE_FLG_ANIMATED;
+						break;
+					}
+					if (hdr[0] != 0x21)
+						break;
+					// Skip the data blocks of the extension
+					while(img->io.fns->read(&img->io, hdr, 1) == 1 && hdr[0])
+						img->io.fns->seek(&img->io, img->io.pos + hdr[0]);
+				}
+			}
+		#endif
 		img->type = GDISP_IMAGE_TYPE_GIF;
 		return GDISP_IMAGE_ERR_OK;
 	case GDISP_IMAGE_ERR_UNSUPPORTED:			// Unsupported
+	unsupportedcleanup:
 		gdispImageClose_GIF(img);					// Clean up the private data area
 		return GDISP_IMAGE_ERR_UNSUPPORTED;
 	case GDISP_IMAGE_ERR_NOMEMORY:				// Out of Memory
@@ -639,11 +1055,19 @@ void gdispImageClose_GIF(gdispImage *img) {
 		cache = priv->cache;
 		while(cache) {
 			ncache = cache->next;
+			if (cache->runs)
+				gdispImageFree(img, (void *)cache->runs, cache->runsize*sizeof(uint16_t));
 			gdispImageFree(img, (void *)cache, sizeof(imgcache)+cache->frame.width*cache->frame.height+cache->frame.palsize*sizeof(color_t));
 			cache = ncache;
 		}
 		if (priv->palette)
 			gdispImageFree(img, (void *)priv->palette, priv->palsize*sizeof(color_t));
+		#if GDISP_NEED_IMAGE_GIF_CANVAS
+			if (priv->canvas)
+				gdispImageFree(img, (void *)priv->canvas, img->width*img->height*sizeof(color_t));
+			if (priv->saved)
+				gdispImageFree(img, (void *)priv->saved, priv->savedsize*sizeof(color_t));
+		#endif
 		gdispImageFree(img, (void *)img->priv, sizeof(gdispImagePrivate));
 		img->priv = 0;
 	}
@@ -655,9 +1079,8 @@ gdispImageError gdispImageCache_GIF(gdispImage *img) {
 	imgcache *			cache;
 	imgdecode *			decode;
 	uint8_t *			p;
-	uint8_t *			q;
-	coord_t				mx, my;
-	uint16_t			cnt;
+	coord_t				my, cnt;
+	uint8_t				pass, lastpass;
 
 	/* If we are already cached - just return OK */
 	priv = img->priv;
@@ -672,6 +1095,7 @@ gdispImageError gdispImageCache_GIF(gdispImage *img) {
 	decode = 0;
 	cache->frame = priv->frame;
 	cache->imagebits = (uint8_t *)(cache+1) + cache->frame.palsize*sizeof(color_t);
+	cache->runs = 0;
 	cache->next = 0;
 
 	/* Start the decode */
@@ -693,101 +1117,31 @@ gdispImageError gdispImageCache_GIF(gdispImage *img) {
 	} else
 		cache->palette = priv->palette;
 
-	// Check for interlacing
-	cnt = 0;
+	// Decode each row straight into the cache - in pass order if the frame is interlaced
 	if (cache->frame.flags & GIFL_INTERLACE) {
-		// Every 8th row starting at row 0
-		for(p=cache->imagebits, my=0; my < cache->frame.height; my+=8, p += cache->frame.width*7) {
-			for(mx=0; mx < cache->frame.width; mx++) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						while(cnt < sizeof(decode->buf))
-							decode->buf[cnt++] = (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0;
-					}
-					q = decode->buf;
-				}
-				*p++ = *q++;
-				cnt--;
-			}
-		}
-		// Every 8th row starting at row 4
-		for(p=cache->imagebits+cache->frame.width*4, my=4; my < cache->frame.height; my+=8, p += cache->frame.width*7) {
-			for(mx=0; mx < cache->frame.width; mx++) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						while(cnt < sizeof(decode->buf))
-							decode->buf[cnt++] = (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0;
-					}
-					q = decode->buf;
-				}
-				*p++ = *q++;
-				cnt--;
-			}
-		}
-		// Every 4th row starting at row 2
-		for(p=cache->imagebits+cache->frame.width*2, my=2; my < cache->frame.height; my+=4, p += cache->frame.width*3) {
-			for(mx=0; mx < cache->frame.width; mx++) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						while(cnt < sizeof(decode->buf))
-							decode->buf[cnt++] = (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0;
-					}
-					q = decode->buf;
-				}
-				*p++ = *q++;
-				cnt--;
-			}
-		}
-		// Every 2nd row starting at row 1
-		for(p=cache->imagebits+cache->frame.width, my=1; my < cache->frame.height; my+=2, p += cache->frame.width) {
-			for(mx=0; mx < cache->frame.width; mx++) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						while(cnt < sizeof(decode->buf))
-							decode->buf[cnt++] = (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0;
-					}
-					q = decode->buf;
-				}
-				*p++ = *q++;
-				cnt--;
-			}
-		}
-	} else {
-		// Every row in sequence
-		p=cache->imagebits;
-		for(my=0; my < cache->frame.height; my++) {
-			for(mx=0; mx < cache->frame.width; mx++) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						while(cnt < sizeof(decode->buf))
-							decode->buf[cnt++] = (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0;
-					}
-					q = decode->buf;
-				}
-				*p++ = *q++;
-				cnt--;
+		pass = GIF_PASS_INTERLACED;
+		lastpass = GIF_PASS_SEQUENTIAL-1;
+	} else
+		pass = lastpass = GIF_PASS_SEQUENTIAL;
+	for(; pass <= lastpass; pass++) {
+		for(my = gifPasses[pass].start; my < cache->frame.height; my += gifPasses[pass].step) {
+			p = cache->imagebits + my*cache->frame.width;
+			if ((cnt = decodePixels(img, p, cache->frame.width)) < cache->frame.width) {
+				// Sometimes the image EOF is a bit early - treat the rest as transparent
+				if (decode->state == GIFD_BAD)
+					goto baddatacleanup;
+				memset(p+cnt, (cache->frame.flags & GIFL_TRANSPARENT) ? cache->frame.paltrans : 0, cache->frame.width-cnt);
 			}
 		}
 	}
+
 	// We could be pedantic here but extra bytes won't hurt us
-	while(getbytes(img));
+	skipData(img);
 	priv->frame.posend = cache->frame.posend = img->io.pos;
 
+	// Find the runs of visible pixels
+	cacheRuns(img, cache);
+
 	// Save everything
 	priv->curcache = cache;
 	if (!priv->cache)
@@ -824,12 +1178,21 @@ gdispImageError gdispImageDraw_GIF(gdispImage *img, coord_t x, coord_t y, coord_
 	gdispImagePrivate *	priv;
 	imgdecode *			decode;
 	uint8_t *			q;
-	coord_t				mx, my, fx, fy;
-	uint16_t			cnt, gcnt;
-	uint8_t				col;
+	coord_t				mx, my, fx, fy, cnt;
+	uint8_t				pass, lastpass;
 
 	priv = img->priv;
 
+	#if GDISP_NEED_IMAGE_GIF_CANVAS
+		/* Draw animations from a composited canvas - if we can get the memory */
+		if ((img->flags & GDISP_IMAGE_FLG_ANIMATED) && img->width && img->height) {
+			if (!priv->canvas)
+				priv->canvas = (color_t *)gdispImageAlloc(img, img->width*img->height*sizeof(color_t));
+			if (priv->canvas)
+				return canvasDraw(img, x, y, cx, cy, sx, sy);
+		}
+	#endif
+
 	/* Handle previous frame disposing */
 	if (priv->dispose.flags & (GIFL_DISPOSECLEAR|GIFL_DISPOSEREST)) {
 		// Clip to the disposal area - clip area = mx,my -> fx, fy (sx,sy,cx,cy are unchanged)
@@ -869,35 +1232,39 @@ gdispImageError gdispImageDraw_GIF(gdispImage *img, coord_t x, coord_t y, coord_
 
 	/* Draw from the image cache - if it exists */
 	if (priv->curcache) {
-		imgcache *	cache;
+		imgcache *			cache;
+		const uint16_t *	r;
+		coord_t				ex;
 
 		cache = priv->curcache;
-		q = cache->imagebits+priv->frame.width*sy+sx;
-
-		for(my=sy; my < fy; my++, q += priv->frame.width - cx) {
-			for(gcnt=0, mx=sx, cnt=0; mx < fx; mx++) {
-				col = *q++;
-				if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-					// We have a transparent pixel - dump the buffer to the display
-					switch(gcnt) {
-					case 0:																							break;
-					case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-					default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-					}
+
+		// Without transparency the whole area can be converted and blitted straight from the cache
+		if (!(priv->frame.flags & GIFL_TRANSPARENT)) {
+			gdispBlitConvert(x, y, cx, cy, sx, sy, priv->frame.width, cache->imagebits, GDISP_PIXELFORMAT_INDEX8, cache->palette);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		// No run mask - find the runs between the transparent pixels as we go
+		q = cache->imagebits+priv->frame.width*sy;
+		if (!cache->runs) {
+			for(my=sy; my < fy; my++, q += priv->frame.width)
+				drawRow(img, x, y+my-sy, q, sx, fx, cache->palette);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		// Otherwise blit the saved runs clipped to the area
+		for(r = cache->runs, my = 0; my < sy; my++)
+			r += 1 + 2 * *r;
+		for(; my < fy; my++, q += priv->frame.width) {
+			for(cnt = *r++; cnt; cnt--, r += 2) {
+				mx = r[0];
+				ex = mx + r[1];
+				if (mx >= fx)
 					continue;
-				}
-				priv->buf[gcnt++] = cache->palette[col];
-				if (gcnt >= BLIT_BUFFER_SIZE) {
-					// We have run out of buffer - dump it to the display
-					gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-					gcnt = 0;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
+				if (mx < sx) mx = sx;
+				if (ex > fx) ex = fx;
+				if (ex > mx)
+					drawRun(x+mx-sx, y+my-sy, q, mx, ex-mx, cache->palette);
 			}
 		}
 
@@ -912,244 +1279,30 @@ gdispImageError gdispImageDraw_GIF(gdispImage *img, coord_t x, coord_t y, coord_
 	default:							return GDISP_IMAGE_ERR_BADDATA;
 	}
 	decode = priv->decode;
+	q = decode->row;
 
-	// Check for interlacing
-	cnt = 0;
+	// Decode a row at a time - in pass order if the frame is interlaced
 	if (priv->frame.flags & GIFL_INTERLACE) {
-		// Every 8th row starting at row 0
-		for(my=0; my < priv->frame.height; my+=8) {
-			for(gcnt=0, mx=0; mx < priv->frame.width; mx++, q++, cnt--) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						mx++;
-						break;
-					}
-					q = decode->buf;
-				}
-				if (my >= sy && my < fy && mx >= sx && mx < fx) {
-					col = *q;
-					if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-						// We have a transparent pixel - dump the buffer to the display
-						switch(gcnt) {
-						case 0:																							break;
-						case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-						default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-						}
-						continue;
-					}
-					priv->buf[gcnt++] = decode->palette[col];
-					if (gcnt >= BLIT_BUFFER_SIZE) {
-						// We have run out of buffer - dump it to the display
-						gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-						gcnt = 0;
-					}
-					continue;
-				}
-				// We have finished the visible area - dump the buffer to the display
-				switch(gcnt) {
-				case 0:																							break;
-				case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-				default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
-			}
-		}
-		// Every 8th row starting at row 4
-		for(my=4; my < priv->frame.height; my+=8) {
-			for(gcnt=0, mx=0; mx < priv->frame.width; mx++, q++, cnt--) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						mx++;
-						break;
-					}
-					q = decode->buf;
-				}
-				if (my >= sy && my < fy && mx >= sx && mx < fx) {
-					col = *q;
-					if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-						// We have a transparent pixel - dump the buffer to the display
-						switch(gcnt) {
-						case 0:																							break;
-						case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-						default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-						}
-						continue;
-					}
-					priv->buf[gcnt++] = decode->palette[col];
-					if (gcnt >= BLIT_BUFFER_SIZE) {
-						// We have run out of buffer - dump it to the display
-						gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-						gcnt = 0;
-					}
-					continue;
-				}
-				// We have finished the visible area - dump the buffer to the display
-				switch(gcnt) {
-				case 0:																							break;
-				case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-				default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
-			}
-		}
-		// Every 4th row starting at row 2
-		for(my=2; my < priv->frame.height; my+=4) {
-			for(gcnt=0, mx=0; mx < priv->frame.width; mx++, q++, cnt--) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						mx++;
-						break;
-					}
-					q = decode->buf;
-				}
-				if (my >= sy && my < fy && mx >= sx && mx < fx) {
-					col = *q;
-					if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-						// We have a transparent pixel - dump the buffer to the display
-						switch(gcnt) {
-						case 0:																							break;
-						case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-						default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-						}
-						continue;
-					}
-					priv->buf[gcnt++] = decode->palette[col];
-					if (gcnt >= BLIT_BUFFER_SIZE) {
-						// We have run out of buffer - dump it to the display
-						gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-						gcnt = 0;
-					}
-					continue;
-				}
-				// We have finished the visible area - dump the buffer to the display
-				switch(gcnt) {
-				case 0:																							break;
-				case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-				default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
-			}
-		}
-		// Every 2nd row starting at row 1
-		for(my=1; my < priv->frame.height; my+=2) {
-			for(gcnt=0, mx=0; mx < priv->frame.width; mx++, q++, cnt--) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						mx++;
-						break;
-					}
-					q = decode->buf;
-				}
-				if (my >= sy && my < fy && mx >= sx && mx < fx) {
-					col = *q;
-					if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-						// We have a transparent pixel - dump the buffer to the display
-						switch(gcnt) {
-						case 0:																							break;
-						case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-						default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-						}
-						continue;
-					}
-					priv->buf[gcnt++] = decode->palette[col];
-					if (gcnt >= BLIT_BUFFER_SIZE) {
-						// We have run out of buffer - dump it to the display
-						gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-						gcnt = 0;
-					}
-					continue;
-				}
-				// We have finished the visible area - dump the buffer to the display
-				switch(gcnt) {
-				case 0:																							break;
-				case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-				default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
-			}
-		}
-	} else {
-		// Every row in sequence
-		for(my=0; my < priv->frame.height; my++) {
-			for(gcnt=0, mx=0; mx < priv->frame.width; mx++, q++, cnt--) {
-				if (!cnt) {
-					if (!(cnt = getbytes(img))) {
-						// Sometimes the image EOF is a bit early - treat the rest as transparent
-						if (decode->code_last != decode->code_eof)
-							goto baddatacleanup;
-						mx++;
-						break;
-					}
-					q = decode->buf;
-				}
-				if (my >= sy && my < fy && mx >= sx && mx < fx) {
-					col = *q;
-					if ((priv->frame.flags & GIFL_TRANSPARENT) && col == priv->frame.paltrans) {
-						// We have a transparent pixel - dump the buffer to the display
-						switch(gcnt) {
-						case 0:																							break;
-						case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-						default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-						}
-						continue;
-					}
-					priv->buf[gcnt++] = decode->palette[col];
-					if (gcnt >= BLIT_BUFFER_SIZE) {
-						// We have run out of buffer - dump it to the display
-						gdispBlitAreaEx(x+mx-sx-gcnt+1, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);
-						gcnt = 0;
-					}
-					continue;
-				}
-				// We have finished the visible area - dump the buffer to the display
-				switch(gcnt) {
-				case 0:																							break;
-				case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]); gcnt = 0;						break;
-				default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf); gcnt = 0;	break;
-				}
-			}
-			// We have finished the line - dump the buffer to the display
-			switch(gcnt) {
-			case 0:																				break;
-			case 1:		gdispDrawPixel(x+mx-sx-gcnt, y+my-sy, priv->buf[0]);					break;
-			default:	gdispBlitAreaEx(x+mx-sx-gcnt, y+my-sy, gcnt, 1, 0, 0, gcnt, priv->buf);	break;
-			}
+		pass = GIF_PASS_INTERLACED;
+		lastpass = GIF_PASS_SEQUENTIAL-1;
+	} else
+		pass = lastpass = GIF_PASS_SEQUENTIAL;
+	for(; pass <= lastpass; pass++) {
+		for(my = gifPasses[pass].start; my < priv->frame.height; my += gifPasses[pass].step) {
+			// Once the last pass is past the area there is nothing more to draw
+			if (pass == lastpass && my >= fy)
+				break;
+			// Sometimes the image EOF is a bit early - treat the rest as transparent
+			cnt = decodePixels(img, q, priv->frame.width);
+			if (my >= sy && my < fy && cnt > sx)
+				drawRow(img, x, y+my-sy, q, sx, cnt < fx ? cnt : fx, decode->palette);
+			if (decode->state == GIFD_BAD)
+				goto baddatacleanup;
 		}
 	}
+
 	// We could be pedantic here but extra bytes won't hurt us
-	while (getbytes(img));
+	skipData(img);
 	priv->frame.posend = img->io.pos;
 
 	stopDecode(img);
@@ -1160,6 +1313,154 @@ baddatacleanup:
 	return GDISP_IMAGE_ERR_BADDATA;
 }
 
+#if GDISP_NEED_IMAGE_TRANSFORM
+	/**
+	 * Deliver a row of pixel indexes as display pixels.
+	 * Transparent pixels and any past cnt (the image EOF was early) are masked out.
+	 */
+	static void rowsPut(gdispImage *img, gdispImageRows *pr, coord_t y, const uint8_t *q, coord_t cnt, const color_t *palette, pixel_t *row, uint8_t *mask) {
+		gdispImagePrivate *	priv;
+		coord_t				mx;
+
+		priv = img->priv;
+		if (cnt > pr->cx) cnt = pr->cx;
+		if (cnt > 0)
+			gdispConvertPixels(row, GDISP_PIXELFORMAT, q, GDISP_PIXELFORMAT_INDEX8, cnt, palette);
+		if (cnt >= pr->cx && !(priv->frame.flags & GIFL_TRANSPARENT)) {
+			pr->fn(pr, y, row, 0);
+			return;
+		}
+		for(mx = 0; mx < pr->cx; mx++)
+			mask[mx] = mx < cnt && (!(priv->frame.flags & GIFL_TRANSPARENT) || q[mx] != priv->frame.paltrans);
+		pr->fn(pr, y, row, mask);
+	}
+
+	gdispImageError gdispImageRows_GIF(gdispImage *img, gdispImageRows *pr) {
+		gdispImagePrivate *	priv;
+		imgdecode *			decode;
+		pixel_t *			row;
+		uint8_t *			mask;
+		const uint8_t *		q;
+		color_t				c;
+		coord_t				mx, my, fx, fy, cnt;
+		uint8_t				pass, lastpass;
+
+		priv = img->priv;
+		pr->shift = 0;
+
+		#if GDISP_NEED_IMAGE_GIF_CANVAS
+			/* Animations come from the composited canvas - if we can get the memory */
+			if ((img->flags & GDISP_IMAGE_FLG_ANIMATED) && img->width && img->height) {
+				gdispImageError	err;
+
+				if (!priv->canvas)
+					priv->canvas = (color_t *)gdispImageAlloc(img, img->width*img->height*sizeof(color_t));
+				if (priv->canvas) {
+					err = canvasCompose(img);
+					pr->x = pr->y = 0;
+					pr->cx = img->width;
+					pr->cy = img->height;
+					for(my = 0; my < img->height; my++)
+						pr->fn(pr, my, priv->canvas + my*img->width, 0);
+
+					// The next canvasDraw() can't rely on the display having the last canvas
+					priv->flags &= ~(GIF_DELTA|GIF_DRAWN);
+					return err;
+				}
+			}
+		#endif
+
+		if (!(row = (pixel_t *)gdispImageAlloc(img, img->width*(sizeof(pixel_t)+1))))
+			return GDISP_IMAGE_ERR_NOMEMORY;
+		mask = (uint8_t *)(row + img->width);
+
+		/* The previous frame is disposed of by clearing (see gdispImageDraw_GIF) */
+		if (priv->dispose.flags & (GIFL_DISPOSECLEAR|GIFL_DISPOSEREST)) {
+			fx = priv->dispose.x+priv->dispose.width;
+			fy = priv->dispose.y+priv->dispose.height;
+			if (fx > img->width) fx = img->width;
+			if (fy > img->height) fy = img->height;
+			if (fx > priv->dispose.x && fy > priv->dispose.y) {
+				if ((priv->dispose.flags & GIFL_TRANSPARENT) || priv->bgcolor >= priv->palsize)
+					c = img->bgcolor;
+				else
+					c = priv->palette[priv->bgcolor];
+				pr->x = priv->dispose.x;
+				pr->y = priv->dispose.y;
+				pr->cx = fx - pr->x;
+				pr->cy = fy - pr->y;
+				for(mx = 0; mx < pr->cx; mx++)
+					row[mx] = c;
+				for(my = pr->y; my < fy; my++)
+					pr->fn(pr, my, row, 0);
+			}
+		}
+
+		/* Clip this frame to the image */
+		fx = priv->frame.x+priv->frame.width;
+		fy = priv->frame.y+priv->frame.height;
+		if (fx > img->width) fx = img->width;
+		if (fy > img->height) fy = img->height;
+		if (fx <= priv->frame.x || fy <= priv->frame.y) {
+			gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+			return GDISP_IMAGE_ERR_OK;
+		}
+		pr->x = priv->frame.x;
+		pr->y = priv->frame.y;
+		pr->cx = fx - pr->x;
+		pr->cy = fy - pr->y;
+
+		/* Deliver from the image cache - if it exists */
+		if (priv->curcache) {
+			for(q = priv->curcache->imagebits, my = 0; my < pr->cy; my++, q += priv->frame.width)
+				rowsPut(img, pr, pr->y+my, q, pr->cx, priv->curcache->palette, row, mask);
+			gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		/* Start the decode */
+		switch(startDecode(img)) {
+		case GDISP_IMAGE_ERR_OK:			break;
+		case GDISP_IMAGE_ERR_NOMEMORY:
+			gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+			return GDISP_IMAGE_ERR_NOMEMORY;
+		case GDISP_IMAGE_ERR_BADDATA:
+		default:
+			gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+			return GDISP_IMAGE_ERR_BADDATA;
+		}
+		decode = priv->decode;
+
+		// Decode a row at a time - in pass order if the frame is interlaced
+		if (priv->frame.flags & GIFL_INTERLACE) {
+			pass = GIF_PASS_INTERLACED;
+			lastpass = GIF_PASS_SEQUENTIAL-1;
+		} else
+			pass = lastpass = GIF_PASS_SEQUENTIAL;
+		for(; pass <= lastpass; pass++) {
+			for(my = gifPasses[pass].start; my < priv->frame.height; my += gifPasses[pass].step) {
+				// Sometimes the image EOF is a bit early - treat the rest as transparent
+				cnt = decodePixels(img, decode->row, priv->frame.width);
+				if (my < pr->cy)
+					rowsPut(img, pr, pr->y+my, decode->row, cnt, decode->palette, row, mask);
+				if (decode->state == GIFD_BAD) {
+					stopDecode(img);
+					gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+					return GDISP_IMAGE_ERR_BADDATA;
+				}
+			}
+		}
+
+		// We could be pedantic here but extra bytes won't hurt us
+		skipData(img);
+		priv->frame.posend = img->io.pos;
+
+		stopDecode(img);
+		gdispImageFree(img, row, img->width*(sizeof(pixel_t)+1));
+		return GDISP_IMAGE_ERR_OK;
+	}
+#endif
+
 delaytime_t gdispImageNext_GIF(gdispImage *img) {
 	gdispImagePrivate *	priv;
 	delaytime_t			delay;
@@ -1170,27 +1471,27 @@ delaytime_t gdispImageNext_GIF(gdispImage *img) {
 	// Save the delay and convert to millisecs
 	delay = (delaytime_t)priv->frame.delay * 10;
 
-	// We need to get to the end of this frame
-	if (!priv->frame.posend) {
-		// We don't know where the end of the frame is yet - find it!
-		img->io.fns->seek(&img->io, priv->frame.posimg+1);				// Skip the code size byte too
-		while(1) {
-			if (img->io.fns->read(&img->io, &blocksz, 1) != 1)
-				return TIME_INFINITE;
-			if (!blocksz)
-				break;
-			img->io.fns->seek(&img->io, img->io.pos + blocksz);
-		}
-		priv->frame.posend = img->io.pos;
-	}
+	#if GDISP_NEED_IMAGE_GIF_CANVAS
+		// A frame that is skipped must still be composited
+		if (priv->canvas)
+			canvasCompose(img);
+	#endif
 
-	// Seek to the end of this frame
-	img->io.fns->seek(&img->io, priv->frame.posend);
+	// We need to get to the end of this frame
+	if (!findFrameEnd(img))
+		return TIME_INFINITE;
 
 	// Read the next frame descriptor
 	for(blocksz=0; blocksz < 2; blocksz++) {		// 2 loops max to prevent cycling forever with a bad file
 		switch(initFrame(img)) {
 		case GDISP_IMAGE_ERR_OK:					// Everything OK
+			#if GDISP_NEED_IMAGE_GIF_CANVAS
+				// Only a new frame means the display can be updated with just the changes.
+				// After the last frame every draw is a full one (eg an expose).
+				if (priv->flags & GIF_DRAWN)
+					priv->flags |= GIF_DELTA;
+				priv->flags &= ~GIF_DRAWN;
+			#endif
 			return delay;
 		case GDISP_IMAGE_LOOP:						// Back to the beginning
 			break;
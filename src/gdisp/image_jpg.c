@@ -8,12 +8,1129 @@
 /**
  * @file    src/gdisp/image_jpg.c
  * @brief   GDISP native image code.
+ *
+ * @defgroup Image Image
+ * @ingroup GDISP
  */
 #include "gfx.h"
 
 #if GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_JPG
 
-#error "JPG support not implemented yet"
+#include <string.h>
+
+/**
+ * Helper Routines Needed
+ */
+void *gdispImageAlloc(gdispImage *img, size_t sz);
+void gdispImageFree(gdispImage *img, void *ptr, size_t sz);
+pixel_t *gdispImageCacheFind(gdispImage *img);
+void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels);
+void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels);
+
+/**
+ * How many bytes of the image data to read at a time.
+ * Bigger is faster but uses more RAM.
+ */
+#define JPG_INPUT_BUFFER_SIZE	64
+
+/**
+ * How many bits of a Huffman code are decoded with a single table lookup.
+ * Longer codes are decoded a bit at a time. Each extra bit doubles the size of the tables.
+ */
+#define JPG_FAST_BITS			8
+
+// JPG numbers are big endian
+#define JPG_WORD(p)				((((uint16_t)(p)[0])<<8)|((uint16_t)(p)[1]))
+
+// Limit a value to a sample
+#define JPG_SAMPLE(v)			((v) < 0 ? 0 : ((v) > 255 ? 255 : (v)))
+
+// Round and shift
+#define JPG_DESCALE(v, n)		(((v) + (1 << ((n)-1))) >> (n))
+
+// A Huffman code table
+typedef struct jpghuff {
+	uint16_t	fast[1<<JPG_FAST_BITS];			// value | code length << 8 for the short codes (0 = a longer code)
+	int32_t		maxcode[17];					// The biggest code of each length (-1 = none)
+	int32_t		valoffset[17];					// Where the codes of each length start in values[]
+	uint8_t		values[256];					// The values in code order
+} jpghuff;
+
+// A color component
+typedef struct jpgcomp {
+	uint8_t		id;
+	uint8_t		h, v;							// The sampling factors
+	uint8_t		tq;								// The quantization table
+	uint8_t		td, ta;							// The DC and AC Huffman tables
+} jpgcomp;
+
+typedef struct gdispImagePrivate {
+	uint8_t		flags;
+		#define JPG_FLG_JFIF		0x01		// There is a JFIF marker
+		#define JPG_FLG_ADOBE		0x02		// There is an Adobe marker
+		#define JPG_FLG_ADOBE_YCC	0x04		// The Adobe marker says the colors are YCbCr
+		#define JPG_FLG_RGB			0x08		// The components are RGB rather than YCbCr
+	uint8_t		ncomp;							// The number of components
+	uint8_t		hmax, vmax;						// The biggest sampling factors
+	uint8_t		shift;							// The image is decoded at 1 / (1 << shift) of its size
+	uint8_t		quantmask;						// Which quantization tables have been defined
+	uint16_t	restart;						// The restart interval in MCUs
+	coord_t		width, height;					// The unscaled size of the image
+	jpgcomp		comp[3];
+	uint16_t	quant[4][64];					// The quantization tables in zigzag order
+	jpghuff *	huff[8];						// The DC Huffman tables then the AC Huffman tables
+	size_t		frame0pos;						// The start of the image data
+	pixel_t *	frame0cache;
+	#if GDISP_NEED_IMAGE_TRANSFORM
+		gdispImageRows *	rows;				// Where to deliver the rows of a band (0 = none)
+	#endif
+	} gdispImagePrivate;
+
+// Structure for decoding the image
+typedef struct jpgdecode {
+	size_t		size;							// The size of this allocation
+
+	// The entropy coded data
+	uint32_t	bitbuf;							// Bits waiting to be used - the next one is the top bit
+	uint8_t		bitcnt;							// The number of bits in bitbuf
+	uint8_t		marker;							// A marker that has stopped the data (0 = none)
+	uint8_t		inpos;							// The next byte to use in inbuf[]
+	uint8_t		inlen;							// The number of bytes in inbuf[]
+	uint8_t		inbuf[JPG_INPUT_BUFFER_SIZE];
+	uint16_t	togo;							// MCUs until the next restart marker
+	int16_t		dcpred[3];						// The last DC value of each component
+
+	// The blocks
+	uint8_t		bsize[3];						// The IDCT size of each component's blocks
+	uint8_t		xshift[3], yshift[3];			// How much each component must be stretched
+	int32_t		limit[3];						// The biggest dequantized coefficient of each component
+	int32_t		dequant[3][64];					// The dequantization of each component in zigzag order
+	int32_t		coef[64];						// The current block
+	uint8_t *	plane[3];						// An MCU of samples for each component
+	pixel_t *	pixels;							// An MCU of pixels
+	coord_t		mcuw, mcuh;						// The size of an MCU in pixels
+} jpgdecode;
+
+// Where each coefficient goes in a block - they arrive in zigzag order
+static const uint8_t jpgNatural[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+	};
+
+// The AAN IDCT scale factors (scaled by 1 << 14) in natural order
+static const uint16_t jpgAANScales[64] = {
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	22725, 31521, 29692, 26722, 22725, 17855, 12299,  6270,
+	21407, 29692, 27969, 25172, 21407, 16819, 11585,  5906,
+	19266, 26722, 25172, 22654, 19266, 15137, 10426,  5315,
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	12873, 17855, 16819, 15137, 12873, 10114,  6967,  3552,
+	 8867, 12299, 11585, 10426,  8867,  6967,  4799,  2446,
+	 4520,  6270,  5906,  5315,  4520,  3552,  2446,  1247
+	};
+
+/*-----------------------------------------------------------------------
+ * The IDCTs.
+ *
+ * A full size block uses the fast integer AAN IDCT. The reduced sizes only
+ * calculate the low frequency outputs that a scaled image needs. These
+ * produce the same results as the JDCT_IFAST and reduced size IDCTs in the
+ * IJG library.
+ *-----------------------------------------------------------------------*/
+
+// The AAN constants (scaled by 1 << 8)
+#define AAN_1_082392200		277
+#define AAN_1_414213562		362
+#define AAN_1_847759065		473
+#define AAN_2_613125930		669
+#define AAN_MUL(v, c)		(((v) * (c)) >> 8)
+
+// The reduced IDCT constants (scaled by 1 << 13)
+#define RED_0_211164243		1730
+#define RED_0_509795579		4176
+#define RED_0_601344887		4926
+#define RED_0_720959822		5906
+#define RED_0_765366865		6270
+#define RED_0_850430095		6967
+#define RED_0_899976223		7373
+#define RED_1_061594337		8697
+#define RED_1_272758580		10426
+#define RED_1_451774981		11893
+#define RED_1_847759065		15137
+#define RED_2_172734803		17799
+#define RED_2_562915447		20995
+#define RED_3_624509785		29692
+
+static void idct8(const int32_t *in, uint8_t *out, unsigned stride) {
+	int32_t			ws[64];
+	const int32_t *	p;
+	int32_t *		w;
+	int32_t			t0, t1, t2, t3, t4, t5, t6, t7, t10, t11, t12, t13, z5, z10, z11, z12, z13;
+	int				i;
+
+	// The columns - the dequantization has already scaled them up by 2 bits
+	for(i = 0; i < 8; i++) {
+		p = in + i;
+		w = ws + i;
+		if (!(p[8] | p[16] | p[24] | p[32] | p[40] | p[48] | p[56])) {
+			w[0] = w[8] = w[16] = w[24] = w[32] = w[40] = w[48] = w[56] = p[0];
+			continue;
+		}
+
+		t10 = p[0] + p[32];
+		t11 = p[0] - p[32];
+		t13 = p[16] + p[48];
+		t12 = AAN_MUL(p[16] - p[48], AAN_1_414213562) - t13;
+		t0 = t10 + t13;
+		t3 = t10 - t13;
+		t1 = t11 + t12;
+		t2 = t11 - t12;
+
+		z13 = p[40] + p[24];
+		z10 = p[40] - p[24];
+		z11 = p[8] + p[56];
+		z12 = p[8] - p[56];
+		t7 = z11 + z13;
+		t11 = AAN_MUL(z11 - z13, AAN_1_414213562);
+		z5 = AAN_MUL(z10 + z12, AAN_1_847759065);
+		t10 = AAN_MUL(z12, AAN_1_082392200) - z5;
+		t12 = AAN_MUL(z10, -AAN_2_613125930) + z5;
+		t6 = t12 - t7;
+		t5 = t11 - t6;
+		t4 = t10 + t5;
+
+		w[0] = t0 + t7;
+		w[56] = t0 - t7;
+		w[8] = t1 + t6;
+		w[48] = t1 - t6;
+		w[16] = t2 + t5;
+		w[40] = t2 - t5;
+		w[32] = t3 + t4;
+		w[24] = t3 - t4;
+	}
+
+	// The rows
+	for(w = ws, i = 0; i < 8; i++, w += 8, out += stride) {
+		t10 = w[0] + w[4];
+		t11 = w[0] - w[4];
+		t13 = w[2] + w[6];
+		t12 = AAN_MUL(w[2] - w[6], AAN_1_414213562) - t13;
+		t0 = t10 + t13;
+		t3 = t10 - t13;
+		t1 = t11 + t12;
+		t2 = t11 - t12;
+
+		z13 = w[5] + w[3];
+		z10 = w[5] - w[3];
+		z11 = w[1] + w[7];
+		z12 = w[1] - w[7];
+		t7 = z11 + z13;
+		t11 = AAN_MUL(z11 - z13, AAN_1_414213562);
+		z5 = AAN_MUL(z10 + z12, AAN_1_847759065);
+		t10 = AAN_MUL(z12, AAN_1_082392200) - z5;
+		t12 = AAN_MUL(z10, -AAN_2_613125930) + z5;
+		t6 = t12 - t7;
+		t5 = t11 - t6;
+		t4 = t10 + t5;
+
+		t13 = ((t0 + t7) >> 5) + 128;	out[0] = JPG_SAMPLE(t13);
+		t13 = ((t0 - t7) >> 5) + 128;	out[7] = JPG_SAMPLE(t13);
+		t13 = ((t1 + t6) >> 5) + 128;	out[1] = JPG_SAMPLE(t13);
+		t13 = ((t1 - t6) >> 5) + 128;	out[6] = JPG_SAMPLE(t13);
+		t13 = ((t2 + t5) >> 5) + 128;	out[2] = JPG_SAMPLE(t13);
+		t13 = ((t2 - t5) >> 5) + 128;	out[5] = JPG_SAMPLE(t13);
+		t13 = ((t3 + t4) >> 5) + 128;	out[4] = JPG_SAMPLE(t13);
+		t13 = ((t3 - t4) >> 5) + 128;	out[3] = JPG_SAMPLE(t13);
+	}
+}
+
+static void idct4(const int32_t *in, uint8_t *out, unsigned stride) {
+	int32_t			ws[32];
+	const int32_t *	p;
+	int32_t *		w;
+	int32_t			t0, t2, t10, t12, z1, z2, z3, z4;
+	int				i;
+
+	// The columns - column 4 isn't needed by the rows
+	for(i = 0; i < 8; i++) {
+		if (i == 4)
+			continue;
+		p = in + i;
+		w = ws + i;
+		if (!(p[8] | p[16] | p[24] | p[40] | p[48] | p[56])) {
+			w[0] = w[8] = w[16] = w[24] = p[0] * (1 << 2);
+			continue;
+		}
+
+		t0 = p[0] * (1 << 14);
+		t2 = p[16] * RED_1_847759065 - p[48] * RED_0_765366865;
+		t10 = t0 + t2;
+		t12 = t0 - t2;
+
+		z1 = p[56];
+		z2 = p[40];
+		z3 = p[24];
+		z4 = p[8];
+		t0 = z4 * RED_1_061594337 - z1 * RED_0_211164243 + z2 * RED_1_451774981 - z3 * RED_2_172734803;
+		t2 = z4 * RED_2_562915447 - z1 * RED_0_509795579 - z2 * RED_0_601344887 + z3 * RED_0_899976223;
+
+		w[0] = JPG_DESCALE(t10 + t2, 12);
+		w[24] = JPG_DESCALE(t10 - t2, 12);
+		w[8] = JPG_DESCALE(t12 + t0, 12);
+		w[16] = JPG_DESCALE(t12 - t0, 12);
+	}
+
+	// The rows
+	for(w = ws, i = 0; i < 4; i++, w += 8, out += stride) {
+		t0 = w[0] * (1 << 14);
+		t2 = w[2] * RED_1_847759065 - w[6] * RED_0_765366865;
+		t10 = t0 + t2;
+		t12 = t0 - t2;
+
+		z1 = w[7];
+		z2 = w[5];
+		z3 = w[3];
+		z4 = w[1];
+		t0 = z4 * RED_1_061594337 - z1 * RED_0_211164243 + z2 * RED_1_451774981 - z3 * RED_2_172734803;
+		t2 = z4 * RED_2_562915447 - z1 * RED_0_509795579 - z2 * RED_0_601344887 + z3 * RED_0_899976223;
+
+		z1 = JPG_DESCALE(t10 + t2, 19) + 128;	out[0] = JPG_SAMPLE(z1);
+		z1 = JPG_DESCALE(t10 - t2, 19) + 128;	out[3] = JPG_SAMPLE(z1);
+		z1 = JPG_DESCALE(t12 + t0, 19) + 128;	out[1] = JPG_SAMPLE(z1);
+		z1 = JPG_DESCALE(t12 - t0, 19) + 128;	out[2] = JPG_SAMPLE(z1);
+	}
+}
+
+static void idct2(const int32_t *in, uint8_t *out, unsigned stride) {
+	int32_t			ws[16];
+	const int32_t *	p;
+	int32_t *		w;
+	int32_t			t0, t10, v;
+	int				i;
+
+	// The columns - only the odd columns and column 0 are needed by the rows
+	for(i = 0; i < 8; i++) {
+		if (i == 2 || i == 4 || i == 6)
+			continue;
+		p = in + i;
+		w = ws + i;
+		if (!(p[8] | p[24] | p[40] | p[56])) {
+			w[0] = w[8] = p[0] * (1 << 2);
+			continue;
+		}
+		t10 = p[0] * (1 << 15);
+		t0 = p[8] * RED_3_624509785 - p[24] * RED_1_272758580 + p[40] * RED_0_850430095 - p[56] * RED_0_720959822;
+		w[0] = JPG_DESCALE(t10 + t0, 13);
+		w[8] = JPG_DESCALE(t10 - t0, 13);
+	}
+
+	// The rows
+	for(w = ws, i = 0; i < 2; i++, w += 8, out += stride) {
+		t10 = w[0] * (1 << 15);
+		t0 = w[1] * RED_3_624509785 - w[3] * RED_1_272758580 + w[5] * RED_0_850430095 - w[7] * RED_0_720959822;
+		v = JPG_DESCALE(t10 + t0, 20) + 128;	out[0] = JPG_SAMPLE(v);
+		v = JPG_DESCALE(t10 - t0, 20) + 128;	out[1] = JPG_SAMPLE(v);
+	}
+}
+
+static void idct1(const int32_t *in, uint8_t *out, unsigned stride) {
+	int32_t		v;
+	(void)		stride;
+
+	v = JPG_DESCALE(in[0], 3) + 128;
+	out[0] = JPG_SAMPLE(v);
+}
+
+/*-----------------------------------------------------------------------
+ * The entropy coded data.
+ *-----------------------------------------------------------------------*/
+
+/**
+ * Get the next byte of the image data.
+ *
+ * Return:	The byte or -1 at the end of the file
+ */
+static int getByte(gdispImage *img, jpgdecode *d) {
+	if (d->inpos >= d->inlen) {
+		d->inlen = img->io.fns->read(&img->io, d->inbuf, JPG_INPUT_BUFFER_SIZE);
+		if (!d->inlen || d->inlen > JPG_INPUT_BUFFER_SIZE) {
+			d->inlen = 0;
+			return -1;
+		}
+		d->inpos = 0;
+	}
+	return d->inbuf[d->inpos++];
+}
+
+/**
+ * Find the marker that ends the current data - the data up to it is thrown away.
+ * A missing marker is treated as the end of the image.
+ */
+static void getMarker(gdispImage *img, jpgdecode *d) {
+	int		b;
+
+	while(!d->marker) {
+		if ((b = getByte(img, d)) < 0) {
+			d->marker = 0xD9;
+			break;
+		}
+		if (b != 0xFF)
+			continue;
+		do {
+			b = getByte(img, d);
+		} while(b == 0xFF);
+		if (b < 0)
+			d->marker = 0xD9;
+		else if (b)
+			d->marker = b;
+	}
+}
+
+/**
+ * Make sure there are at least 25 bits ready.
+ * Once a marker is found we return zeros.
+ */
+static void fillBits(gdispImage *img, jpgdecode *d) {
+	int		b, m;
+
+	while(d->bitcnt <= 24) {
+		b = 0;
+		if (!d->marker) {
+			b = getByte(img, d);
+			if (b == 0xFF) {
+				// A zero after an 0xFF is padding - anything else is a marker
+				do {
+					m = getByte(img, d);
+				} while(m == 0xFF);
+				if (m) {
+					d->marker = m < 0 ? 0xD9 : m;
+					b = 0;
+				}
+			} else if (b < 0) {
+				d->marker = 0xD9;
+				b = 0;
+			}
+		}
+		d->bitbuf |= (uint32_t)b << (24 - d->bitcnt);
+		d->bitcnt += 8;
+	}
+}
+
+/**
+ * Get cnt bits as a signed coefficient (1 <= cnt <= 16)
+ */
+static int32_t getValue(gdispImage *img, jpgdecode *d, uint8_t cnt) {
+	int32_t		v;
+
+	if (d->bitcnt < cnt)
+		fillBits(img, d);
+	v = d->bitbuf >> (32 - cnt);
+	d->bitbuf <<= cnt;
+	d->bitcnt -= cnt;
+
+	// A leading 0 bit means a negative value
+	if (v < (1 << (cnt-1)))
+		v += 1 - (1 << cnt);
+	return v;
+}
+
+/**
+ * Decode a value.
+ *
+ * Return:	The value or -1 if the code is invalid
+ */
+static int getHuff(gdispImage *img, jpgdecode *d, const jpghuff *h) {
+	uint32_t	code;
+	uint16_t	e;
+	uint8_t		len;
+
+	if (d->bitcnt < 16)
+		fillBits(img, d);
+
+	// The short codes
+	if ((e = h->fast[d->bitbuf >> (32-JPG_FAST_BITS)])) {
+		d->bitbuf <<= e >> 8;
+		d->bitcnt -= e >> 8;
+		return e & 0xFF;
+	}
+
+	// Longer codes a bit at a time
+	for(len = JPG_FAST_BITS+1; len <= 16; len++) {
+		code = d->bitbuf >> (32 - len);
+		if ((int32_t)code <= h->maxcode[len]) {
+			d->bitbuf <<= len;
+			d->bitcnt -= len;
+			return h->values[(int32_t)code + h->valoffset[len]];
+		}
+	}
+	return -1;
+}
+
+/**
+ * Decode a block of a component. If coef is NULL the block is skipped.
+ *
+ * Return:	FALSE if the data is corrupt
+ */
+static bool_t getBlock(gdispImage *img, jpgdecode *d, uint8_t c, int32_t *coef) {
+	gdispImagePrivate *	priv;
+	const int32_t *		dq;
+	int32_t				v, lim;
+	int					s, k;
+
+	priv = img->priv;
+
+	// The DC value
+	if ((s = getHuff(img, d, priv->huff[priv->comp[c].td])) < 0 || s > 11)
+		return FALSE;
+	if (s) {
+		v = d->dcpred[c] + getValue(img, d, s);
+		d->dcpred[c] = v < -2048 ? -2048 : (v > 2047 ? 2047 : v);
+	}
+
+	// Valid data never gets near the limit - it just keeps corrupt data from overflowing the IDCT
+	dq = d->dequant[c];
+	lim = d->limit[c];
+	if (coef) {
+		memset(coef, 0, 64*sizeof(int32_t));
+		v = d->dcpred[c] * dq[0];
+		coef[0] = v < -lim ? -lim : (v > lim ? lim : v);
+	}
+
+	// The AC values
+	for(k = 1; k < 64; k++) {
+		if ((s = getHuff(img, d, priv->huff[4+priv->comp[c].ta])) < 0)
+			return FALSE;
+		if (!(s & 0x0F)) {
+			if (s != 0xF0)
+				break;				// End of block
+			k += 15;				// 16 zeros
+			continue;
+		}
+		k += s >> 4;
+		if (k > 63 || (s & 0x0F) > 10)
+			return FALSE;
+		v = getValue(img, d, s & 0x0F);
+		if (coef) {
+			v *= dq[k];
+			coef[jpgNatural[k]] = v < -lim ? -lim : (v > lim ? lim : v);
+		}
+	}
+	return TRUE;
+}
+
+/*-----------------------------------------------------------------------
+ * The decoding.
+ *-----------------------------------------------------------------------*/
+
+/**
+ * Get ready for decoding the image.
+ */
+static gdispImageError startDecode(gdispImage *img, jpgdecode **pd) {
+	gdispImagePrivate *	priv;
+	jpgdecode *			d;
+	size_t				sz;
+	uint8_t *			p;
+	uint8_t				c, bs, minbs, r;
+	int					k;
+
+	priv = img->priv;
+
+	// The size of the blocks of each component.
+	// Chroma that is stretched is decoded at a bigger size instead where we can.
+	minbs = 8 >> priv->shift;
+	sz = 0;
+	for(c = 0; c < priv->ncomp; c++) {
+		for(bs = minbs; bs < 8; bs <<= 1) {
+			if ((priv->hmax * minbs) % (priv->comp[c].h * bs * 2) || (priv->vmax * minbs) % (priv->comp[c].v * bs * 2))
+				break;
+		}
+		sz += (priv->comp[c].h * bs) * (priv->comp[c].v * bs);
+	}
+
+	// Allocate the decode structure, an MCU of pixels and an MCU of samples for each component
+	sz += sizeof(jpgdecode) + (priv->hmax * minbs) * (priv->vmax * minbs) * sizeof(pixel_t);
+	if (!(d = (jpgdecode *)gdispImageAlloc(img, sz)))
+		return GDISP_IMAGE_ERR_NOMEMORY;
+	d->size = sz;
+	d->mcuw = priv->hmax * minbs;
+	d->mcuh = priv->vmax * minbs;
+	d->pixels = (pixel_t *)(d+1);
+	p = (uint8_t *)(d->pixels + d->mcuw * d->mcuh);
+
+	for(c = 0; c < priv->ncomp; c++) {
+		for(bs = minbs; bs < 8; bs <<= 1) {
+			if ((priv->hmax * minbs) % (priv->comp[c].h * bs * 2) || (priv->vmax * minbs) % (priv->comp[c].v * bs * 2))
+				break;
+		}
+		d->bsize[c] = bs;
+		d->plane[c] = p;
+		p += (priv->comp[c].h * bs) * (priv->comp[c].v * bs);
+
+		// How much to stretch the samples
+		for(r = d->mcuw / (priv->comp[c].h * bs), d->xshift[c] = 0; r > 1; r >>= 1, d->xshift[c]++);
+		for(r = d->mcuh / (priv->comp[c].v * bs), d->yshift[c] = 0; r > 1; r >>= 1, d->yshift[c]++);
+
+		// The dequantization - the full size IDCT needs the AAN scale factors
+		if (bs == 8) {
+			for(k = 0; k < 64; k++)
+				d->dequant[c][k] = ((int32_t)priv->quant[priv->comp[c].tq][k] * jpgAANScales[jpgNatural[k]] + (1 << 11)) >> 12;
+			d->limit[c] = 16383;
+		} else {
+			for(k = 0; k < 64; k++)
+				d->dequant[c][k] = priv->quant[priv->comp[c].tq][k];
+			d->limit[c] = 2047;
+		}
+		d->dcpred[c] = 0;
+	}
+
+	// Start the image data
+	d->bitbuf = 0;
+	d->bitcnt = 0;
+	d->marker = 0;
+	d->inpos = d->inlen = 0;
+	d->togo = priv->restart;
+	img->io.fns->seek(&img->io, priv->frame0pos);
+
+	*pd = d;
+	return GDISP_IMAGE_ERR_OK;
+}
+
+/**
+ * Convert the part of the current MCU that is in the area to pixels
+ */
+static void getPixels(gdispImage *img, jpgdecode *d, coord_t ax0, coord_t ay0, coord_t ax1, coord_t ay1, pixel_t *dst, coord_t stride) {
+	gdispImagePrivate *	priv;
+	const uint8_t		*py, *pcb, *pcr;
+	coord_t				i, j;
+	int32_t				y, cb, cr, r, g, b;
+
+	priv = img->priv;
+	for(j = ay0; j < ay1; j++, dst += stride) {
+		py = d->plane[0] + (j >> d->yshift[0]) * priv->comp[0].h * d->bsize[0];
+
+		// Grayscale
+		if (priv->ncomp == 1) {
+			for(i = ax0; i < ax1; i++) {
+				y = py[i >> d->xshift[0]];
+				dst[i] = RGB2COLOR(y, y, y);
+			}
+			continue;
+		}
+
+		pcb = d->plane[1] + (j >> d->yshift[1]) * priv->comp[1].h * d->bsize[1];
+		pcr = d->plane[2] + (j >> d->yshift[2]) * priv->comp[2].h * d->bsize[2];
+
+		// RGB
+		if ((priv->flags & JPG_FLG_RGB)) {
+			for(i = ax0; i < ax1; i++)
+				dst[i] = RGB2COLOR(py[i >> d->xshift[0]], pcb[i >> d->xshift[1]], pcr[i >> d->xshift[2]]);
+			continue;
+		}
+
+		// YCbCr
+		for(i = ax0; i < ax1; i++) {
+			y = py[i >> d->xshift[0]];
+			cb = (int32_t)pcb[i >> d->xshift[1]] - 128;
+			cr = (int32_t)pcr[i >> d->xshift[2]] - 128;
+			r = y + ((91881 * cr + 32768) >> 16);
+			g = y + ((-22554 * cb - 46802 * cr + 32768) >> 16);
+			b = y + ((116130 * cb + 32768) >> 16);
+			dst[i] = RGB2COLOR(JPG_SAMPLE(r), JPG_SAMPLE(g), JPG_SAMPLE(b));
+		}
+	}
+}
+
+/**
+ * Decode the image - either drawing the area or filling the cache.
+ * If priv->rows is set the cache is just a band of MCU rows that is delivered as each is finished.
+ */
+static gdispImageError decodeImage(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy, pixel_t *cache) {
+	gdispImagePrivate *	priv;
+	jpgdecode *			d;
+	gdispImageError		err;
+	coord_t				mx, my, mcux, mcuy, px, py, ax0, ay0, ax1, ay1;
+	uint8_t				c, bx, by, bs;
+	bool_t				inrow, draw;
+	unsigned			stride;
+
+	priv = img->priv;
+	if ((err = startDecode(img, &d)))
+		return err;
+
+	mcux = (priv->width + priv->hmax*8 - 1) / (priv->hmax*8);
+	mcuy = (priv->height + priv->vmax*8 - 1) / (priv->vmax*8);
+	for(my = 0, py = 0; my < mcuy && py < sy+cy; my++, py += d->mcuh) {
+		inrow = py + d->mcuh > sy;
+		for(mx = 0, px = 0; mx < mcux; mx++, px += d->mcuw) {
+			// Restart markers reset the DC values
+			if (priv->restart) {
+				if (!d->togo) {
+					d->bitbuf = 0;
+					d->bitcnt = 0;
+					getMarker(img, d);
+					if (d->marker >= 0xD0 && d->marker <= 0xD7)
+						d->marker = 0;
+					for(c = 0; c < priv->ncomp; c++)
+						d->dcpred[c] = 0;
+					d->togo = priv->restart;
+				}
+				d->togo--;
+			}
+
+			// MCUs outside the area are decoded but we don't need their IDCT
+			draw = inrow && px < sx+cx && px + d->mcuw > sx;
+			for(c = 0; c < priv->ncomp; c++) {
+				bs = d->bsize[c];
+				stride = priv->comp[c].h * bs;
+				for(by = 0; by < priv->comp[c].v; by++) {
+					for(bx = 0; bx < priv->comp[c].h; bx++) {
+						if (!getBlock(img, d, c, draw ? d->coef : 0)) {
+							err = GDISP_IMAGE_ERR_BADDATA;
+							goto done;
+						}
+						if (!draw)
+							continue;
+						switch(bs) {
+						case 8:	idct8(d->coef, d->plane[c] + by*bs*stride + bx*bs, stride);	break;
+						case 4:	idct4(d->coef, d->plane[c] + by*bs*stride + bx*bs, stride);	break;
+						case 2:	idct2(d->coef, d->plane[c] + by*bs*stride + bx*bs, stride);	break;
+						default: idct1(d->coef, d->plane[c] + by*bs*stride + bx*bs, stride);	break;
+						}
+					}
+				}
+			}
+			if (!draw)
+				continue;
+
+			// The part of the MCU in the area
+			ax0 = px < sx ? sx - px : 0;
+			ay0 = py < sy ? sy - py : 0;
+			ax1 = px + d->mcuw > sx+cx ? sx+cx - px : d->mcuw;
+			ay1 = py + d->mcuh > sy+cy ? sy+cy - py : d->mcuh;
+			#if GDISP_NEED_IMAGE_TRANSFORM
+				if (priv->rows)
+					getPixels(img, d, ax0, ay0, ax1, ay1, cache + ay0*img->width + px, img->width);
+				else
+			#endif
+			if (cache)
+				getPixels(img, d, ax0, ay0, ax1, ay1, cache + (py+ay0)*img->width + px, img->width);
+			else {
+				getPixels(img, d, ax0, ay0, ax1, ay1, d->pixels + ay0*d->mcuw, d->mcuw);
+				gdispBlitAreaEx(x+px+ax0-sx, y+py+ay0-sy, ax1-ax0, ay1-ay0, ax0, ay0, d->mcuw, d->pixels);
+			}
+		}
+
+		#if GDISP_NEED_IMAGE_TRANSFORM
+			// The band is finished
+			if (priv->rows) {
+				for(ay0 = 0; ay0 < d->mcuh && py+ay0 < img->height; ay0++)
+					priv->rows->fn(priv->rows, py+ay0, cache + ay0*img->width, 0);
+			}
+		#endif
+	}
+
+done:
+	gdispImageFree(img, d, d->size);
+	return err;
+}
+
+/**
+ * Build a Huffman table.
+ *
+ * Return:	FALSE if the table is invalid
+ */
+static bool_t buildHuff(jpghuff *h, const uint8_t *counts) {
+	int32_t		code;
+	uint16_t	k, i, j;
+	uint8_t		len;
+
+	memset(h->fast, 0, sizeof(h->fast));
+	for(code = 0, k = 0, len = 1; len <= 16; len++, code <<= 1) {
+		h->valoffset[len] = k - code;
+		for(i = 0; i < counts[len-1]; i++, k++, code++) {
+			// Too many codes of this length - check before the code is used to fill the fast table
+			if (code >= (1 << len))
+				return FALSE;
+			if (len <= JPG_FAST_BITS) {
+				for(j = 0; j < (1 << (JPG_FAST_BITS-len)); j++)
+					h->fast[(code << (JPG_FAST_BITS-len)) | j] = (len << 8) | h->values[k];
+			}
+		}
+		h->maxcode[len] = counts[len-1] ? code - 1 : -1;
+	}
+	return TRUE;
+}
+
+gdispImageError gdispImageOpen_JPG(gdispImage *img) {
+	gdispImagePrivate *priv;
+	uint8_t		buf[18];
+	uint16_t	len, i, n;
+	uint8_t		c, t;
+
+	/* Read the file identifier */
+	if (img->io.fns->read(&img->io, buf, 3) != 3)
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+	if (buf[0] != 0xFF || buf[1] != 0xD8 || buf[2] != 0xFF)
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+
+	/* We know we are a JPG format image */
+	img->flags = 0;
+
+	/* Allocate our private area */
+	if (!(img->priv = (gdispImagePrivate *)gdispImageAlloc(img, sizeof(gdispImagePrivate))))
+		return GDISP_IMAGE_ERR_NOMEMORY;
+
+	/* Initialise the essential bits in the private area */
+	priv = img->priv;
+	priv->flags = 0;
+	priv->ncomp = 0;
+	priv->shift = 0;
+	priv->quantmask = 0;
+	priv->restart = 0;
+	priv->frame0cache = 0;
+	#if GDISP_NEED_IMAGE_TRANSFORM
+		priv->rows = 0;
+	#endif
+	for(i = 0; i < 8; i++)
+		priv->huff[i] = 0;
+
+	/* Process the markers up to the image data */
+	img->io.fns->seek(&img->io, 2);
+	while(1) {
+		// Get the marker (skipping any padding) and the segment length
+		if (img->io.fns->read(&img->io, buf, 2) != 2 || buf[0] != 0xFF)
+			goto baddatacleanup;
+		while(buf[1] == 0xFF) {
+			if (img->io.fns->read(&img->io, buf+1, 1) != 1)
+				goto baddatacleanup;
+		}
+		t = buf[1];
+		if (t == 0xD8 || t == 0xD9 || (t >= 0xD0 && t <= 0xD7) || t == 0x01)
+			goto baddatacleanup;
+		if (img->io.fns->read(&img->io, buf, 2) != 2 || (len = JPG_WORD(buf)) < 2)
+			goto baddatacleanup;
+		len -= 2;
+
+		switch(t) {
+		case 0xC0:				// Baseline
+		case 0xC1:				// Extended sequential with Huffman codes
+			if (priv->ncomp || len < 6 || img->io.fns->read(&img->io, buf, 6) != 6)
+				goto baddatacleanup;
+			len -= 6;
+			if (buf[0] != 8 || (buf[5] != 1 && buf[5] != 3))
+				goto unsupportedcleanup;
+			priv->height = JPG_WORD(buf+1);
+			priv->width = JPG_WORD(buf+3);
+			priv->ncomp = buf[5];
+			if (!priv->width || !priv->height || JPG_WORD(buf+1) > 0x7FFF || JPG_WORD(buf+3) > 0x7FFF)
+				goto unsupportedcleanup;
+			if (len < priv->ncomp*3 || img->io.fns->read(&img->io, buf, priv->ncomp*3) != priv->ncomp*3U)
+				goto baddatacleanup;
+			len -= priv->ncomp*3;
+			priv->hmax = priv->vmax = 1;
+			for(n = 0, c = 0; c < priv->ncomp; c++) {
+				priv->comp[c].id = buf[c*3];
+				priv->comp[c].h = buf[c*3+1] >> 4;
+				priv->comp[c].v = buf[c*3+1] & 0x0F;
+				priv->comp[c].tq = buf[c*3+2];
+				if (priv->ncomp == 1)
+					priv->comp[c].h = priv->comp[c].v = 1;		// A single component is never interleaved
+				if (priv->comp[c].h < 1 || priv->comp[c].h > 4 || priv->comp[c].v < 1 || priv->comp[c].v > 4 || priv->comp[c].tq > 3)
+					goto baddatacleanup;
+				if (priv->comp[c].h > priv->hmax) priv->hmax = priv->comp[c].h;
+				if (priv->comp[c].v > priv->vmax) priv->vmax = priv->comp[c].v;
+				n += priv->comp[c].h * priv->comp[c].v;
+			}
+			if (n > 10)
+				goto baddatacleanup;
+
+			// We only stretch the components by 1, 2 or 4 times
+			for(c = 0; c < priv->ncomp; c++) {
+				if ((priv->hmax % priv->comp[c].h) || (priv->vmax % priv->comp[c].v)
+						|| priv->hmax / priv->comp[c].h == 3 || priv->vmax / priv->comp[c].v == 3)
+					goto unsupportedcleanup;
+			}
+			img->width = priv->width;
+			img->height = priv->height;
+			break;
+
+		case 0xC2: case 0xC3:	// Progressive and lossless
+		case 0xC5: case 0xC6: case 0xC7:
+		case 0xC9: case 0xCA: case 0xCB:
+		case 0xCD: case 0xCE: case 0xCF:
+			goto unsupportedcleanup;
+
+		case 0xC4:				// Huffman tables
+			while(len) {
+				if (len < 17 || img->io.fns->read(&img->io, buf, 17) != 17)
+					goto baddatacleanup;
+				len -= 17;
+				if ((buf[0] >> 4) > 1 || (buf[0] & 0x0F) > 3)
+					goto baddatacleanup;
+				t = ((buf[0] >> 4) << 2) | (buf[0] & 0x0F);
+				for(n = 0, i = 1; i < 17; i++)
+					n += buf[i];
+				if (n > 256 || n > len)
+					goto baddatacleanup;
+				if (!priv->huff[t] && !(priv->huff[t] = (jpghuff *)gdispImageAlloc(img, sizeof(jpghuff))))
+					goto nomemcleanup;
+				if (img->io.fns->read(&img->io, priv->huff[t]->values, n) != n || !buildHuff(priv->huff[t], buf+1))
+					goto baddatacleanup;
+				len -= n;
+			}
+			break;
+
+		case 0xDB:				// Quantization tables
+			while(len) {
+				if (img->io.fns->read(&img->io, buf, 1) != 1 || (buf[0] >> 4) > 1 || (buf[0] & 0x0F) > 3)
+					goto baddatacleanup;
+				t = buf[0] & 0x0F;
+				n = (buf[0] >> 4) ? 128 : 64;
+				if (len < n+1)
+					goto baddatacleanup;
+				len -= n+1;
+				for(i = 0; i < 64; i++) {
+					if (img->io.fns->read(&img->io, buf, n/64) != n/64U)
+						goto baddatacleanup;
+					priv->quant[t][i] = n == 64 ? buf[0] : JPG_WORD(buf);
+				}
+				priv->quantmask |= 1 << t;
+			}
+			break;
+
+		case 0xDD:				// Restart interval
+			if (len != 2 || img->io.fns->read(&img->io, buf, 2) != 2)
+				goto baddatacleanup;
+			priv->restart = JPG_WORD(buf);
+			len = 0;
+			break;
+
+		case 0xE0:				// JFIF
+			if (len >= 5) {
+				if (img->io.fns->read(&img->io, buf, 5) != 5)
+					goto baddatacleanup;
+				len -= 5;
+				if (!memcmp(buf, "JFIF", 5))
+					priv->flags |= JPG_FLG_JFIF;
+			}
+			break;
+
+		case 0xEE:				// Adobe
+			if (len >= 12) {
+				if (img->io.fns->read(&img->io, buf, 12) != 12)
+					goto baddatacleanup;
+				len -= 12;
+				if (!memcmp(buf, "Adobe", 5)) {
+					priv->flags |= JPG_FLG_ADOBE;
+					if (buf[11])
+						priv->flags |= JPG_FLG_ADOBE_YCC;
+				}
+			}
+			break;
+
+		case 0xDA:				// Start of the image data
+			if (!priv->ncomp || len < 1 || img->io.fns->read(&img->io, buf, 1) != 1 || buf[0] != priv->ncomp)
+				goto unsupportedcleanup;
+			if (len != 4 + priv->ncomp*2 || img->io.fns->read(&img->io, buf, len-1) != len-1U)
+				goto baddatacleanup;
+			for(c = 0; c < priv->ncomp; c++) {
+				if (buf[c*2] != priv->comp[c].id)
+					goto unsupportedcleanup;
+				priv->comp[c].td = buf[c*2+1] >> 4;
+				priv->comp[c].ta = buf[c*2+1] & 0x0F;
+				if (priv->comp[c].td > 3 || priv->comp[c].ta > 3 || !priv->huff[priv->comp[c].td] || !priv->huff[4+priv->comp[c].ta]
+						|| !(priv->quantmask & (1 << priv->comp[c].tq)))
+					goto baddatacleanup;
+			}
+			if (buf[c*2] != 0 || buf[c*2+1] != 63 || buf[c*2+2] != 0)
+				goto unsupportedcleanup;
+
+			// Work out the color space the same way as the IJG library
+			if (priv->ncomp == 3 && !(priv->flags & JPG_FLG_JFIF)) {
+				if ((priv->flags & JPG_FLG_ADOBE)) {
+					if (!(priv->flags & JPG_FLG_ADOBE_YCC))
+						priv->flags |= JPG_FLG_RGB;
+				} else if (priv->comp[0].id == 'R' && priv->comp[1].id == 'G' && priv->comp[2].id == 'B')
+					priv->flags |= JPG_FLG_RGB;
+			}
+
+			priv->frame0pos = img->io.pos;
+			img->type = GDISP_IMAGE_TYPE_JPG;
+			return GDISP_IMAGE_ERR_OK;
+
+		default:				// Anything else we can skip
+			break;
+		}
+
+		// Skip the rest of the segment
+		img->io.fns->seek(&img->io, img->io.pos+len);
+	}
+
+nomemcleanup:
+	gdispImageClose_JPG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_NOMEMORY;		// Out of memory
+
+baddatacleanup:
+	gdispImageClose_JPG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_BADDATA;			// Oops - something wrong
+
+unsupportedcleanup:
+	gdispImageClose_JPG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_UNSUPPORTED;		// Not supported
+}
+
+void gdispImageClose_JPG(gdispImage *img) {
+	uint8_t		i;
+
+	if (img->priv) {
+		for(i = 0; i < 8; i++) {
+			if (img->priv->huff[i])
+				gdispImageFree(img, (void *)img->priv->huff[i], sizeof(jpghuff));
+		}
+		if (img->priv->frame0cache)
+			gdispImageCacheRelease(img, img->priv->frame0cache);
+		gdispImageFree(img, (void *)img->priv, sizeof(gdispImagePrivate));
+		img->priv = 0;
+	}
+	img->io.fns->close(&img->io);
+}
+
+gdispImageError gdispImageCache_JPG(gdispImage *img) {
+	gdispImagePrivate *	priv;
+	gdispImageError		err;
+
+	/* If we are already cached - just return OK */
+	priv = img->priv;
+	if (priv->frame0cache)
+		return GDISP_IMAGE_ERR_OK;
+
+	/* Another image from the same source may have already decoded it */
+	if ((priv->frame0cache = gdispImageCacheFind(img)))
+		return GDISP_IMAGE_ERR_OK;
+
+	/* We need to allocate the cache */
+	priv->frame0cache = (pixel_t *)gdispImageAlloc(img, img->width*img->height*sizeof(pixel_t));
+	if (!priv->frame0cache)
+		return GDISP_IMAGE_ERR_NOMEMORY;
+
+	/* Decode the entire image into the cache */
+	if ((err = decodeImage(img, 0, 0, img->width, img->height, 0, 0, priv->frame0cache))) {
+		gdispImageFree(img, (void *)priv->frame0cache, img->width*img->height*sizeof(pixel_t));
+		priv->frame0cache = 0;
+		return err;
+	}
+	gdispImageCacheAdd(img, priv->frame0cache);
+	return GDISP_IMAGE_ERR_OK;
+}
+
+gdispImageError gdispImageDraw_JPG(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy) {
+	gdispImagePrivate *	priv;
+
+	priv = img->priv;
+
+	/* Check some reasonableness */
+	if (sx >= img->width || sy >= img->height) return GDISP_IMAGE_ERR_OK;
+	if (sx + cx > img->width) cx = img->width - sx;
+	if (sy + cy > img->height) cy = img->height - sy;
+
+	/* Draw from the image cache - if it exists */
+	if (priv->frame0cache) {
+		gdispBlitAreaEx(x, y, cx, cy, sx, sy, img->width, priv->frame0cache);
+		return GDISP_IMAGE_ERR_OK;
+	}
+
+	/* Decode just the MCUs we need */
+	return decodeImage(img, x, y, cx, cy, sx, sy, 0);
+}
+
+#if GDISP_NEED_IMAGE_TRANSFORM
+	gdispImageError gdispImageRows_JPG(gdispImage *img, gdispImageRows *pr) {
+		gdispImagePrivate *	priv;
+		gdispImageError		err;
+		pixel_t *			band;
+		size_t				sz;
+		coord_t				width, height, y;
+		uint8_t				shift;
+
+		priv = img->priv;
+
+		/* Deliver the rows straight from the image cache - if it exists */
+		if (priv->frame0cache) {
+			pr->shift = 0;
+			pr->x = pr->y = 0;
+			pr->cx = img->width;
+			pr->cy = img->height;
+			for(y = 0; y < img->height; y++)
+				pr->fn(pr, y, priv->frame0cache + (size_t)y * img->width, 0);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		/* Reduce the image in the IDCT if we can - it costs nothing. The scale is put back afterwards. */
+		if (pr->shift > 3 - priv->shift)
+			pr->shift = 3 - priv->shift;
+		shift = priv->shift;
+		width = img->width;
+		height = img->height;
+		priv->shift += pr->shift;
+		img->width = (priv->width + (1 << priv->shift) - 1) >> priv->shift;
+		img->height = (priv->height + (1 << priv->shift) - 1) >> priv->shift;
+		pr->x = pr->y = 0;
+		pr->cx = img->width;
+		pr->cy = img->height;
+
+		/* Decode a band of MCU rows at a time */
+		sz = img->width * ((priv->vmax*8) >> priv->shift) * sizeof(pixel_t);
+		if (!(band = (pixel_t *)gdispImageAlloc(img, sz)))
+			err = GDISP_IMAGE_ERR_NOMEMORY;
+		else {
+			priv->rows = pr;
+			err = decodeImage(img, 0, 0, img->width, img->height, 0, 0, band);
+			priv->rows = 0;
+			gdispImageFree(img, band, sz);
+		}
+
+		priv->shift = shift;
+		img->width = width;
+		img->height = height;
+		return err;
+	}
+#endif
+
+delaytime_t gdispImageNext_JPG(gdispImage *img) {
+	(void) img;
+
+	/* No more frames/pages */
+	return TIME_INFINITE;
+}
+
+gdispImageError gdispImageSetScale_JPG(gdispImage *img, uint8_t scale) {
+	gdispImagePrivate *	priv;
+	uint8_t				shift;
+
+	if (img->type != GDISP_IMAGE_TYPE_JPG)
+		return GDISP_IMAGE_ERR_UNSUPPORTED;
+	switch(scale) {
+	case 1:		shift = 0;	break;
+	case 2:		shift = 1;	break;
+	case 4:		shift = 2;	break;
+	case 8:		shift = 3;	break;
+	default:	return GDISP_IMAGE_ERR_UNSUPPORTED;
+	}
+
+	/* Any cached frame is the wrong size now */
+	priv = img->priv;
+	if (priv->frame0cache) {
+		gdispImageCacheRelease(img, priv->frame0cache);
+		priv->frame0cache = 0;
+	}
+
+	priv->shift = shift;
+	img->width = (priv->width + scale - 1) >> shift;
+	img->height = (priv->height + scale - 1) >> shift;
+	return GDISP_IMAGE_ERR_OK;
+}
 
 #endif /* GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_JPG */
 /** @} */
@@ -27,14 +27,43 @@
  */
 void *gdispImageAlloc(gdispImage *img, size_t sz);
 void gdispImageFree(gdispImage *img, void *ptr, size_t sz);
+pixel_t *gdispImageCacheFind(gdispImage *img);
+void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels);
+void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels);
 
 typedef struct gdispImagePrivate {
 	pixel_t		*frame0cache;
+	unsigned	format;						// The pixel format of the image
+	size_t		pixelsize;					// The number of bytes in each pixel of the image
+	coord_t		maxpixels;					// The maximum number of pixels that can be read into buf
 	pixel_t		buf[BLIT_BUFFER_SIZE];
 	} gdispImagePrivate;
 
+/**
+ * Read pixels from the current file position and convert them to display pixels.
+ * The pixels are read into the end of the buffer so that they can be converted in place.
+ */
+static bool_t readPixels(gdispImage *img, pixel_t *dst, coord_t cnt) {
+	gdispImagePrivate *	priv;
+	uint8_t *			p;
+	size_t				len;
+
+	priv = img->priv;
+	len = cnt * priv->pixelsize;
+
+	/* Display pixels can be read straight in */
+	if (priv->format == GDISP_PIXELFORMAT)
+		return img->io.fns->read(&img->io, dst, len) == len;
+
+	p = (uint8_t *)priv->buf + sizeof(priv->buf) - len;
+	if (img->io.fns->read(&img->io, p, len) != len)
+		return FALSE;
+	return gdispConvertPixels(dst, GDISP_PIXELFORMAT, p, priv->format, cnt, 0);
+}
+
 gdispImageError gdispImageOpen_NATIVE(gdispImage *img) {
 	uint8_t		hdr[HEADER_SIZE];
+	unsigned	format;
 
 	/* Read the 8 byte header */
 	if (img->io.fns->read(&img->io, hdr, 8) != 8)
@@ -43,7 +72,9 @@ gdispImageError gdispImageOpen_NATIVE(gdispImage *img) {
 	if (hdr[0] != 'N' || hdr[1] != 'I')
 		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
 
-	if (hdr[6] != GDISP_PIXELFORMAT/256 || hdr[7] != (GDISP_PIXELFORMAT & 0xFF))
+	/* Images in other pixel formats are converted as they are drawn */
+	format = (((unsigned)hdr[6])<<8) | hdr[7];
+	if (format != GDISP_PIXELFORMAT && (!gdispConvertSize(format, 1) || format == GDISP_PIXELFORMAT_INDEX8 || format == GDISP_PIXELFORMAT_MONO1))
 		return GDISP_IMAGE_ERR_UNSUPPORTED;		// Unsupported pixel format
 
 	/* We know we are a native format image */
@@ -55,6 +86,11 @@ gdispImageError gdispImageOpen_NATIVE(gdispImage *img) {
 	if (!(img->priv = (gdispImagePrivate *)gdispImageAlloc(img, sizeof(gdispImagePrivate))))
 		return GDISP_IMAGE_ERR_NOMEMORY;
 	img->priv->frame0cache = 0;
+	img->priv->format = format;
+	img->priv->pixelsize = format == GDISP_PIXELFORMAT ? sizeof(pixel_t) : gdispConvertSize(format, 1);
+	img->priv->maxpixels = sizeof(img->priv->buf) / img->priv->pixelsize;
+	if (img->priv->maxpixels > BLIT_BUFFER_SIZE)
+		img->priv->maxpixels = BLIT_BUFFER_SIZE;
 
 	img->type = GDISP_IMAGE_TYPE_NATIVE;
 	return GDISP_IMAGE_ERR_OK;
@@ -63,7 +99,7 @@ gdispImageError gdispImageOpen_NATIVE(gdispImage *img) {
 void gdispImageClose_NATIVE(gdispImage *img) {
 	if (img->priv) {
 		if (img->priv->frame0cache)
-			gdispImageFree(img, (void *)img->priv->frame0cache, img->width * img->height * sizeof(pixel_t));
+			gdispImageCacheRelease(img, img->priv->frame0cache);
 		gdispImageFree(img, (void *)img->priv, sizeof(gdispImagePrivate));
 		img->priv = 0;
 	}
@@ -71,12 +107,17 @@ void gdispImageClose_NATIVE(gdispImage *img) {
 }
 
 gdispImageError gdispImageCache_NATIVE(gdispImage *img) {
-	size_t		len;
+	pixel_t *	p;
+	size_t		len, n;
 
 	/* If we are already cached - just return OK */
 	if (img->priv->frame0cache)
 		return GDISP_IMAGE_ERR_OK;
 
+	/* Another image from the same source may have already read it */
+	if ((img->priv->frame0cache = gdispImageCacheFind(img)))
+		return GDISP_IMAGE_ERR_OK;
+
 	/* We need to allocate the cache */
 	len = img->width * img->height * sizeof(pixel_t);
 	img->priv->frame0cache = (pixel_t *)gdispImageAlloc(img, len);
@@ -85,15 +126,25 @@ gdispImageError gdispImageCache_NATIVE(gdispImage *img) {
 
 	/* Read the entire bitmap into cache */
 	img->io.fns->seek(&img->io, FRAME0POS);
-	if (img->io.fns->read(&img->io, img->priv->frame0cache, len) != len)
-		return GDISP_IMAGE_ERR_BADDATA;
+	if (img->priv->format == GDISP_PIXELFORMAT) {
+		if (img->io.fns->read(&img->io, img->priv->frame0cache, len) != len)
+			return GDISP_IMAGE_ERR_BADDATA;
+	} else {
+		/* Converting it a buffer full at a time */
+		for(p = img->priv->frame0cache, len = img->width * img->height; len; len -= n, p += n) {
+			n = len > (size_t)img->priv->maxpixels ? (size_t)img->priv->maxpixels : len;
+			if (!readPixels(img, p, n))
+				return GDISP_IMAGE_ERR_BADDATA;
+		}
+	}
 
+	gdispImageCacheAdd(img, img->priv->frame0cache);
 	return GDISP_IMAGE_ERR_OK;
 }
 
 gdispImageError gdispImageDraw_NATIVE(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy) {
-	coord_t		mx, mcx;
-	size_t		pos, len;
+	coord_t		mx, mcx, len;
+	size_t		pos;
 
 	/* Check some reasonableness */
 	if (sx >= img->width || sy >= img->height) return GDISP_IMAGE_ERR_OK;
@@ -107,7 +158,7 @@ gdispImageError gdispImageDraw_NATIVE(gdispImage *img, coord_t x, coord_t y, coo
 	}
 
 	/* For this image decoder we cheat and just seek straight to the region we want to display */
-	pos = FRAME0POS + (img->width * sy + cx) * sizeof(pixel_t);
+	pos = FRAME0POS + ((size_t)img->width * sy + sx) * img->priv->pixelsize;
 
 	/* Cycle through the lines */
 	for(;cy;cy--, y++) {
@@ -117,11 +168,8 @@ gdispImageError gdispImageDraw_NATIVE(gdispImage *img, coord_t x, coord_t y, coo
 		/* Draw the line in chunks using BitBlt */
 		for(mx = x, mcx = cx; mcx > 0; mcx -= len, mx += len) {
 			// Read the data
-			len = img->io.fns->read(&img->io,
-						img->priv->buf,
-						mx > BLIT_BUFFER_SIZE ? (BLIT_BUFFER_SIZE*sizeof(pixel_t)) : (mx * sizeof(pixel_t)))
-					/ sizeof(pixel_t);
-			if (!len)
+			len = mcx > img->priv->maxpixels ? img->priv->maxpixels : mcx;
+			if (!readPixels(img, img->priv->buf, len))
 				return GDISP_IMAGE_ERR_BADDATA;
 
 			/* Blit the chunk of data */
@@ -129,12 +177,50 @@ gdispImageError gdispImageDraw_NATIVE(gdispImage *img, coord_t x, coord_t y, coo
 		}
 
 		/* Get the position for the start of the next line */
-		pos += img->width*sizeof(pixel_t);
+		pos += img->width * img->priv->pixelsize;
 	}
 
 	return GDISP_IMAGE_ERR_OK;
 }
 
+#if GDISP_NEED_IMAGE_TRANSFORM
+	gdispImageError gdispImageRows_NATIVE(gdispImage *img, gdispImageRows *pr) {
+		pixel_t *	row;
+		coord_t		y, x, len;
+
+		pr->shift = 0;
+		pr->x = pr->y = 0;
+		pr->cx = img->width;
+		pr->cy = img->height;
+
+		/* Deliver the rows straight from the image cache - if it exists */
+		if (img->priv->frame0cache) {
+			for(y = 0; y < img->height; y++)
+				pr->fn(pr, y, img->priv->frame0cache + (size_t)y * img->width, 0);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		if (!(row = (pixel_t *)gdispImageAlloc(img, img->width * sizeof(pixel_t))))
+			return GDISP_IMAGE_ERR_NOMEMORY;
+
+		/* The rows are stored one after another */
+		img->io.fns->seek(&img->io, FRAME0POS);
+		for(y = 0; y < img->height; y++) {
+			for(x = 0; x < img->width; x += len) {
+				len = img->width - x > img->priv->maxpixels ? img->priv->maxpixels : img->width - x;
+				if (!readPixels(img, row + x, len)) {
+					gdispImageFree(img, row, img->width * sizeof(pixel_t));
+					return GDISP_IMAGE_ERR_BADDATA;
+				}
+			}
+			pr->fn(pr, y, row, 0);
+		}
+
+		gdispImageFree(img, row, img->width * sizeof(pixel_t));
+		return GDISP_IMAGE_ERR_OK;
+	}
+#endif
+
 delaytime_t gdispImageNext_NATIVE(gdispImage *img) {
 	(void) img;
 
@@ -8,12 +8,1016 @@
 /**
  * @file    src/gdisp/image_png.c
  * @brief   GDISP native image code.
+ *
+ * @defgroup Image Image
+ * @ingroup GDISP
  */
 #include "gfx.h"
 
 #if GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_PNG
 
-#error "PNG support not implemented yet"
+#include <string.h>
+
+/**
+ * Helper Routines Needed
+ */
+void *gdispImageAlloc(gdispImage *img, size_t sz);
+void gdispImageFree(gdispImage *img, void *ptr, size_t sz);
+pixel_t *gdispImageCacheFind(gdispImage *img);
+void gdispImageCacheAdd(gdispImage *img, pixel_t *pixels);
+void gdispImageCacheRelease(gdispImage *img, pixel_t *pixels);
+const void *gdispImageGetBytes(gdispImage *img, void *buf, size_t len);
+
+/**
+ * How many bytes of compressed data to read at a time.
+ * Bigger is faster but uses more RAM.
+ */
+#define PNG_INPUT_BUFFER_SIZE	64
+
+/**
+ * How many bits of a Huffman code are decoded with a single table lookup.
+ * Longer codes are decoded a bit at a time. Each extra bit doubles the size of the tables.
+ */
+#define PNG_FAST_BITS			9
+
+// PNG numbers are big endian
+#define PNG_WORD(p)				((((uint16_t)(p)[0])<<8)|((uint16_t)(p)[1]))
+#define PNG_DWORD(p)			((((uint32_t)(p)[0])<<24)|(((uint32_t)(p)[1])<<16)|(((uint32_t)(p)[2])<<8)|((uint32_t)(p)[3]))
+#define PNG_CHUNK(a,b,c,d)		((((uint32_t)(a))<<24)|(((uint32_t)(b))<<16)|(((uint32_t)(c))<<8)|((uint32_t)(d)))
+
+// Divide by 255 with rounding - x must be 0 to 65535
+#define PNG_DIV255(x)			((((x)+128) + (((x)+128)>>8)) >> 8)
+
+// A Huffman code table
+typedef struct pnghuff {
+	uint16_t	fast[1<<PNG_FAST_BITS];			// symbol << 4 | code length for the short codes (0 = a longer code)
+	uint16_t	count[16];						// The number of codes of each length
+	uint16_t	symbol[288];					// The symbols in code order
+} pnghuff;
+
+// Structure for decoding an image
+typedef struct pngdecode {
+	size_t		size;							// The size of this allocation
+
+	// The compressed data
+	uint32_t	chunkleft;						// What is left of the current IDAT chunk
+	uint32_t	bitbuf;							// Bits waiting to be used
+	uint8_t		bitcnt;							// The number of bits in bitbuf
+	uint8_t		inpos;							// The next byte to use in indata[]
+	uint8_t		inlen;							// The number of bytes in indata[]
+	uint8_t		inend;							// There are no more IDAT chunks
+	const uint8_t *	indata;						// The compressed data - in inbuf[] or used in place
+	uint8_t		inbuf[PNG_INPUT_BUFFER_SIZE];
+
+	// The inflate
+	uint8_t		state;							// The state of the inflate
+		#define PNG_INF_BLOCK		0				// Ready for a new block
+		#define PNG_INF_STORED		1				// In a stored block
+		#define PNG_INF_HUFF		2				// In a compressed block
+		#define PNG_INF_END			3				// The last block has finished
+		#define PNG_INF_BAD			4				// The data is corrupt
+	uint8_t		final;							// The current block is the last one
+	uint8_t		fixed;							// The tables hold the fixed codes
+	uint16_t	storedlen;						// What is left of a stored block
+	uint16_t	copylen;						// What is left of a back reference
+	uint16_t	copydist;						// The distance of the back reference
+	uint16_t	wmask;							// The sliding window size - 1
+	uint16_t	wpos;							// Where the next byte goes in the window
+	pnghuff		lit;							// The literal/length codes
+	pnghuff		dist;							// The distance codes
+
+	// The rows
+	size_t		rowbytes;						// The bytes in a full row (without the filter byte)
+	uint8_t *	window;							// The sliding window
+	uint8_t *	cur;							// The current row
+	uint8_t *	prev;							// The previous row
+	pixel_t *	pixels;							// A row converted to pixels
+	color_t *	palette;						// Palette and grayscale images convert through this palette
+	color_t		bgcolor;						// What transparent pixels are blended with
+	uint8_t		bgr, bgg, bgb;
+} pngdecode;
+
+typedef struct gdispImagePrivate {
+	uint8_t		flags;
+		#define PNG_FLG_INTERLACE	0x01		// Adam7 interlaced
+		#define PNG_FLG_TRANSPARENT	0x02		// There is a tRNS chunk
+		#define PNG_FLG_ALPHA		0x04		// There is an alpha channel
+	uint8_t		colortype;
+		#define PNG_COLORTYPE_GRAY			0
+		#define PNG_COLORTYPE_RGB			2
+		#define PNG_COLORTYPE_PALETTE		3
+		#define PNG_COLORTYPE_GRAYALPHA		4
+		#define PNG_COLORTYPE_RGBALPHA		6
+	uint8_t		bitdepth;						// Bits per channel
+	uint8_t		bitsperpixel;
+	uint16_t	palsize;
+	uint8_t		*palette;						// R, G, B, alpha of each palette entry
+	uint16_t	trans[3];						// The tRNS gray or red, green, blue
+	uint16_t	wsize;							// The inflate window size
+	size_t		frame0pos;						// The first IDAT chunk
+	pixel_t		*frame0cache;
+	#if GDISP_NEED_IMAGE_TRANSFORM
+		gdispImageRows *	rows;				// Where to deliver the rows (0 = none)
+	#endif
+	} gdispImagePrivate;
+
+// The Adam7 interlace passes - a non-interlaced image is just pass 7
+static const struct { uint8_t x, y, dx, dy; } pngPasses[8] = {
+	{ 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 },
+	{ 0, 0, 1, 1 }
+	};
+#define PNG_PASS_INTERLACED		0
+#define PNG_PASS_LAST			6
+#define PNG_PASS_SEQUENTIAL		7
+
+// The deflate lengths and distances
+static const uint16_t	pngLenBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t	pngLenExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t	pngDistBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t	pngDistExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+static const uint8_t	pngLenOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/**
+ * Get the next byte of the compressed data - it may be spread over many IDAT chunks.
+ * Past the end of the data we return zeros.
+ */
+static uint8_t getByte(gdispImage *img, pngdecode *d) {
+	uint8_t		hdr[8];
+	uint32_t	len;
+
+	if (d->inpos < d->inlen)
+		return d->indata[d->inpos++];
+
+	// Move to the next IDAT chunk
+	while (!d->chunkleft) {
+		if (d->inend)
+			return 0;
+		img->io.fns->seek(&img->io, img->io.pos+4);				// Skip the CRC
+		if (img->io.fns->read(&img->io, hdr, 8) != 8 || PNG_DWORD(hdr+4) != PNG_CHUNK('I','D','A','T')) {
+			d->inend = TRUE;
+			return 0;
+		}
+		d->chunkleft = PNG_DWORD(hdr);
+	}
+
+	// Fill the buffer
+	len = d->chunkleft > PNG_INPUT_BUFFER_SIZE ? PNG_INPUT_BUFFER_SIZE : d->chunkleft;
+	if (!(d->indata = (const uint8_t *)gdispImageGetBytes(img, d->inbuf, len))) {
+		d->inend = TRUE;
+		d->chunkleft = 0;
+		return 0;
+	}
+	d->chunkleft -= len;
+	d->inlen = len;
+	d->inpos = 1;
+	return d->indata[0];
+}
+
+/**
+ * Make sure there are at least cnt bits ready (cnt <= 24)
+ */
+#define needBits(img, d, cnt)	while((d)->bitcnt < (cnt)) { (d)->bitbuf |= ((uint32_t)getByte(img, d)) << (d)->bitcnt; (d)->bitcnt += 8; }
+
+/**
+ * Get cnt bits (cnt <= 16)
+ */
+static uint16_t getBits(gdispImage *img, pngdecode *d, uint8_t cnt) {
+	uint16_t	v;
+
+	needBits(img, d, cnt);
+	v = d->bitbuf & ((1 << cnt) - 1);
+	d->bitbuf >>= cnt;
+	d->bitcnt -= cnt;
+	return v;
+}
+
+/**
+ * Build a Huffman table from the code lengths.
+ *
+ * Return:	FALSE if the lengths are over-subscribed
+ */
+static bool_t buildHuff(pnghuff *h, const uint8_t *lengths, uint16_t cnt) {
+	uint16_t	offs[16];
+	uint16_t	next[16];
+	uint16_t	i, code, rev, len;
+	int			left;
+
+	// Count the codes of each length
+	memset(h->count, 0, sizeof(h->count));
+	for(i = 0; i < cnt; i++)
+		h->count[lengths[i]]++;
+	h->count[0] = 0;
+
+	// Check for too many codes
+	for(left = 1, len = 1; len < 16; len++) {
+		left <<= 1;
+		left -= h->count[len];
+		if (left < 0)
+			return FALSE;
+	}
+
+	// Sort the symbols by code and work out the first code of each length
+	for(offs[1] = 0, next[1] = 0, len = 1; len < 15; len++) {
+		offs[len+1] = offs[len] + h->count[len];
+		next[len+1] = (next[len] + h->count[len]) << 1;
+	}
+	for(i = 0; i < cnt; i++) {
+		if (lengths[i])
+			h->symbol[offs[lengths[i]]++] = i;
+	}
+
+	// The short codes are looked up directly. The codes are stored bit reversed.
+	memset(h->fast, 0, sizeof(h->fast));
+	for(i = 0; i < cnt; i++) {
+		len = lengths[i];
+		if (!len || len > PNG_FAST_BITS) {
+			if (len)
+				next[len]++;
+			continue;
+		}
+		for(code = next[len]++, rev = 0, left = len; left; left--, code >>= 1)
+			rev = (rev << 1) | (code & 1);
+		for(; rev < (1<<PNG_FAST_BITS); rev += 1 << len)
+			h->fast[rev] = (i << 4) | len;
+	}
+	return TRUE;
+}
+
+/**
+ * Decode a symbol.
+ *
+ * Return:	The symbol or 0xFFFF if the code is invalid
+ */
+static uint16_t getSymbol(gdispImage *img, pngdecode *d, const pnghuff *h) {
+	uint16_t	e;
+	int			code, first, index, len, count;
+
+	needBits(img, d, 16);
+
+	// The short codes
+	if ((e = h->fast[d->bitbuf & ((1<<PNG_FAST_BITS)-1)])) {
+		d->bitbuf >>= e & 0x0F;
+		d->bitcnt -= e & 0x0F;
+		return e >> 4;
+	}
+
+	// Longer codes a bit at a time
+	for(code = first = index = 0, len = 1; len < 16; len++) {
+		code |= (d->bitbuf >> (len-1)) & 1;
+		count = h->count[len];
+		if (code - first < count) {
+			d->bitbuf >>= len;
+			d->bitcnt -= len;
+			return h->symbol[index + code - first];
+		}
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	return 0xFFFF;
+}
+
+/**
+ * Start a new deflate block
+ */
+static void startBlock(gdispImage *img, pngdecode *d) {
+	uint8_t		lengths[288+32];
+	uint16_t	i, n, hlit, hdist, sym;
+	uint8_t		len;
+
+	d->final = getBits(img, d, 1);
+	switch(getBits(img, d, 2)) {
+	case 0:				// Stored
+		d->bitbuf >>= d->bitcnt & 7;
+		d->bitcnt -= d->bitcnt & 7;
+		d->storedlen = getBits(img, d, 16);
+		if ((getBits(img, d, 16) ^ d->storedlen) != 0xFFFF)
+			goto baddata;
+		d->state = PNG_INF_STORED;
+		return;
+
+	case 1:				// Fixed codes
+		if (!d->fixed) {
+			memset(lengths, 8, 144);
+			memset(lengths+144, 9, 256-144);
+			memset(lengths+256, 7, 280-256);
+			memset(lengths+280, 8, 288-280);
+			buildHuff(&d->lit, lengths, 288);
+			memset(lengths, 5, 30);
+			buildHuff(&d->dist, lengths, 30);
+			d->fixed = TRUE;
+		}
+		d->state = PNG_INF_HUFF;
+		return;
+
+	case 2:				// Dynamic codes
+		d->fixed = FALSE;
+		hlit = getBits(img, d, 5) + 257;
+		hdist = getBits(img, d, 5) + 1;
+		n = getBits(img, d, 4) + 4;
+		if (hlit > 286 || hdist > 30)
+			goto baddata;
+
+		// The code length codes go in the distance table for now
+		memset(lengths, 0, 19);
+		for(i = 0; i < n; i++)
+			lengths[pngLenOrder[i]] = getBits(img, d, 3);
+		if (!buildHuff(&d->dist, lengths, 19))
+			goto baddata;
+
+		// The literal/length and distance code lengths
+		for(i = 0; i < hlit+hdist; ) {
+			sym = getSymbol(img, d, &d->dist);
+			if (sym < 16) {
+				lengths[i++] = sym;
+				continue;
+			}
+			switch(sym) {
+			case 16:
+				if (!i)
+					goto baddata;
+				len = lengths[i-1];
+				n = 3 + getBits(img, d, 2);
+				break;
+			case 17:
+				len = 0;
+				n = 3 + getBits(img, d, 3);
+				break;
+			case 18:
+				len = 0;
+				n = 11 + getBits(img, d, 7);
+				break;
+			default:
+				goto baddata;
+			}
+			if (i + n > hlit+hdist)
+				goto baddata;
+			memset(lengths+i, len, n);
+			i += n;
+		}
+		if (!lengths[256] || !buildHuff(&d->lit, lengths, hlit) || !buildHuff(&d->dist, lengths+hlit, hdist))
+			goto baddata;
+		d->state = PNG_INF_HUFF;
+		return;
+
+	default:
+		break;
+	}
+
+baddata:
+	d->state = PNG_INF_BAD;
+}
+
+/**
+ * Inflate the next cnt bytes of the image data.
+ *
+ * Return:	The number of bytes. Less than cnt means the data has ended or is corrupt.
+ */
+static size_t inflateBytes(gdispImage *img, pngdecode *d, uint8_t *dst, size_t cnt) {
+	size_t		got, n;
+	uint16_t	sym, src;
+	uint8_t		b;
+
+	for(got = 0; got < cnt; ) {
+		// Finish a back reference
+		if (d->copylen) {
+			n = cnt - got;
+			if (n > d->copylen)
+				n = d->copylen;
+			d->copylen -= n;
+			for(src = d->wpos - d->copydist; n; n--) {
+				b = d->window[src++ & d->wmask];
+				d->window[d->wpos++ & d->wmask] = b;
+				dst[got++] = b;
+			}
+			continue;
+		}
+
+		switch(d->state) {
+		case PNG_INF_BLOCK:
+			startBlock(img, d);
+			break;
+
+		case PNG_INF_STORED:
+			for(; d->storedlen && got < cnt; d->storedlen--) {
+				b = getBits(img, d, 8);
+				d->window[d->wpos++ & d->wmask] = b;
+				dst[got++] = b;
+			}
+			if (!d->storedlen)
+				d->state = d->final ? PNG_INF_END : PNG_INF_BLOCK;
+			break;
+
+		case PNG_INF_HUFF:
+			while(got < cnt) {
+				sym = getSymbol(img, d, &d->lit);
+
+				// A literal
+				if (sym < 256) {
+					d->window[d->wpos++ & d->wmask] = sym;
+					dst[got++] = sym;
+					continue;
+				}
+
+				// The end of the block
+				if (sym == 256) {
+					d->state = d->final ? PNG_INF_END : PNG_INF_BLOCK;
+					break;
+				}
+
+				// A back reference
+				sym -= 257;
+				if (sym >= 29) {
+					d->state = PNG_INF_BAD;
+					break;
+				}
+				d->copylen = pngLenBase[sym] + getBits(img, d, pngLenExtra[sym]);
+				sym = getSymbol(img, d, &d->dist);
+				if (sym >= 30) {
+					d->state = PNG_INF_BAD;
+					break;
+				}
+				d->copydist = pngDistBase[sym] + getBits(img, d, pngDistExtra[sym]);
+				if (d->copydist > (uint32_t)d->wmask+1) {
+					d->state = PNG_INF_BAD;
+					break;
+				}
+				break;
+			}
+			if (d->state == PNG_INF_BAD)
+				d->copylen = 0;
+			break;
+
+		case PNG_INF_END:
+		case PNG_INF_BAD:
+		default:
+			return got;
+		}
+	}
+	return got;
+}
+
+/**
+ * The Paeth predictor
+ */
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+	int		p, pa, pb, pc;
+
+	p = (int)a + b - c;
+	pa = p > a ? p - a : a - p;
+	pb = p > b ? p - b : b - p;
+	pc = p > c ? p - c : c - p;
+	if (pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+/**
+ * Read and unfilter the next row of len bytes into d->cur. The previous row becomes d->prev.
+ */
+static bool_t getRow(gdispImage *img, pngdecode *d, size_t len) {
+	uint8_t *	cur;
+	uint8_t *	prev;
+	size_t		i, bpp;
+	uint8_t		filter;
+
+	// Swap the rows
+	cur = d->prev;
+	prev = d->cur;
+	d->cur = cur;
+	d->prev = prev;
+
+	if (inflateBytes(img, d, &filter, 1) != 1 || inflateBytes(img, d, cur, len) != len)
+		return FALSE;
+
+	bpp = (img->priv->bitsperpixel + 7) >> 3;
+	switch(filter) {
+	case 0:				// None
+		break;
+	case 1:				// Sub
+		for(i = bpp; i < len; i++)
+			cur[i] += cur[i-bpp];
+		break;
+	case 2:				// Up
+		for(i = 0; i < len; i++)
+			cur[i] += prev[i];
+		break;
+	case 3:				// Average
+		for(i = 0; i < bpp; i++)
+			cur[i] += prev[i] >> 1;
+		for(; i < len; i++)
+			cur[i] += (cur[i-bpp] + prev[i]) >> 1;
+		break;
+	case 4:				// Paeth
+		for(i = 0; i < bpp; i++)
+			cur[i] += prev[i];
+		for(; i < len; i++)
+			cur[i] += paeth(cur[i-bpp], prev[i], prev[i-bpp]);
+		break;
+	default:
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+ * Blend a pixel with the background color
+ */
+static color_t blendPixel(pngdecode *d, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+	if (a == 255)
+		return RGB2COLOR(r, g, b);
+	if (!a)
+		return d->bgcolor;
+	r = PNG_DIV255(r * a + d->bgr * (255 - a));
+	g = PNG_DIV255(g * a + d->bgg * (255 - a));
+	b = PNG_DIV255(b * a + d->bgb * (255 - a));
+	return RGB2COLOR(r, g, b);
+}
+
+/**
+ * Convert cnt pixels of the current row starting at pixel x
+ */
+static void getPixels(gdispImage *img, pngdecode *d, coord_t x, coord_t cnt, pixel_t *dst) {
+	gdispImagePrivate *	priv;
+	const uint8_t *		p;
+	unsigned			bit, hi;
+	coord_t				i;
+
+	priv = img->priv;
+	switch(priv->colortype) {
+	case PNG_COLORTYPE_GRAY:
+	case PNG_COLORTYPE_PALETTE:
+		switch(priv->bitdepth) {
+		case 1:
+			gdispConvertPixelsEx(dst, GDISP_PIXELFORMAT, d->cur, GDISP_PIXELFORMAT_MONO1, x, cnt, d->palette);
+			return;
+		case 2:
+		case 4:
+			for(bit = x * priv->bitdepth, i = 0; i < cnt; i++, bit += priv->bitdepth)
+				dst[i] = d->palette[(d->cur[bit >> 3] >> (8 - priv->bitdepth - (bit & 7))) & ((1 << priv->bitdepth) - 1)];
+			return;
+		case 8:
+			gdispConvertPixelsEx(dst, GDISP_PIXELFORMAT, d->cur, GDISP_PIXELFORMAT_INDEX8, x, cnt, d->palette);
+			return;
+		default:
+			// 16 bit grayscale - the palette has the high byte and the transparency is checked on the full value
+			for(p = d->cur + x*2, i = 0; i < cnt; i++, p += 2)
+				dst[i] = (priv->flags & PNG_FLG_TRANSPARENT) && PNG_WORD(p) == priv->trans[0] ? d->bgcolor : d->palette[p[0]];
+			return;
+		}
+
+	case PNG_COLORTYPE_RGB:
+		if (priv->bitdepth == 8) {
+			if (!(priv->flags & PNG_FLG_TRANSPARENT)) {
+				gdispConvertPixelsEx(dst, GDISP_PIXELFORMAT, d->cur, GDISP_PIXELFORMAT_RGB24, x, cnt, 0);
+				return;
+			}
+			for(p = d->cur + x*3, i = 0; i < cnt; i++, p += 3)
+				dst[i] = p[0] == priv->trans[0] && p[1] == priv->trans[1] && p[2] == priv->trans[2] ? d->bgcolor : RGB2COLOR(p[0], p[1], p[2]);
+			return;
+		}
+		for(p = d->cur + x*6, i = 0; i < cnt; i++, p += 6) {
+			if ((priv->flags & PNG_FLG_TRANSPARENT) && PNG_WORD(p) == priv->trans[0] && PNG_WORD(p+2) == priv->trans[1] && PNG_WORD(p+4) == priv->trans[2])
+				dst[i] = d->bgcolor;
+			else
+				dst[i] = RGB2COLOR(p[0], p[2], p[4]);
+		}
+		return;
+
+	case PNG_COLORTYPE_GRAYALPHA:
+		hi = priv->bitdepth >> 3;
+		for(p = d->cur + x*2*hi, i = 0; i < cnt; i++, p += 2*hi)
+			dst[i] = blendPixel(d, p[0], p[0], p[0], p[hi]);
+		return;
+
+	case PNG_COLORTYPE_RGBALPHA:
+		hi = priv->bitdepth >> 3;
+		for(p = d->cur + x*4*hi, i = 0; i < cnt; i++, p += 4*hi)
+			dst[i] = blendPixel(d, p[0], p[hi], p[2*hi], p[3*hi]);
+		return;
+	}
+}
+
+/**
+ * Get ready for decoding the image.
+ */
+static gdispImageError startDecode(gdispImage *img, pngdecode **pd) {
+	gdispImagePrivate *	priv;
+	pngdecode *			d;
+	uint8_t				hdr[8];
+	size_t				sz, palcnt;
+	uint16_t			i, v;
+
+	priv = img->priv;
+
+	// Allocate the decode structure, a pixel row, a palette, the window and two rows
+	palcnt = priv->colortype == PNG_COLORTYPE_PALETTE || (priv->colortype == PNG_COLORTYPE_GRAY) ? (priv->bitdepth == 16 ? 256 : 1 << priv->bitdepth) : 0;
+	sz = sizeof(pngdecode) + img->width*sizeof(pixel_t) + palcnt*sizeof(color_t) + priv->wsize + 2*(((size_t)img->width*priv->bitsperpixel+7)>>3);
+	if (!(d = (pngdecode *)gdispImageAlloc(img, sz)))
+		return GDISP_IMAGE_ERR_NOMEMORY;
+	d->size = sz;
+	d->rowbytes = ((size_t)img->width*priv->bitsperpixel+7)>>3;
+	d->pixels = (pixel_t *)(d+1);
+	d->palette = (color_t *)(d->pixels + img->width);
+	d->window = (uint8_t *)(d->palette + palcnt);
+	d->cur = d->window + priv->wsize;
+	d->prev = d->cur + d->rowbytes;
+	memset(d->window, 0, priv->wsize);
+
+	// The background color for transparency
+	d->bgcolor = img->bgcolor;
+	d->bgr = RED_OF(img->bgcolor);
+	d->bgg = GREEN_OF(img->bgcolor);
+	d->bgb = BLUE_OF(img->bgcolor);
+
+	// The palette
+	if (priv->colortype == PNG_COLORTYPE_PALETTE) {
+		for(i = 0; i < palcnt; i++) {
+			if (i < priv->palsize)
+				d->palette[i] = blendPixel(d, priv->palette[i*4+0], priv->palette[i*4+1], priv->palette[i*4+2], priv->palette[i*4+3]);
+			else
+				d->palette[i] = RGB2COLOR(0, 0, 0);
+		}
+	} else if (priv->colortype == PNG_COLORTYPE_GRAY) {
+		for(i = 0; i < palcnt; i++) {
+			v = i * 255 / (palcnt-1);
+			if (priv->bitdepth < 16 && (priv->flags & PNG_FLG_TRANSPARENT) && i == priv->trans[0])
+				d->palette[i] = d->bgcolor;
+			else
+				d->palette[i] = RGB2COLOR(v, v, v);
+		}
+	}
+
+	// Start the compressed data
+	d->bitbuf = 0;
+	d->bitcnt = 0;
+	d->inpos = d->inlen = 0;
+	d->inend = FALSE;
+	d->state = PNG_INF_BLOCK;
+	d->fixed = FALSE;
+	d->copylen = 0;
+	d->wmask = priv->wsize - 1;
+	d->wpos = 0;
+	img->io.fns->seek(&img->io, priv->frame0pos);
+	if (img->io.fns->read(&img->io, hdr, 8) != 8) {
+		gdispImageFree(img, d, d->size);
+		return GDISP_IMAGE_ERR_BADDATA;
+	}
+	d->chunkleft = PNG_DWORD(hdr);
+
+	// Skip the zlib header - it was checked when we opened
+	getBits(img, d, 16);
+
+	*pd = d;
+	return GDISP_IMAGE_ERR_OK;
+}
+
+/**
+ * Decode the image - either drawing the area or filling the cache.
+ * If priv->rows is set the full rows are delivered there instead.
+ */
+static gdispImageError decodeImage(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy, pixel_t *cache) {
+	gdispImagePrivate *	priv;
+	pngdecode *			d;
+	gdispImageError		err;
+	coord_t				w, h, my, py, i, fi;
+	size_t				len;
+	uint8_t				pass, lastpass;
+
+	priv = img->priv;
+	if ((err = startDecode(img, &d)))
+		return err;
+
+	if (priv->flags & PNG_FLG_INTERLACE) {
+		pass = PNG_PASS_INTERLACED;
+		lastpass = PNG_PASS_LAST;
+	} else
+		pass = lastpass = PNG_PASS_SEQUENTIAL;
+	for(; pass <= lastpass; pass++) {
+		// The size of the reduced image for this pass
+		w = (img->width - pngPasses[pass].x + pngPasses[pass].dx - 1) / pngPasses[pass].dx;
+		h = (img->height - pngPasses[pass].y + pngPasses[pass].dy - 1) / pngPasses[pass].dy;
+		if (w <= 0 || h <= 0)
+			continue;
+		len = ((size_t)w*priv->bitsperpixel+7)>>3;
+		memset(d->cur, 0, len);
+
+		// The pixels of the reduced image that are in the area
+		i = sx <= pngPasses[pass].x ? 0 : (sx - pngPasses[pass].x + pngPasses[pass].dx - 1) / pngPasses[pass].dx;
+		fi = sx + cx <= pngPasses[pass].x ? 0 : (sx + cx - pngPasses[pass].x + pngPasses[pass].dx - 1) / pngPasses[pass].dx;
+		if (fi > w) fi = w;
+
+		for(py = 0, my = pngPasses[pass].y; py < h; py++, my += pngPasses[pass].dy) {
+			// Once the last pass is past the area there is nothing more to draw
+			if (pass == lastpass && my >= sy+cy)
+				break;
+			if (!getRow(img, d, len)) {
+				err = GDISP_IMAGE_ERR_BADDATA;
+				goto done;
+			}
+			if (my < sy || my >= sy+cy || fi <= i)
+				continue;
+
+			// Full rows go straight to the cache or the display
+			if (pngPasses[pass].dx == 1) {
+				#if GDISP_NEED_IMAGE_TRANSFORM
+					if (priv->rows) {
+						getPixels(img, d, i, fi-i, d->pixels);
+						priv->rows->fn(priv->rows, my, d->pixels, 0);
+						continue;
+					}
+				#endif
+				if (cache)
+					getPixels(img, d, i, fi-i, cache + my*img->width + i);
+				else {
+					getPixels(img, d, i, fi-i, d->pixels);
+					gdispBlitAreaEx(x+i-sx, y+my-sy, fi-i, 1, 0, 0, fi-i, d->pixels);
+				}
+				continue;
+			}
+
+			// Interlaced rows are spread out
+			getPixels(img, d, i, fi-i, d->pixels);
+			for(w = 0; w < fi-i; w++) {
+				if (cache)
+					cache[my*img->width + pngPasses[pass].x + (i+w)*pngPasses[pass].dx] = d->pixels[w];
+				else
+					gdispDrawPixel(x + pngPasses[pass].x + (i+w)*pngPasses[pass].dx - sx, y+my-sy, d->pixels[w]);
+			}
+		}
+	}
+
+done:
+	gdispImageFree(img, d, d->size);
+	return err;
+}
+
+gdispImageError gdispImageOpen_PNG(gdispImage *img) {
+	gdispImagePrivate *priv;
+	uint8_t		buf[13];
+	uint32_t	len, type;
+	uint16_t	i;
+
+	/* Read the file identifier */
+	if (img->io.fns->read(&img->io, buf, 8) != 8)
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+	if (buf[0] != 137 || buf[1] != 'P' || buf[2] != 'N' || buf[3] != 'G' || buf[4] != 13 || buf[5] != 10 || buf[6] != 26 || buf[7] != 10)
+		return GDISP_IMAGE_ERR_BADFORMAT;		// It can't be us
+
+	/* We know we are a PNG format image */
+	img->flags = 0;
+
+	/* Allocate our private area */
+	if (!(img->priv = (gdispImagePrivate *)gdispImageAlloc(img, sizeof(gdispImagePrivate))))
+		return GDISP_IMAGE_ERR_NOMEMORY;
+
+	/* Initialise the essential bits in the private area */
+	priv = img->priv;
+	priv->flags = 0;
+	priv->palsize = 0;
+	priv->palette = 0;
+	priv->frame0cache = 0;
+	#if GDISP_NEED_IMAGE_TRANSFORM
+		priv->rows = 0;
+	#endif
+
+	/* The header chunk must be first */
+	if (img->io.fns->read(&img->io, buf, 8) != 8 || PNG_DWORD(buf) != 13 || PNG_DWORD(buf+4) != PNG_CHUNK('I','H','D','R'))
+		goto baddatacleanup;
+	if (img->io.fns->read(&img->io, buf, 13) != 13)
+		goto baddatacleanup;
+	img->io.fns->seek(&img->io, img->io.pos+4);		// Skip the CRC
+	if (PNG_DWORD(buf) > 0x7FFF || PNG_DWORD(buf+4) > 0x7FFF)
+		goto unsupportedcleanup;
+	img->width = PNG_DWORD(buf);
+	img->height = PNG_DWORD(buf+4);
+	priv->bitdepth = buf[8];
+	priv->colortype = buf[9];
+	if (!img->width || !img->height || buf[10] || buf[11] || buf[12] > 1)
+		goto baddatacleanup;
+	if (buf[12])
+		priv->flags |= PNG_FLG_INTERLACE;
+	switch(priv->colortype) {
+	case PNG_COLORTYPE_GRAY:
+		if (priv->bitdepth != 1 && priv->bitdepth != 2 && priv->bitdepth != 4 && priv->bitdepth != 8 && priv->bitdepth != 16)
+			goto baddatacleanup;
+		priv->bitsperpixel = priv->bitdepth;
+		break;
+	case PNG_COLORTYPE_PALETTE:
+		if (priv->bitdepth != 1 && priv->bitdepth != 2 && priv->bitdepth != 4 && priv->bitdepth != 8)
+			goto baddatacleanup;
+		priv->bitsperpixel = priv->bitdepth;
+		break;
+	case PNG_COLORTYPE_RGB:
+	case PNG_COLORTYPE_GRAYALPHA:
+	case PNG_COLORTYPE_RGBALPHA:
+		if (priv->bitdepth != 8 && priv->bitdepth != 16)
+			goto baddatacleanup;
+		priv->bitsperpixel = priv->bitdepth * (priv->colortype == PNG_COLORTYPE_RGB ? 3 : (priv->colortype == PNG_COLORTYPE_GRAYALPHA ? 2 : 4));
+		if (priv->colortype != PNG_COLORTYPE_RGB) {
+			priv->flags |= PNG_FLG_ALPHA;
+			img->flags |= GDISP_IMAGE_FLG_TRANSPARENT;
+		}
+		break;
+	default:
+		goto baddatacleanup;
+	}
+
+	/* Process the chunks up to the image data */
+	while(1) {
+		if (img->io.fns->read(&img->io, buf, 8) != 8)
+			goto baddatacleanup;
+		len = PNG_DWORD(buf);
+		type = PNG_DWORD(buf+4);
+
+		switch(type) {
+		case PNG_CHUNK('I','D','A','T'):
+			// The image data - check the zlib header and get the window size
+			priv->frame0pos = img->io.pos - 8;
+			priv->wsize = 32768;
+			if (len >= 2) {
+				if (img->io.fns->read(&img->io, buf, 2) != 2)
+					goto baddatacleanup;
+				if ((buf[0] & 0x0F) != 8 || (buf[0] >> 4) > 7 || (buf[1] & 0x20) || PNG_WORD(buf) % 31)
+					goto unsupportedcleanup;
+				priv->wsize = 1 << ((buf[0] >> 4) + 8);
+			}
+			if (priv->colortype == PNG_COLORTYPE_PALETTE && !priv->palette)
+				goto baddatacleanup;
+			img->type = GDISP_IMAGE_TYPE_PNG;
+			return GDISP_IMAGE_ERR_OK;
+
+		case PNG_CHUNK('P','L','T','E'):
+			// The palette - it is only a suggestion for non-palette images
+			if (priv->colortype != PNG_COLORTYPE_PALETTE)
+				break;
+			if (priv->palette || !len || len % 3 || len/3 > (1U << priv->bitdepth))
+				goto baddatacleanup;
+			priv->palsize = len/3;
+			if (!(priv->palette = (uint8_t *)gdispImageAlloc(img, priv->palsize*4)))
+				goto nomemcleanup;
+			for(i = 0; i < priv->palsize; i++) {
+				if (img->io.fns->read(&img->io, priv->palette+i*4, 3) != 3)
+					goto baddatacleanup;
+				priv->palette[i*4+3] = 255;
+			}
+			len = 0;
+			break;
+
+		case PNG_CHUNK('t','R','N','S'):
+			// The transparency
+			if (priv->colortype == PNG_COLORTYPE_PALETTE) {
+				if (!priv->palette || len > priv->palsize)
+					goto baddatacleanup;
+				for(i = 0; i < len; i++) {
+					if (img->io.fns->read(&img->io, priv->palette+i*4+3, 1) != 1)
+						goto baddatacleanup;
+				}
+			} else if (priv->colortype == PNG_COLORTYPE_GRAY || priv->colortype == PNG_COLORTYPE_RGB) {
+				if (len != (priv->colortype == PNG_COLORTYPE_GRAY ? 2U : 6U) || img->io.fns->read(&img->io, buf, len) != len)
+					goto baddatacleanup;
+				for(i = 0; i < len/2; i++)
+					priv->trans[i] = PNG_WORD(buf+i*2);
+				priv->flags |= PNG_FLG_TRANSPARENT;
+			} else
+				break;
+			img->flags |= GDISP_IMAGE_FLG_TRANSPARENT;
+			len = 0;
+			break;
+
+		case PNG_CHUNK('I','E','N','D'):
+			goto baddatacleanup;
+
+		default:
+			// We can skip ancillary chunks (lower case first letter) but not critical ones
+			if (!(buf[4] & 0x20))
+				goto unsupportedcleanup;
+			break;
+		}
+
+		// Skip the rest of the chunk and the CRC
+		img->io.fns->seek(&img->io, img->io.pos+len+4);
+	}
+
+nomemcleanup:
+	gdispImageClose_PNG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_NOMEMORY;		// Out of memory
+
+baddatacleanup:
+	gdispImageClose_PNG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_BADDATA;			// Oops - something wrong
+
+unsupportedcleanup:
+	gdispImageClose_PNG(img);				// Clean up the private data area
+	return GDISP_IMAGE_ERR_UNSUPPORTED;		// Not supported
+}
+
+void gdispImageClose_PNG(gdispImage *img) {
+	if (img->priv) {
+		if (img->priv->palette)
+			gdispImageFree(img, (void *)img->priv->palette, img->priv->palsize*4);
+		if (img->priv->frame0cache)
+			gdispImageCacheRelease(img, img->priv->frame0cache);
+		gdispImageFree(img, (void *)img->priv, sizeof(gdispImagePrivate));
+		img->priv = 0;
+	}
+	img->io.fns->close(&img->io);
+}
+
+gdispImageError gdispImageCache_PNG(gdispImage *img) {
+	gdispImagePrivate *	priv;
+	gdispImageError		err;
+
+	/* If we are already cached - just return OK */
+	priv = img->priv;
+	if (priv->frame0cache)
+		return GDISP_IMAGE_ERR_OK;
+
+	/* Another image from the same source may have already decoded it */
+	if ((priv->frame0cache = gdispImageCacheFind(img)))
+		return GDISP_IMAGE_ERR_OK;
+
+	/* We need to allocate the cache */
+	priv->frame0cache = (pixel_t *)gdispImageAlloc(img, img->width*img->height*sizeof(pixel_t));
+	if (!priv->frame0cache)
+		return GDISP_IMAGE_ERR_NOMEMORY;
+
+	/* Decode the entire image into the cache */
+	if ((err = decodeImage(img, 0, 0, img->width, img->height, 0, 0, priv->frame0cache))) {
+		gdispImageFree(img, (void *)priv->frame0cache, img->width*img->height*sizeof(pixel_t));
+		priv->frame0cache = 0;
+		return err;
+	}
+	gdispImageCacheAdd(img, priv->frame0cache);
+	return GDISP_IMAGE_ERR_OK;
+}
+
+gdispImageError gdispImageDraw_PNG(gdispImage *img, coord_t x, coord_t y, coord_t cx, coord_t cy, coord_t sx, coord_t sy) {
+	gdispImagePrivate *	priv;
+
+	priv = img->priv;
+
+	/* Check some reasonableness */
+	if (sx >= img->width || sy >= img->height) return GDISP_IMAGE_ERR_OK;
+	if (sx + cx > img->width) cx = img->width - sx;
+	if (sy + cy > img->height) cy = img->height - sy;
+
+	/* Draw from the image cache - if it exists */
+	if (priv->frame0cache) {
+		gdispBlitAreaEx(x, y, cx, cy, sx, sy, img->width, priv->frame0cache);
+		return GDISP_IMAGE_ERR_OK;
+	}
+
+	/* Decode just the rows we need */
+	return decodeImage(img, x, y, cx, cy, sx, sy, 0);
+}
+
+#if GDISP_NEED_IMAGE_TRANSFORM
+	gdispImageError gdispImageRows_PNG(gdispImage *img, gdispImageRows *pr) {
+		gdispImagePrivate *	priv;
+		gdispImageError		err;
+		pixel_t *			buf;
+		coord_t				y;
+
+		priv = img->priv;
+		pr->shift = 0;
+		pr->x = pr->y = 0;
+		pr->cx = img->width;
+		pr->cy = img->height;
+
+		/* Deliver the rows straight from the image cache - if it exists */
+		if (priv->frame0cache) {
+			for(y = 0; y < img->height; y++)
+				pr->fn(pr, y, priv->frame0cache + (size_t)y * img->width, 0);
+			return GDISP_IMAGE_ERR_OK;
+		}
+
+		/* Interlaced rows are only complete after the last pass so decode the whole image into a temporary buffer */
+		if (priv->flags & PNG_FLG_INTERLACE) {
+			if (!(buf = (pixel_t *)gdispImageAlloc(img, img->width*img->height*sizeof(pixel_t))))
+				return GDISP_IMAGE_ERR_NOMEMORY;
+			if (!(err = decodeImage(img, 0, 0, img->width, img->height, 0, 0, buf))) {
+				for(y = 0; y < img->height; y++)
+					pr->fn(pr, y, buf + (size_t)y * img->width, 0);
+			}
+			gdispImageFree(img, (void *)buf, img->width*img->height*sizeof(pixel_t));
+			return err;
+		}
+
+		priv->rows = pr;
+		err = decodeImage(img, 0, 0, img->width, img->height, 0, 0, 0);
+		priv->rows = 0;
+		return err;
+	}
+#endif
+
+delaytime_t gdispImageNext_PNG(gdispImage *img) {
+	(void) img;
+
+	/* No more frames/pages */
+	return TIME_INFINITE;
+}
 
 #endif /* GFX_USE_GDISP && GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_PNG */
 /** @} */
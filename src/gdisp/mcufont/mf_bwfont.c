@@ -15,20 +15,37 @@
 static const struct mf_bwfont_char_range_s *find_char_range(
     const struct mf_bwfont_s *font, uint16_t character, uint16_t *index_ret)
 {
-    unsigned i, index;
+    unsigned count, half, index;
     const struct mf_bwfont_char_range_s *range;
-    for (i = 0; i < font->char_range_count; i++)
+    
+    if (character < 256 && font->char_lookup)
     {
-        range = &font->char_ranges[i];
-        index = character - range->first_char;
-        if (character >= range->first_char && index < range->char_count)
-        {
-            *index_ret = index;
-            return range;
-        }
+        index = font->char_lookup[character];
+        if (index == MF_CHAR_LOOKUP_NONE)
+            return 0;
+        range = &font->char_ranges[index];
+        *index_ret = character - range->first_char;
+        return range;
     }
     
-    return 0;
+    /* Find the last range starting at or before the character. The loop
+     * has a fixed trip count so that it compiles without branches. */
+    if (!font->char_range_count)
+        return 0;
+    range = font->char_ranges;
+    for (count = font->char_range_count; count > 1; count -= half)
+    {
+        half = count / 2;
+        if (range[half].first_char <= character)
+            range += half;
+    }
+    
+    index = character - range->first_char;
+    if (index >= range->char_count)
+        return 0;
+    
+    *index_ret = index;
+    return range;
 }
 
 static uint8_t get_width(const struct mf_bwfont_char_range_s *r, uint16_t index)
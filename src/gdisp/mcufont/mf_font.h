@@ -25,6 +25,9 @@
 typedef void (*mf_pixel_callback_t) (int16_t x, int16_t y, uint8_t count,
                                      uint8_t alpha, void *state);
 
+/* Value in a char_lookup table for characters that are not in the font. */
+#define MF_CHAR_LOOKUP_NONE 0xFF
+
 /* General information about a font. */
 struct mf_font_s
 {
@@ -31,27 +31,43 @@
 #define DICT_START3BIT  244
 #define DICT_START2BIT  252
 
-/* Find a pointer to the glyph matching a given character by searching
- * through the character ranges. If the character is not found, return
- * pointer to the default glyph.
+/* Find a pointer to the glyph matching a given character. Characters
+ * 0-255 are found directly if the font has a lookup table, others by a
+ * binary search of the character ranges. If the character is not found,
+ * return 0.
  */
 static const uint8_t *find_glyph(const struct mf_rlefont_s *font,
                                  uint16_t character)
 {
-   unsigned i, index;
-   const struct mf_rlefont_char_range_s *range;
-   for (i = 0; i < font->char_range_count; i++)
-   {
-       range = &font->char_ranges[i];
-       index = character - range->first_char;
-       if (character >= range->first_char && index < range->char_count)
-       {
-           uint16_t offset = range->glyph_offsets[index];
-           return &range->glyph_data[offset];
-       }
-   }
-
-   return 0;
+    unsigned count, half, index;
+    const struct mf_rlefont_char_range_s *range;
+    
+    if (character < 256 && font->char_lookup)
+    {
+        index = font->char_lookup[character];
+        if (index == MF_CHAR_LOOKUP_NONE)
+            return 0;
+        range = &font->char_ranges[index];
+        return &range->glyph_data[range->glyph_offsets[character - range->first_char]];
+    }
+    
+    /* Find the last range starting at or before the character. The loop
+     * has a fixed trip count so that it compiles without branches. */
+    if (!font->char_range_count)
+        return 0;
+    range = font->char_ranges;
+    for (count = font->char_range_count; count > 1; count -= half)
+    {
+        half = count / 2;
+        if (range[half].first_char <= character)
+            range += half;
+    }
+    
+    index = character - range->first_char;
+    if (index >= range->char_count)
+        return 0;
+    
+    return &range->glyph_data[range->glyph_offsets[index]];
 }
 
 /* Structure to keep track of coordinates of the next pixel to be written,
@@ -62,8 +62,13 @@ struct mf_rlefont_s
     /* Number of discontinuous character ranges */
     const uint8_t char_range_count;
     
-    /* Array of the character ranges */
+    /* Array of the character ranges, sorted by first_char. */
     const struct mf_rlefont_char_range_s *char_ranges;
+    
+    /* Optional direct lookup table for characters 0-255, or NULL.
+     * Gives the index of the range holding each character or
+     * MF_CHAR_LOOKUP_NONE. Other characters use a binary search. */
+    const uint8_t *char_lookup;
 };
 
 #ifdef MF_RLEFONT_INTERNALS
@@ -278,8 +278,8 @@ void mf_wordwrap(const struct mf_font_s *font, int16_t width,
             }
         }
         
-        /* Handle unbreakable words */
-        if (cc_prev == 0)
+        /* Handle unbreakable words and the rest of the text fitting */
+        if (cc_prev == 0 || !*text)
         {
             cc_prev = cc_cur;
             ls_prev = text;
@@ -34,7 +34,7 @@ static void deleteAssignments(GListener *pl, GSourceHandle gsh) {
 	GSourceListener *psl;
 
 	for(psl = Assignments; psl < Assignments+GEVENT_MAX_SOURCE_LISTENERS; psl++) {
-		if ((!pl || psl->pListener == pl) && (!gsh || psl->pSource == gsh)) {
+		if (psl->pListener && (!pl || psl->pListener == pl) && (!gsh || psl->pSource == gsh)) {
 			if (gfxSemCounter(&psl->pListener->waitqueue) < 0) {
 				gfxSemWait(&psl->pListener->eventlock, TIME_INFINITE);	// Obtain the buffer lock
 				psl->pListener->event.type = GEVENT_EXIT;				// Set up the EXIT event
@@ -42,6 +42,7 @@ static void deleteAssignments(GListener *pl, GSourceHandle gsh) {
 				gfxSemSignal(&psl->pListener->eventlock);				// Release the buffer lock
 			}
 			psl->pListener = 0;
+			psl->pSource = 0;
 		}
 	}
 }
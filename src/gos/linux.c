@@ -46,7 +46,7 @@ void gfxSleepMilliseconds(delaytime_t ms) {
 	case TIME_INFINITE:		while(1) sleep(60);			return;
 	default:
 		ts.tv_sec = ms / 1000;
-		ts.tv_nsec = (ms % 1000) * 1000;
+		ts.tv_nsec = (ms % 1000) * 1000000;
 		nanosleep(&ts, 0);
 		return;
 	}
@@ -60,7 +60,7 @@ void gfxSleepMicroseconds(delaytime_t ms) {
 	case TIME_INFINITE:		while(1) sleep(60);			return;
 	default:
 		ts.tv_sec = ms / 1000000;
-		ts.tv_nsec = ms % 1000000;
+		ts.tv_nsec = (ms % 1000000) * 1000;
 		nanosleep(&ts, 0);
 		return;
 	}
@@ -70,7 +70,7 @@ systemticks_t gfxSystemTicks(void) {
 	struct timespec	ts;
 
 	clock_gettime(CLOCK_MONOTONIC, &ts);
-	return ts.tv_sec * 1000UL + ts.tv_nsec / 1000UL;
+	return ts.tv_sec * 1000UL + ts.tv_nsec / 1000000UL;
 }
 
 gfxThreadHandle gfxThreadCreate(void *stackarea, size_t stacksz, threadpriority_t prio, DECLARE_THREAD_FUNCTION((*fn),p), void *param) {
@@ -128,9 +128,13 @@ bool_t gfxSemWait(gfxSem *pSem, delaytime_t ms) {
 			struct timeval now;
 			struct timespec	tm;
 
-			gettimeofday(&now);
+			gettimeofday(&now, NULL);
 			tm.tv_sec = now.tv_sec + ms / 1000;
-			tm.tv_nsec = (now.tv_usec + ms % 1000) * 1000;
+			tm.tv_nsec = (now.tv_usec + (ms % 1000) * 1000) * 1000;
+			if (tm.tv_nsec >= 1000000000) {
+				tm.tv_sec++;
+				tm.tv_nsec -= 1000000000;
+			}
 			while (!pSem->cnt) {
 				if (pthread_cond_timedwait(&pSem->cond, &pSem->mtx, &tm) == ETIMEDOUT) {
 					pthread_mutex_unlock(&pSem->mtx);
@@ -53,14 +53,14 @@ static void SendButtonEvent(GWidgetObject *gw) {
 	static void MouseDown(GWidgetObject *gw, coord_t x, coord_t y) {
 		(void) x; (void) y;
 		gw->g.flags |= GBUTTON_FLG_PRESSED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 	}
 
 	// A mouse up has occurred (it may or may not be over the button)
 	static void MouseUp(GWidgetObject *gw, coord_t x, coord_t y) {
 		(void) x; (void) y;
 		gw->g.flags &= ~GBUTTON_FLG_PRESSED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 
 		#if !GWIN_BUTTON_LAZY_RELEASE
 			// If the mouse up was not over the button then cancel the event
@@ -77,14 +77,14 @@ static void SendButtonEvent(GWidgetObject *gw) {
 	static void ToggleOff(GWidgetObject *gw, uint16_t role) {
 		(void) role;
 		gw->g.flags &= ~GBUTTON_FLG_PRESSED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 	}
 
 	// A toggle on has occurred
 	static void ToggleOn(GWidgetObject *gw, uint16_t role) {
 		(void) role;
 		gw->g.flags |= GBUTTON_FLG_PRESSED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 		// Trigger the event on button down (different than for mouse/touch)
 		SendButtonEvent(gw);
 	}
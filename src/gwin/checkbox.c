@@ -48,7 +48,7 @@ static void SendCheckboxEvent(GWidgetObject *gw) {
 	static void MouseDown(GWidgetObject *gw, coord_t x, coord_t y) {
 		(void) x; (void) y;
 		gw->g.flags ^= GCHECKBOX_FLG_CHECKED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 		SendCheckboxEvent(gw);
 	}
 #endif
@@ -57,7 +57,7 @@ static void SendCheckboxEvent(GWidgetObject *gw) {
 	static void ToggleOn(GWidgetObject *gw, uint16_t role) {
 		(void) role;
 		gw->g.flags ^= GCHECKBOX_FLG_CHECKED;
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 		SendCheckboxEvent(gw);
 	}
 
@@ -130,7 +130,7 @@ void gwinCheckboxCheck(GHandle gh, bool_t isChecked) {
 		if (!(gh->flags & GCHECKBOX_FLG_CHECKED)) return;
 		gh->flags &= ~GCHECKBOX_FLG_CHECKED;
 	}
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 	SendCheckboxEvent((GWidgetObject *)gh);
 }
 
@@ -24,21 +24,48 @@ static void _destroy(GWindowObject *gh) {
 }
 
 #if GWIN_NEED_IMAGE_ANIMATION
-	static void _redraw(GHandle gh);
+	// The animation stopped while the window was hidden and should restart when it is next drawn
+	#define GIMAGE_FLG_RESTART		(GWIN_FIRST_CONTROL_FLAG<<0)
+
+	static void _timer(void *gh);
+
+	// Move on to the next frame and start the timer to draw it.
+	// This is not done in the redraw routine as that can be called for each visible part of the window.
+	static void _nextframe(GHandle gh) {
+		delaytime_t	delay;
+
+		// read the delay for the next frame
+		delay = gdispImageNext(&widget(gh)->image);
+
+		// Wait for that delay if required
+		switch(delay) {
+		case TIME_INFINITE:
+			// Everything is done
+			break;
+		case TIME_IMMEDIATE:
+			// We can't allow a continuous loop here as it would lock the system up so we delay for the minimum period
+			delay = 1;
+			// Fall through
+		default:
+			// Start the timer to draw the next frame of the animation
+			gtimerStart(&widget(gh)->timer, _timer, (void*)gh, FALSE, delay);
+			break;
+		}
+	}
 
 	static void _timer(void *gh) {
 		// We need to re-test the visibility in case it has been made invisible since the last frame.
-		if ((((GHandle)gh)->flags & GWIN_FLG_VISIBLE))
-			_redraw((GHandle)gh);
+		if ((((GHandle)gh)->flags & GWIN_FLG_VISIBLE)) {
+			_gwinDraw((GHandle)gh);
+			_nextframe((GHandle)gh);
+		} else
+			((GHandle)gh)->flags |= GIMAGE_FLG_RESTART;
 	}
 #endif
 
 static void _redraw(GHandle gh) {
 	coord_t		x, y, w, h, dx, dy;
 	color_t		bg;
-	#if GWIN_NEED_IMAGE_ANIMATION
-		delaytime_t	delay;
-	#endif
 
 	// The default display area
 	x = gh->x;
@@ -92,22 +119,10 @@ static void _redraw(GHandle gh) {
 	gdispImageDraw(&widget(gh)->image, x, y, w, h, dx, dy);
 
 	#if GWIN_NEED_IMAGE_ANIMATION
-		// read the delay for the next frame
-		delay = gdispImageNext(&widget((GHandle)gh)->image);
-
-		// Wait for that delay if required
-		switch(delay) {
-		case TIME_INFINITE:
-			// Everything is done
-			break;
-		case TIME_IMMEDIATE:
-			// We can't allow a continuous loop here as it would lock the system up so we delay for the minimum period
-			delay = 1;
-			// Fall through
-		default:
-			// Start the timer to draw the next frame of the animation
-			gtimerStart(&widget((GHandle)gh)->timer, _timer, (void*)gh, FALSE, delay);
-			break;
+		// Restart the animation if it was stopped while we were hidden
+		if ((gh->flags & GIMAGE_FLG_RESTART)) {
+			gh->flags &= ~GIMAGE_FLG_RESTART;
+			gtimerStart(&widget(gh)->timer, _timer, (void*)gh, FALSE, 1);
 		}
 	#endif
 }
@@ -147,14 +162,14 @@ bool_t gwinImageOpenMemory(GHandle gh, const void* memory) {
 	if (gdispImageOpen(&widget(gh)->image) != GDISP_IMAGE_ERR_OK)
 		return FALSE;
 
-	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		// Setting the clip here shouldn't be necessary if the redraw doesn't overdraw
-		//	but we put it in for safety anyway
-		#if GDISP_NEED_CLIP
-			gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-		#endif
-		_redraw(gh);
-	}
+	// The frame must be drawn before we move on to the next one
+	_gwinDraw(gh);
+	#if GWIN_NEED_IMAGE_ANIMATION
+		if ((gh->flags & GWIN_FLG_VISIBLE))
+			_nextframe(gh);
+		else
+			gh->flags |= GIMAGE_FLG_RESTART;
+	#endif
 
 	return TRUE;
 }
@@ -170,14 +185,14 @@ bool_t gwinImageOpenFile(GHandle gh, const char* filename) {
 	if (gdispImageOpen(&widget(gh)->image) != GDISP_IMAGE_ERR_OK)
 		return FALSE;
 
-	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		// Setting the clip here shouldn't be necessary if the redraw doesn't overdraw
-		//	but we put it in for safety anyway
-		#if GDISP_NEED_CLIP
-			gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-		#endif
-		_redraw(gh);
-	}
+	// The frame must be drawn before we move on to the next one
+	_gwinDraw(gh);
+	#if GWIN_NEED_IMAGE_ANIMATION
+		if ((gh->flags & GWIN_FLG_VISIBLE))
+			_nextframe(gh);
+		else
+			gh->flags |= GIMAGE_FLG_RESTART;
+	#endif
 
 	return TRUE;
 }
@@ -194,14 +209,14 @@ bool_t gwinImageOpenStream(GHandle gh, void *streamPtr) {
 	if (gdispImageOpen(&widget(gh)->image) != GDISP_IMAGE_ERR_OK)
 		return FALSE;
 
-	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		// Setting the clip here shouldn't be necessary if the redraw doesn't overdraw
-		//	but we put it in for safety anyway
-		#if GDISP_NEED_CLIP
-			gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-		#endif
-		_redraw(gh);
-	}
+	// The frame must be drawn before we move on to the next one
+	_gwinDraw(gh);
+	#if GWIN_NEED_IMAGE_ANIMATION
+		if ((gh->flags & GWIN_FLG_VISIBLE))
+			_nextframe(gh);
+		else
+			gh->flags |= GIMAGE_FLG_RESTART;
+	#endif
 
 	return TRUE;
 }
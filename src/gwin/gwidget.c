@@ -80,18 +80,261 @@ static const GWidgetStyle *	defaultStyle = &BlackWidgetStyle;
 #define gw		((GWidgetObject *)gh)
 #define wvmt	((gwidgetVMT *)gh->vmt)
 
+#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
+	/* The widget that has captured the mouse (if any) */
+	static GHandle				MouseCapture;
+
+	#if GWIN_WIDGET_HITGRID
+		/**
+		 * The hit grid divides the display into GWIN_WIDGET_HITGRID_CELL square cells.
+		 * Each cell lists the visible windows that overlap it in z-order (bottom first).
+		 * The lists are stored one after the other in HitWins[] with cell n using
+		 * HitWins[HitCells[n]] to HitWins[HitCells[n+1]-1].
+		 * The grid is rebuilt on the next mouse down after any window is changed.
+		 * Windows are invalidated after they change and the grid is marked valid before
+		 * it is built so a change made while it is being built still forces a rebuild.
+		 */
+		static bool_t			HitValid;
+		static coord_t			HitWidth, HitHeight;
+		static unsigned			HitCols;
+		static size_t			HitSize;
+		static GHandle *		HitWins;
+		static unsigned *		HitCells;
+
+		void _gwidgetHitGridInvalidate(void) {
+			HitValid = FALSE;
+		}
+
+		// Get the range of cells covered by a visible window. Returns FALSE if it covers none.
+		static bool_t HitCellRange(GHandle gh, unsigned *cx0, unsigned *cy0, unsigned *cx1, unsigned *cy1) {
+			coord_t		x0, y0, x1, y1;
+
+			if (!(gh->flags & GWIN_FLG_VISIBLE))
+				return FALSE;
+			x0 = gh->x < 0 ? 0 : gh->x;
+			y0 = gh->y < 0 ? 0 : gh->y;
+			x1 = gh->x + gh->width > HitWidth ? HitWidth : gh->x + gh->width;
+			y1 = gh->y + gh->height > HitHeight ? HitHeight : gh->y + gh->height;
+			if (x0 >= x1 || y0 >= y1)
+				return FALSE;
+			*cx0 = x0 / GWIN_WIDGET_HITGRID_CELL;
+			*cy0 = y0 / GWIN_WIDGET_HITGRID_CELL;
+			*cx1 = (x1 - 1) / GWIN_WIDGET_HITGRID_CELL;
+			*cy1 = (y1 - 1) / GWIN_WIDGET_HITGRID_CELL;
+			return TRUE;
+		}
+
+		static bool_t BuildHitGrid(void) {
+			const gfxQueueASyncItem *	qi;
+			GHandle						gh;
+			unsigned					rows, ncells, total, cx0, cy0, cx1, cy1, cx, cy;
+			size_t						sz;
+
+			HitValid = TRUE;
+			HitWidth = gdispGetWidth();
+			HitHeight = gdispGetHeight();
+			HitCols = (HitWidth + GWIN_WIDGET_HITGRID_CELL - 1) / GWIN_WIDGET_HITGRID_CELL;
+			rows = (HitHeight + GWIN_WIDGET_HITGRID_CELL - 1) / GWIN_WIDGET_HITGRID_CELL;
+			ncells = HitCols * rows;
+
+			// Count the entries
+			total = 0;
+			for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+				if (HitCellRange(QItem2GWindow(qi), &cx0, &cy0, &cx1, &cy1))
+					total += (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+			}
+
+			// Make sure we have enough space
+			sz = total * sizeof(GHandle) + (ncells + 1) * sizeof(unsigned);
+			if (sz > HitSize) {
+				if (HitWins)
+					gfxFree(HitWins);
+				if (!(HitWins = (GHandle *)gfxAlloc(sz))) {
+					HitSize = 0;
+					HitValid = FALSE;
+					return FALSE;
+				}
+				HitSize = sz;
+			}
+			HitCells = (unsigned *)(HitWins + total);
+
+			// Count the entries in each cell. The running totals then give the start of each cell.
+			memset(HitCells, 0, (ncells + 1) * sizeof(unsigned));
+			for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+				if (!HitCellRange(QItem2GWindow(qi), &cx0, &cy0, &cx1, &cy1))
+					continue;
+				for(cy = cy0; cy <= cy1; cy++)
+					for(cx = cx0; cx <= cx1; cx++)
+						HitCells[cy * HitCols + cx + 1]++;
+			}
+			for(cx = 1; cx <= ncells; cx++)
+				HitCells[cx] += HitCells[cx-1];
+
+			// Fill the cells. Each cell's start moves up as it is filled so it ends as the start of the next cell.
+			for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+				gh = QItem2GWindow(qi);
+				if (!HitCellRange(gh, &cx0, &cy0, &cx1, &cy1))
+					continue;
+				for(cy = cy0; cy <= cy1; cy++)
+					for(cx = cx0; cx <= cx1; cx++)
+						HitWins[HitCells[cy * HitCols + cx]++] = gh;
+			}
+
+			// Move them all back by one to get the starts again
+			for(cx = ncells; cx > 0; cx--)
+				HitCells[cx] = HitCells[cx-1];
+			HitCells[0] = 0;
+			return TRUE;
+		}
+	#endif
+
+	/* Find the top-most visible window at a point */
+	static GHandle FindWindowAt(coord_t x, coord_t y) {
+		const gfxQueueASyncItem *	qi;
+		GHandle						gh, found;
+
+		#if GWIN_WIDGET_HITGRID
+			unsigned					i, cell;
+
+			if ((HitValid && HitWidth == gdispGetWidth() && HitHeight == gdispGetHeight()) || BuildHitGrid()) {
+				if (x < 0 || y < 0 || x >= HitWidth || y >= HitHeight)
+					return 0;
+				cell = (y / GWIN_WIDGET_HITGRID_CELL) * HitCols + x / GWIN_WIDGET_HITGRID_CELL;
+				for(i = HitCells[cell+1]; i > HitCells[cell]; i--) {
+					gh = HitWins[i-1];
+					if (x >= gh->x && x < gh->x + gh->width && y >= gh->y && y < gh->y + gh->height)
+						return gh;
+				}
+				return 0;
+			}
+		#endif
+
+		// The list is in z-order so the last match is the top-most
+		found = 0;
+		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+			gh = QItem2GWindow(qi);
+			if ((gh->flags & GWIN_FLG_VISIBLE)
+					&& x >= gh->x && x < gh->x + gh->width
+					&& y >= gh->y && y < gh->y + gh->height)
+				found = gh;
+		}
+		return found;
+	}
+
+	/* Process a mouse event */
+	static void gwidgetMouse(GEventMouse *pme) {
+		GHandle		gh;
+
+		// Are we captured?
+		if ((gh = MouseCapture)) {
+			// check it is still a widget that is enabled and visible
+			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) == (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) {
+				if ((pme->last_buttons & ~pme->current_buttons & GINPUT_MOUSE_BTN_LEFT)) {
+					gh->flags &= ~GWIN_FLG_MOUSECAPTURE;
+					MouseCapture = 0;
+					if (wvmt->MouseUp)
+						wvmt->MouseUp(gw, pme->x - gh->x, pme->y - gh->y);
+				} else if (wvmt->MouseMove)
+					wvmt->MouseMove(gw, pme->x - gh->x, pme->y - gh->y);
+				return;
+			}
+			gh->flags &= ~GWIN_FLG_MOUSECAPTURE;
+			MouseCapture = 0;
+		}
+
+		// We are not captured - look for mouse downs over the top-most window.
+		// Only an enabled widget can take the mouse - other windows just block it.
+		if ((~pme->last_buttons & pme->current_buttons & GINPUT_MOUSE_BTN_LEFT)
+				&& (gh = FindWindowAt(pme->x, pme->y))
+				&& (gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED)) == (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED)) {
+			gh->flags |= GWIN_FLG_MOUSECAPTURE;
+			MouseCapture = gh;
+			if (wvmt->MouseDown)
+				wvmt->MouseDown(gw, pme->x - gh->x, pme->y - gh->y);
+		}
+	}
+#endif
+
+#if GFX_USE_GINPUT && (GINPUT_NEED_TOGGLE || GINPUT_NEED_DIAL)
+	/**
+	 * A widget role that uses a toggle or dial instance.
+	 * The users of each instance are kept on a list so that an input event goes straight to them.
+	 */
+	typedef struct InputUser {
+		struct InputUser *	next;
+		GHandle				gh;
+		uint16_t			role;
+		} InputUser;
+
+	typedef struct InputMap {
+		InputUser **		users;			// users[instance] is the list of users of that instance
+		uint16_t			size;			// The number of entries in users[]
+		} InputMap;
+
+	// Add a user to an instance. Returns FALSE if there is no memory.
+	static bool_t InputMapAdd(InputMap *pm, uint16_t instance, GHandle gh, uint16_t role) {
+		InputUser **	pp;
+		InputUser *		pu;
+		uint16_t		i;
+
+		if (instance >= pm->size) {
+			if (!(pp = (InputUser **)gfxRealloc(pm->users, pm->size * sizeof(InputUser *), (instance+1) * sizeof(InputUser *))))
+				return FALSE;
+			for(i = pm->size; i <= instance; i++)
+				pp[i] = 0;
+			pm->users = pp;
+			pm->size = instance+1;
+		}
+		if (!(pu = (InputUser *)gfxAlloc(sizeof(InputUser))))
+			return FALSE;
+		pu->gh = gh;
+		pu->role = role;
+		pu->next = pm->users[instance];
+		pm->users[instance] = pu;
+		return TRUE;
+	}
+
+	// Remove a user from an instance. Returns TRUE if the instance has no users left.
+	static bool_t InputMapRemove(InputMap *pm, uint16_t instance, GHandle gh, uint16_t role) {
+		InputUser **	pp;
+		InputUser *		pu;
+
+		if (instance >= pm->size)
+			return TRUE;
+		for(pp = &pm->users[instance]; (pu = *pp); pp = &pu->next) {
+			if (pu->gh == gh && pu->role == role) {
+				*pp = pu->next;
+				gfxFree(pu);
+				break;
+			}
+		}
+		return !pm->users[instance];
+	}
+
+	// Get the list of users of an instance
+	#define InputMapUsers(pm, instance)		((instance) < (pm)->size ? (pm)->users[instance] : 0)
+#endif
+
+#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
+	static InputMap		ToggleMap;
+#endif
+
+#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
+	static InputMap		DialMap;
+#endif
+
 /* Process an event */
 static void gwidgetEvent(void *param, GEvent *pe) {
-	#define gh		QItem2GWindow(qi)
+	#define gh		(pu->gh)
 	#define pme		((GEventMouse *)pe)
 	#define pte		((GEventToggle *)pe)
 	#define pde		((GEventDial *)pe)
 
-	const gfxQueueASyncItem *	qi;
 	#if GFX_USE_GINPUT && (GINPUT_NEED_TOGGLE || GINPUT_NEED_DIAL)
-		uint16_t				role;
+		InputUser *		pu;
+		InputUser *		pnext;
 	#endif
-	(void)						param;
+	(void)				param;
 
 	// Process various events
 	switch (pe->type) {
@@ -99,53 +342,26 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 	#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
 	case GEVENT_MOUSE:
 	case GEVENT_TOUCH:
-		// Cycle through all windows
-		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
-
-			// check if it a widget that is enabled and visible
-			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) != (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE))
-				continue;
-
-			// Are we captured?
-			if ((gw->g.flags & GWIN_FLG_MOUSECAPTURE)) {
-				if ((pme->last_buttons & ~pme->current_buttons & GINPUT_MOUSE_BTN_LEFT)) {
-					gw->g.flags &= ~GWIN_FLG_MOUSECAPTURE;
-					if (wvmt->MouseUp)
-						wvmt->MouseUp(gw, pme->x - gw->g.x, pme->y - gw->g.y);
-				} else if (wvmt->MouseMove)
-					wvmt->MouseMove(gw, pme->x - gw->g.x, pme->y - gw->g.y);
-
-			// We are not captured - look for mouse downs over the widget
-			} else if ((~pme->last_buttons & pme->current_buttons & GINPUT_MOUSE_BTN_LEFT)
-					&& pme->x >= gw->g.x && pme->x < gw->g.x + gw->g.width
-					&& pme->y >= gw->g.y && pme->y < gw->g.y + gw->g.height) {
-				gw->g.flags |= GWIN_FLG_MOUSECAPTURE;
-				if (wvmt->MouseDown)
-					wvmt->MouseDown(gw, pme->x - gw->g.x, pme->y - gw->g.y);
-			}
-		}
+		gwidgetMouse(pme);
 		break;
 	#endif
 
 	#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
 	case GEVENT_TOGGLE:
-		// Cycle through all windows
-		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+		// Cycle through the widget roles using this toggle
+		for(pu = InputMapUsers(&ToggleMap, pte->instance); pu; pu = pnext) {
+			pnext = pu->next;
 
-			// check if it a widget that is enabled and visible
-			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) != (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE))
+			// check if it is enabled and visible
+			if ((gh->flags & (GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) != (GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE))
 				continue;
 
-			for(role = 0; role < wvmt->toggleroles; role++) {
-				if (wvmt->ToggleGet(gw, role) == pte->instance) {
-					if (pte->on) {
-						if (wvmt->ToggleOn)
-							wvmt->ToggleOn(gw, role);
-					} else {
-						if (wvmt->ToggleOff)
-							wvmt->ToggleOff(gw, role);
-					}
-				}
+			if (pte->on) {
+				if (wvmt->ToggleOn)
+					wvmt->ToggleOn(gw, pu->role);
+			} else {
+				if (wvmt->ToggleOff)
+					wvmt->ToggleOff(gw, pu->role);
 			}
 		}
 		break;
@@ -153,19 +369,16 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 
 	#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
 	case GEVENT_DIAL:
-		// Cycle through all windows
-		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+		// Cycle through the widget roles using this dial
+		for(pu = InputMapUsers(&DialMap, pde->instance); pu; pu = pnext) {
+			pnext = pu->next;
 
-			// check if it a widget that is enabled and visible
-			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) != (GWIN_FLG_WIDGET|GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE))
+			// check if it is enabled and visible
+			if ((gh->flags & (GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE)) != (GWIN_FLG_ENABLED|GWIN_FLG_VISIBLE))
 				continue;
 
-			for(role = 0; role < wvmt->dialroles; role++) {
-				if (wvmt->DialGet(gw, role) == pte->instance) {
-					if (wvmt->DialMove)
-						wvmt->DialMove(gw, role, pde->value, pde->maxvalue);
-				}
-			}
+			if (wvmt->DialMove)
+				wvmt->DialMove(gw, pu->role, pde->value, pde->maxvalue);
 		}
 		break;
 	#endif
@@ -180,46 +393,6 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 	#undef pde
 }
 
-#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
-	static GHandle FindToggleUser(uint16_t instance) {
-		#define gh					QItem2GWindow(qi)
-		const gfxQueueASyncItem *	qi;
-		uint16_t					role;
-
-		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
-			if (!(gh->flags & GWIN_FLG_WIDGET))		// check if it a widget
-				continue;
-
-			for(role = 0; role < wvmt->toggleroles; role++) {
-				if (wvmt->ToggleGet(gw, role) == instance)
-					return gh;
-			}
-		}
-		return 0;
-		#undef gh
-	}
-#endif
-
-#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
-	static GHandle FindDialUser(uint16_t instance) {
-		#define gh					QItem2GWindow(qi)
-		const gfxQueueASyncItem *	qi;
-		uint16_t					role;
-
-		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
-			if (!(gh->flags & GWIN_FLG_WIDGET))		// check if it a widget
-				continue;
-
-			for(role = 0; role < wvmt->dialroles; role++) {
-				if (wvmt->DialGet(gw, role) == instance)
-					return gh;
-			}
-		}
-		return 0;
-		#undef gh
-	}
-#endif
-
 void _gwidgetInit(void) {
 	geventListenerInit(&gl);
 	geventRegisterCallback(&gl, gwidgetEvent, 0);
@@ -254,7 +427,7 @@ void _gwidgetDestroy(GHandle gh) {
 			instance = wvmt->ToggleGet(gw, role);
 			if (instance != GWIDGET_NO_INSTANCE) {
 				wvmt->ToggleAssign(gw, role, GWIDGET_NO_INSTANCE);
-				if (!FindToggleUser(instance))
+				if (InputMapRemove(&ToggleMap, instance, gh, role))
 					geventDetachSource(&gl, ginputGetToggle(instance));
 			}
 		}
@@ -266,12 +439,18 @@ void _gwidgetDestroy(GHandle gh) {
 			instance = wvmt->DialGet(gw, role);
 			if (instance != GWIDGET_NO_INSTANCE) {
 				wvmt->DialAssign(gw, role, GWIDGET_NO_INSTANCE);
-				if (!FindDialUser(instance))
+				if (InputMapRemove(&DialMap, instance, gh, role))
 					geventDetachSource(&gl, ginputGetDial(instance));
 			}
 		}
 	#endif
 
+	#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
+		// Release the mouse
+		if (MouseCapture == gh)
+			MouseCapture = 0;
+	#endif
+
 	// Remove any listeners on this object.
 	geventDetachSourceListeners((GSourceHandle)gh);
 }
@@ -280,10 +459,7 @@ void _gwidgetRedraw(GHandle gh) {
 	if (!(gh->flags & GWIN_FLG_VISIBLE))
 		return;
 
-	#if GDISP_NEED_CLIP
-		gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-	#endif
-
+	// The caller has already set the clip area
 	gw->fnDraw(gw, gw->fnParam);
 }
 
@@ -341,7 +517,7 @@ void gwinSetText(GHandle gh, const char *text, bool_t useAlloc) {
 		gw->text = (const char *)str;
 	} else
 		gw->text = text;
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 }
 
 const char *gwinGetText(GHandle gh) {
@@ -357,7 +533,7 @@ void gwinSetStyle(GHandle gh, const GWidgetStyle *pstyle) {
 	gw->pstyle = pstyle ? pstyle : defaultStyle;
 	gh->bgcolor = pstyle->background;
 	gh->color = pstyle->enabled.text;
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 }
 
 const GWidgetStyle *gwinGetStyle(GHandle gh) {
@@ -370,7 +546,7 @@ void gwinSetCustomDraw(GHandle gh, CustomWidgetDrawFunction fn, void *param) {
 
 	gw->fnDraw = fn ? fn : wvmt->DefaultDraw;
 	gw->fnParam = param;
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 }
 
 bool_t gwinAttachListener(GListener *pl) {
@@ -413,11 +589,13 @@ bool_t gwinAttachListener(GListener *pl) {
 		// Remove the old instance
 		if (oi != GWIDGET_NO_INSTANCE) {
 			wvmt->ToggleAssign(gw, role, GWIDGET_NO_INSTANCE);
-			if (!FindToggleUser(oi))
+			if (InputMapRemove(&ToggleMap, oi, gh, role))
 				geventDetachSource(&gl, ginputGetToggle(oi));
 		}
 
 		// Assign the new
+		if (!InputMapAdd(&ToggleMap, instance, gh, role))
+			return FALSE;
 		wvmt->ToggleAssign(gw, role, instance);
 		return geventAttachSource(&gl, gsh, GLISTEN_TOGGLE_ON|GLISTEN_TOGGLE_OFF);
 	}
@@ -447,11 +625,13 @@ bool_t gwinAttachListener(GListener *pl) {
 		// Remove the old instance
 		if (oi != GWIDGET_NO_INSTANCE) {
 			wvmt->DialAssign(gw, role, GWIDGET_NO_INSTANCE);
-			if (!FindDialUser(oi))
+			if (InputMapRemove(&DialMap, oi, gh, role))
 				geventDetachSource(&gl, ginputGetDial(oi));
 		}
 
 		// Assign the new
+		if (!InputMapAdd(&DialMap, instance, gh, role))
+			return FALSE;
 		wvmt->DialAssign(gw, role, instance);
 		return geventAttachSource(&gl, gsh, 0);
 	}
@@ -27,6 +27,10 @@ static const gwinVMT basegwinVMT = {
 		0,						// The after-clear routine
 };
 
+#if GWIN_REDRAW_DEFERRED && GWIN_REDRAW_PERIOD
+	static GTimer	RedrawTimer;
+#endif
+
 static color_t	defaultFgColor = White;
 static color_t	defaultBgColor = Black;
 #if GDISP_NEED_TEXT
@@ -71,11 +75,21 @@ static color_t	defaultBgColor = Black;
 	}
 #endif
 
+#if GWIN_REDRAW_DEFERRED && GWIN_REDRAW_PERIOD
+	static void RedrawTimerFn(void *param) {
+		(void) param;
+		gwinRedrawDisplay();
+	}
+#endif
+
 /*-----------------------------------------------
  * Class Routines
  *-----------------------------------------------*/
 
 void _gwinInit(void) {
+	#if GWIN_REDRAW_DEFERRED && GWIN_REDRAW_PERIOD
+		gtimerInit(&RedrawTimer);
+	#endif
 	#if GWIN_NEED_WIDGET
 		extern void _gwidgetInit(void);
 
@@ -120,10 +134,66 @@ GHandle _gwindowCreate(GWindowObject *pgw, const GWindowInit *pInit, const gwinV
 	return (GHandle)pgw;
 }
 
+// Internal routine for use by GWIN components only
+// Redraw a visible window now. The window manager only draws the parts that can be seen.
+void _gwinDraw(GHandle gh) {
+	if (!(gh->flags & GWIN_FLG_VISIBLE))
+		return;
+
+	#if GWIN_NEED_WINDOWMANAGER
+		_GWINwm->vmt->Redraw(gh);
+	#else
+		_gwm_vis(gh);
+	#endif
+}
+
+// Internal routine for use by GWIN components only
+// Redraw a visible window after it has changed.
+void _gwinUpdate(GHandle gh) {
+	#if GWIN_REDRAW_DEFERRED
+		if (!(gh->flags & GWIN_FLG_VISIBLE))
+			return;
+
+		// A window that can't redraw itself is just cleared. That must happen now
+		// or it would wipe out whatever the application draws on it in the meantime.
+		if (!gh->vmt->Redraw) {
+			_gwinDraw(gh);
+			return;
+		}
+
+		// Just mark it. Many changes before the next redraw pass only draw it once.
+		gh->flags |= GWIN_FLG_NEEDREDRAW;
+		#if GWIN_REDRAW_PERIOD
+			if (!gtimerIsActive(&RedrawTimer))
+				gtimerStart(&RedrawTimer, RedrawTimerFn, 0, FALSE, GWIN_REDRAW_PERIOD);
+		#endif
+	#else
+		_gwinDraw(gh);
+	#endif
+}
+
 /*-----------------------------------------------
  * Routines that affect all windows
  *-----------------------------------------------*/
 
+#if GWIN_NEED_WINDOWMANAGER
+	void gwinRedrawDisplay(void) {
+		#if GWIN_REDRAW_DEFERRED
+			const gfxQueueASyncItem *	qi;
+			GHandle						gh;
+
+			// Draw the marked windows from the bottom up
+			for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+				gh = QItem2GWindow(qi);
+				if ((gh->flags & GWIN_FLG_NEEDREDRAW)) {
+					gh->flags &= ~GWIN_FLG_NEEDREDRAW;
+					_gwinDraw(gh);
+				}
+			}
+		#endif
+	}
+#endif
+
 void gwinSetDefaultColor(color_t clr) {
 	defaultFgColor = clr;
 }
@@ -166,6 +236,7 @@ void gwinDestroy(GHandle gh) {
 	#if GWIN_NEED_WINDOWMANAGER
 		_GWINwm->vmt->Delete(gh);
 	#endif
+	_gwidgetHitGridInvalidate();
 
 	// Class destroy routine
 	if (gh->vmt->Destroy)
@@ -201,6 +272,7 @@ void gwinSetVisible(GHandle gh, bool_t visible) {
 			#endif
 		}
 	}
+	_gwidgetHitGridInvalidate();
 }
 
 bool_t gwinGetVisible(GHandle gh) {
@@ -211,22 +283,14 @@ void gwinSetEnabled(GHandle gh, bool_t enabled) {
 	if (enabled) {
 		if (!(gh->flags & GWIN_FLG_ENABLED)) {
 			gh->flags |= GWIN_FLG_ENABLED;
-			if ((gh->flags & GWIN_FLG_VISIBLE) && gh->vmt->Redraw) {
-				#if GDISP_NEED_CLIP
-					gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-				#endif
-				gh->vmt->Redraw(gh);
-			}
+			if (gh->vmt->Redraw)
+				_gwinUpdate(gh);
 		}
 	} else {
 		if ((gh->flags & GWIN_FLG_ENABLED)) {
 			gh->flags &= ~GWIN_FLG_ENABLED;
-			if ((gh->flags & GWIN_FLG_VISIBLE) && gh->vmt->Redraw) {
-				#if GDISP_NEED_CLIP
-					gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-				#endif
-				gh->vmt->Redraw(gh);
-			}
+			if (gh->vmt->Redraw)
+				_gwinUpdate(gh);
 		}
 	}
 }
@@ -241,6 +305,7 @@ void gwinMove(GHandle gh, coord_t x, coord_t y) {
 	#else
 		_gwm_redim(gh, x, y, gh->width, gh->height);
 	#endif
+	_gwidgetHitGridInvalidate();
 }
 
 void gwinResize(GHandle gh, coord_t width, coord_t height) {
@@ -249,15 +314,11 @@ void gwinResize(GHandle gh, coord_t width, coord_t height) {
 	#else
 		_gwm_redim(gh, gh->x, gh->y, width, height);
 	#endif
+	_gwidgetHitGridInvalidate();
 }
 
 void gwinRedraw(GHandle gh) {
-	#if GWIN_NEED_WINDOWMANAGER
-		gwinRaise(gh);
-	#else
-		if ((gh->flags & GWIN_FLG_VISIBLE))
-			_gwm_vis(gh);
-	#endif
+	_gwinUpdate(gh);
 }
 
 #if GDISP_NEED_TEXT
@@ -31,6 +31,7 @@ static void WM_Visible(GHandle gh);
 static void WM_Redim(GHandle gh, coord_t x, coord_t y, coord_t w, coord_t h);
 static void WM_Raise(GHandle gh);
 static void WM_MinMax(GHandle gh, GWindowMinMax minmax);
+static void WM_Redraw(GHandle gh);
 
 static const gwmVMT GNullWindowManagerVMT = {
 	WM_Init,
@@ -41,6 +42,7 @@ static const gwmVMT GNullWindowManagerVMT = {
 	WM_Redim,
 	WM_Raise,
 	WM_MinMax,
+	WM_Redraw,
 };
 
 static const GWindowManager	GNullWindowManager = {
@@ -72,10 +74,12 @@ void gwinSetWindowManager(struct GWindowManager *gwm) {
 
 void gwinSetMinMax(GHandle gh, GWindowMinMax minmax) {
 	_GWINwm->vmt->MinMax(gh, minmax);
+	_gwidgetHitGridInvalidate();
 }
 
 void gwinRaise(GHandle gh) {
 	_GWINwm->vmt->Raise(gh);
+	_gwidgetHitGridInvalidate();
 }
 
 GWindowMinMax gwinGetMinMax(GHandle gh) {
@@ -86,6 +90,97 @@ GWindowMinMax gwinGetMinMax(GHandle gh) {
 	return GWIN_NORMAL;
 }
 
+/*-----------------------------------------------
+ * Occlusion Helpers
+ *
+ * The order of _GWINList is the z-order (the last window is on top).
+ * The visible area of a window is its rectangle less the rectangles of
+ * all the visible windows above it. Rather than storing that area for
+ * each window it is worked out from the list whenever something is drawn.
+ * Each piece is drawn by setting the clip area to it and redrawing the
+ * window so that no pixel covered by another window is ever touched.
+ *-----------------------------------------------*/
+
+// Draw the area x0,y0 -> x1,y1 (not inclusive) of a window. gh == 0 is the screen background.
+static void wmDraw(GHandle gh, coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+	#if GDISP_NEED_CLIP
+		gdispSetClip(x0, y0, x1-x0, y1-y0);
+	#endif
+	if (!gh)
+		gdispFillArea(x0, y0, x1-x0, y1-y0, gwinGetDefaultBgColor());
+	else if (gh->vmt->Redraw)
+		gh->vmt->Redraw(gh);
+	else
+		gdispFillArea(x0, y0, x1-x0, y1-y0, gh->bgcolor);
+}
+
+#if GDISP_NEED_CLIP
+	/**
+	 * Draw the parts of the area x0,y0 -> x1,y1 that are not covered by any visible window
+	 * in the list from qi up to (but not including) qend. A qend of 0 means the top of the list.
+	 *
+	 * The first covering window splits the area into (at most) 4 pieces around it
+	 * and each piece is then checked against the windows above that one.
+	 */
+	static void wmPaint(GHandle gh, const gfxQueueASyncItem *qi, const gfxQueueASyncItem *qend, coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+		GHandle		w;
+
+		for(; qi != qend; qi = gfxQueueASyncNext(qi)) {
+			w = QItem2GWindow(qi);
+			if (!(w->flags & GWIN_FLG_VISIBLE)
+					|| w->x >= x1 || w->x + w->width <= x0
+					|| w->y >= y1 || w->y + w->height <= y0)
+				continue;
+
+			qi = gfxQueueASyncNext(qi);
+			if (w->y > y0) {
+				wmPaint(gh, qi, qend, x0, y0, x1, w->y);
+				y0 = w->y;
+			}
+			if (w->y + w->height < y1) {
+				wmPaint(gh, qi, qend, x0, w->y + w->height, x1, y1);
+				y1 = w->y + w->height;
+			}
+			if (w->x > x0)
+				wmPaint(gh, qi, qend, x0, y0, w->x, y1);
+			if (w->x + w->width < x1)
+				wmPaint(gh, qi, qend, w->x + w->width, y0, x1, y1);
+			return;
+		}
+		wmDraw(gh, x0, y0, x1, y1);
+	}
+
+	// Repaint whatever is now visible in an area (the windows underneath and the background)
+	static void wmExpose(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+		const gfxQueueASyncItem *	qi;
+		GHandle						w;
+
+		if (x0 >= x1 || y0 >= y1)
+			return;
+
+		for(qi = gfxQueueASyncPeek(&_GWINList); qi; qi = gfxQueueASyncNext(qi)) {
+			w = QItem2GWindow(qi);
+			if (!(w->flags & GWIN_FLG_VISIBLE)
+					|| w->x >= x1 || w->x + w->width <= x0
+					|| w->y >= y1 || w->y + w->height <= y0)
+				continue;
+			wmPaint(w, gfxQueueASyncNext(qi), 0,
+					w->x > x0 ? w->x : x0, w->y > y0 ? w->y : y0,
+					w->x + w->width < x1 ? w->x + w->width : x1, w->y + w->height < y1 ? w->y + w->height : y1);
+		}
+		wmPaint(0, gfxQueueASyncPeek(&_GWINList), 0, x0, y0, x1, y1);
+	}
+#else
+	// Without clipping the covered parts of a window can't be avoided - just draw the lot
+	#define wmPaint(gh, qi, qend, x0, y0, x1, y1)	wmDraw(gh, x0, y0, x1, y1)
+
+	// Without clipping we can't redraw just part of the windows underneath so just clear the area
+	static void wmExpose(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+		if (x0 < x1 && y0 < y1)
+			gdispFillArea(x0, y0, x1-x0, y1-y0, gwinGetDefaultBgColor());
+	}
+#endif
+
 /*-----------------------------------------------
  * Window Manager Routines
  *-----------------------------------------------*/
@@ -116,31 +211,27 @@ static bool_t WM_Add(GHandle gh, const GWindowInit *pInit) {
 }
 
 static void WM_Delete(GHandle gh) {
-	// Make the window invisible and clear the area underneath
+	// Remove it from the queue
+	gfxQueueASyncRemove(&_GWINList, &gh->wmq);
+
+	// Make the window invisible and repaint whatever was underneath
 	if ((gh->flags & GWIN_FLG_VISIBLE)) {
 		gh->flags &= ~GWIN_FLG_VISIBLE;
-		gdispFillArea(gh->x, gh->y, gh->width, gh->height, gwinGetDefaultBgColor());
+		wmExpose(gh->x, gh->y, gh->x+gh->width, gh->y+gh->height);
 	}
-
-	// Remove it from the queue
-	gfxQueueASyncRemove(&_GWINList, &gh->wmq);
 }
 
 static void WM_Visible(GHandle gh) {
-	#if GDISP_NEED_CLIP
-		gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-	#endif
 	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		if (gh->vmt->Redraw)
-			gh->vmt->Redraw(gh);
-		else
-			gdispFillArea(gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+		_gwinUpdate(gh);
 		// A real window manager would also redraw the borders here
 	} else
-		gdispFillArea(gh->x, gh->y, gh->width, gh->height, gwinGetDefaultBgColor());
+		wmExpose(gh->x, gh->y, gh->x+gh->width, gh->y+gh->height);
 }
 
 static void WM_Redim(GHandle gh, coord_t x, coord_t y, coord_t w, coord_t h) {
+	coord_t		ox0, oy0, ox1, oy1;
+
 	// This is the simplest way of doing it - just clip the the screen
 	// If it won't fit on the screen move it around until it does.
 	if (x < 0) { w += x; x = 0; }
@@ -156,23 +247,29 @@ static void WM_Redim(GHandle gh, coord_t x, coord_t y, coord_t w, coord_t h) {
 	if (gh->x == x && gh->y == y && gh->width == w && gh->height == h)
 		return;
 
-	// Clear the old area
-	if ((gh->flags & GWIN_FLG_VISIBLE))
-		gdispFillArea(gh->x, gh->y, gh->width, gh->height, gwinGetDefaultBgColor());
-
 	// Set the new size
+	ox0 = gh->x; oy0 = gh->y;
+	ox1 = gh->x + gh->width; oy1 = gh->y + gh->height;
 	gh->x = x; gh->y = y;
 	gh->width = w; gh->height = h;
 
+	if (!(gh->flags & GWIN_FLG_VISIBLE))
+		return;
+
 	// Redraw the window (if possible)
-	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		if (gh->vmt->Redraw) {
-			#if GDISP_NEED_CLIP
-				gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-			#endif
-			gh->vmt->Redraw(gh);
-		}
+	if (gh->vmt->Redraw)
+		WM_Redraw(gh);
+
+	// Repaint the old area that is no longer covered by the window.
+	// That is (at most) 4 rectangles around the new area.
+	if (x >= ox1 || x+w <= ox0 || y >= oy1 || y+h <= oy0) {
+		wmExpose(ox0, oy0, ox1, oy1);
+		return;
 	}
+	if (y > oy0) { wmExpose(ox0, oy0, ox1, y); oy0 = y; }
+	if (y+h < oy1) { wmExpose(ox0, y+h, ox1, oy1); oy1 = y+h; }
+	if (x > ox0) wmExpose(ox0, oy0, x, oy1);
+	if (x+w < ox1) wmExpose(x+w, oy0, ox1, oy1);
 }
 
 static void WM_MinMax(GHandle gh, GWindowMinMax minmax) {
@@ -181,20 +278,54 @@ static void WM_MinMax(GHandle gh, GWindowMinMax minmax) {
 }
 
 static void WM_Raise(GHandle gh) {
+	const gfxQueueASyncItem *	qabove;
+	const gfxQueueASyncItem *	qi;
+	GHandle						w;
+
+	// If it is already on top there is nothing to do
+	if (!(qabove = gfxQueueASyncNext(&gh->wmq)))
+		return;
+
 	// Take it off the list and then put it back on top
 	// The order of the list then reflects the z-order.
 	gfxQueueASyncRemove(&_GWINList, &gh->wmq);
 	gfxQueueASyncPut(&_GWINList, &gh->wmq);
 
-	// Redraw the window
-	if ((gh->flags & GWIN_FLG_VISIBLE)) {
-		if (gh->vmt->Redraw) {
-			#if GDISP_NEED_CLIP
-				gdispSetClip(gh->x, gh->y, gh->width, gh->height);
-			#endif
-			gh->vmt->Redraw(gh);
+	if (!(gh->flags & GWIN_FLG_VISIBLE) || !gh->vmt->Redraw)
+		return;
+
+	#if GDISP_NEED_CLIP
+		// Only the parts that were covered by the windows that used to be above it need redrawing.
+		// Each window's part is drawn less what the windows before it have already drawn.
+		for(qi = qabove; qi != &gh->wmq; qi = gfxQueueASyncNext(qi)) {
+			w = QItem2GWindow(qi);
+			if (!(w->flags & GWIN_FLG_VISIBLE)
+					|| w->x >= gh->x + gh->width || w->x + w->width <= gh->x
+					|| w->y >= gh->y + gh->height || w->y + w->height <= gh->y)
+				continue;
+			wmPaint(gh, qabove, qi,
+					w->x > gh->x ? w->x : gh->x, w->y > gh->y ? w->y : gh->y,
+					w->x + w->width < gh->x + gh->width ? w->x + w->width : gh->x + gh->width,
+					w->y + w->height < gh->y + gh->height ? w->y + w->height : gh->y + gh->height);
 		}
-	}
+	#else
+		(void) qi; (void) w;
+		WM_Redraw(gh);
+	#endif
+}
+
+static void WM_Redraw(GHandle gh) {
+	if (!(gh->flags & GWIN_FLG_VISIBLE))
+		return;
+
+	// Anything waiting for a redraw pass is now done
+	gh->flags &= ~GWIN_FLG_NEEDREDRAW;
+
+	wmPaint(gh, gfxQueueASyncNext(&gh->wmq), 0, gh->x, gh->y, gh->x+gh->width, gh->y+gh->height);
+
+	// A window that can't redraw itself has just been cleared
+	if (!gh->vmt->Redraw && gh->vmt->AfterClear)
+		gh->vmt->AfterClear(gh);
 }
 
 #endif /* GFX_USE_GWIN && GWIN_NEED_WINDOWMANAGER */
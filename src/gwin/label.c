@@ -50,16 +50,34 @@ static void gwinLabelDefaultDraw(GWidgetObject *gw, void *param) {
 		return;
 	}
 
+	#if GDISP_NEED_TEXT_LAYOUT
+		// The text is only measured again if it or the font has changed. A label is a single line.
+		if (gdispTextLayoutSet(&((GLabelObject *)gw)->layout, gw->text, gw->g.font, justifyLeft, -1)) {
+			gdispFillTextLayout(&((GLabelObject *)gw)->layout, gw->g.x, gw->g.y, gw->g.width, gw->g.height,
+					(gw->g.flags & GWIN_FLG_ENABLED) ? gw->pstyle->enabled.text : gw->pstyle->disabled.text, gw->pstyle->background);
+			return;
+		}
+	#endif
+
 	gdispFillStringBox(gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font,
 			(gw->g.flags & GWIN_FLG_ENABLED) ? gw->pstyle->enabled.text : gw->pstyle->disabled.text, gw->pstyle->background,
 			justifyLeft);
 }
 
+#if GDISP_NEED_TEXT_LAYOUT
+	static void gwinLabelDestroy(GHandle gh) {
+		gdispTextLayoutFree(&((GLabelObject *)gh)->layout);
+		_gwidgetDestroy(gh);
+	}
+#else
+	#define gwinLabelDestroy	_gwidgetDestroy
+#endif
+
 static const gwidgetVMT labelVMT = {
 	{
 		"Label",				// The class name
 		sizeof(GLabelObject),	// The object size
-		_gwidgetDestroy,		// The destroy routine
+		gwinLabelDestroy,		// The destroy routine
 		_gwidgetRedraw, 		// The redraw routine
 		0,						// The after-clear routine
 	},
@@ -110,6 +128,9 @@ GHandle gwinLabelCreate(GLabelObject *widget, GWidgetInit *pInit) {
 		return 0;
 
 	widget->w.g.flags |= flags;
+	#if GDISP_NEED_TEXT_LAYOUT
+		gdispTextLayoutInit(&widget->layout);
+	#endif
 
 	gwinSetVisible(&widget->w.g, pInit->g.show);
 	return (GHandle)widget;
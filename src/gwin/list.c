@@ -167,12 +167,12 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 			if (y < 2*ARROW) {
 				if (gw2obj->top > 0) {
 					gw2obj->top--;
-					_gwidgetRedraw(&gw->g);
+					_gwinUpdate(&gw->g);
 				}
 			} else if (y >= gw->g.height - 2*ARROW) {
 				if (gw2obj->top < gw2obj->cnt - pgsz) {
 					gw2obj->top++;
-					_gwidgetRedraw(&gw->g);
+					_gwinUpdate(&gw->g);
 				}
 			} else if (y < gw->g.height/2) {
 				if (gw2obj->top > 0) {
@@ -180,7 +180,7 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 						gw2obj->top -= pgsz;
 					else
 						gw2obj->top = 0;
-					_gwidgetRedraw(&gw->g);
+					_gwinUpdate(&gw->g);
 				}
 			} else {
 				if (gw2obj->top < gw2obj->cnt - pgsz) {
@@ -188,7 +188,7 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 						gw2obj->top += pgsz;
 					else
 						gw2obj->top = gw2obj->cnt - pgsz;
-					_gwidgetRedraw(&gw->g);
+					_gwinUpdate(&gw->g);
 				}
 			}
 			return;
@@ -214,7 +214,7 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 			}
 		}
 
-		_gwidgetRedraw(&gw->g);
+		_gwinUpdate(&gw->g);
 		sendListEvent(gw, item);
 	}
 #endif
@@ -235,7 +235,7 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 						if (qix) {
 							qi2li->flags &=~ GLIST_FLG_SELECTED;
 							qix2li->flags |= GLIST_FLG_SELECTED;
-							_gwidgetRedraw(&gw->g);
+							_gwinUpdate(&gw->g);
 						}
 						break;
 					}
@@ -252,7 +252,7 @@ static void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 						if (qix) {
 							qi2li->flags &=~ GLIST_FLG_SELECTED;
 							qix2li->flags |= GLIST_FLG_SELECTED;
-							_gwidgetRedraw(&gw->g);
+							_gwinUpdate(&gw->g);
 						}
 						break;
 					}
@@ -365,7 +365,7 @@ int gwinListAddItem(GHandle gh, const char* item_name, bool_t useAlloc) {
 	// increment the total amount of entries in the list widget
 	gh2obj->cnt++;
 
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 
 	// return the position in the list (-1 because we start with index 0)
 	return gh2obj->cnt-1;
@@ -463,7 +463,7 @@ void gwinListDeleteAll(GHandle gh) {
 	gh->flags &= ~GLIST_FLG_HASIMAGES;
 	gh2obj->cnt = 0;
 	gh2obj->top = 0;
-	_gwidgetRedraw(gh);
+	_gwinUpdate(gh);
 }
 
 void gwinListItemDelete(GHandle gh, int item) {
@@ -484,7 +484,7 @@ void gwinListItemDelete(GHandle gh, int item) {
 			gfxFree((void *)qi);
 			if (gh2obj->top >= item && gh2obj->top)
 				gh2obj->top--;
-			_gwidgetRedraw(gh);
+			_gwinUpdate(gh);
 			break;
 		}
 	}
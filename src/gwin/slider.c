@@ -74,7 +74,7 @@ static void ResetDisplayPos(GSliderObject *gsw) {
 			if (x < 0 || x >= gh->width || y < 0 || y >= gh->height) {
 				// No - restore the slider
 				ResetDisplayPos(gsw);
-				_gwidgetRedraw(gh);
+				_gwinUpdate(gh);
 				return;
 			}
 		#endif
@@ -97,7 +97,7 @@ static void ResetDisplayPos(GSliderObject *gsw) {
 		}
 
 		ResetDisplayPos(gsw);
-		_gwidgetRedraw(gh);
+		_gwinUpdate(gh);
 
 		// Generate the event
 		SendSliderEvent(gw);
@@ -127,7 +127,7 @@ static void ResetDisplayPos(GSliderObject *gsw) {
 		}
 
 		// Update the display
-		_gwidgetRedraw(&gw->g);
+		_gwinUpdate(&gw->g);
 		#undef gsw
 	}
 #endif
@@ -169,7 +169,7 @@ static void ResetDisplayPos(GSliderObject *gsw) {
 		gsw->pos = (uint16_t)((uint32_t)value*(gsw->max-gsw->min)/max + gsw->min);
 
 		ResetDisplayPos(gsw);
-		_gwidgetRedraw((GHandle)gw);
+		_gwinUpdate((GHandle)gw);
 
 		// Generate the event
 		SendSliderEvent(gw);
@@ -0,0 +1,405 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * The font data and the .dat file format.
+ *
+ * The .dat file is line based text:
+ *		Version 1
+ *		FontName <full name>
+ *		MaxWidth, MaxHeight, BaselineX, BaselineY, LineHeight, Flags, RandomSeed <number>
+ *		DictEntry <score> <refencode> <one hex digit per pixel>
+ *		Glyph <char>[,<char>...] <width> <one hex digit per pixel>
+ */
+
+#include <string.h>
+#include <ctype.h>
+#include "mcufont.h"
+
+fontdata *fontNew(void) {
+	fontdata	*f;
+
+	f = xalloc(sizeof(fontdata));
+	f->seed = 1234;
+	return f;
+}
+
+static void dictClear(fontdata *f) {
+	unsigned	i;
+
+	for(i = 0; i < f->ndict; i++)
+		free(f->dict[i].pixels);
+	f->ndict = 0;
+}
+
+void fontFree(fontdata *f) {
+	unsigned	i;
+
+	for(i = 0; i < f->nglyphs; i++) {
+		free(f->glyphs[i].chars);
+		free(f->glyphs[i].pixels);
+	}
+	free(f->glyphs);
+	dictClear(f);
+	free(f);
+}
+
+/**
+ * Add a character to the font. The pixels become owned by the font.
+ * Characters with identical bitmaps share a single glyph.
+ */
+fontglyph *fontAddGlyph(fontdata *f, unsigned ch, int width, uint8_t *pixels) {
+	fontglyph	*g;
+	unsigned	i, sz;
+
+	sz = f->maxwidth * f->maxheight;
+	for(i = 0; i < f->nglyphs; i++) {
+		g = &f->glyphs[i];
+		if (g->width == width && !memcmp(g->pixels, pixels, sz)) {
+			free(pixels);
+			goto addchar;
+		}
+	}
+
+	if (!(f->nglyphs & 63))
+		f->glyphs = xrealloc(f->glyphs, (f->nglyphs+64) * sizeof(fontglyph));
+	g = &f->glyphs[f->nglyphs++];
+	memset(g, 0, sizeof(fontglyph));
+	g->width = width;
+	g->pixels = pixels;
+
+addchar:
+	g->chars = xrealloc(g->chars, (g->nchars+1) * sizeof(uint16_t));
+	g->chars[g->nchars++] = ch;
+	return g;
+}
+
+int fontFindGlyph(const fontdata *f, unsigned ch) {
+	unsigned	i, j;
+
+	for(i = 0; i < f->nglyphs; i++) {
+		for(j = 0; j < f->glyphs[i].nchars; j++) {
+			if (f->glyphs[i].chars[j] == ch)
+				return i;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Trim the empty rows and columns from the edges of the glyph box.
+ * The box is never trimmed past the baseline origin.
+ */
+void fontCrop(fontdata *f) {
+	int			x, y, x0, y0, x1, y1, w, h;
+	unsigned	i;
+	uint8_t		*p, *np;
+
+	x0 = f->baselinex; y0 = f->baseliney;
+	x1 = y1 = -1;
+	for(i = 0; i < f->nglyphs; i++) {
+		p = f->glyphs[i].pixels;
+		for(y = 0; y < f->maxheight; y++) {
+			for(x = 0; x < f->maxwidth; x++, p++) {
+				if (!*p) continue;
+				if (x < x0) x0 = x;
+				if (y < y0) y0 = y;
+				if (x > x1) x1 = x;
+				if (y > y1) y1 = y;
+			}
+		}
+	}
+	if (x1 < 0)
+		return;
+	if (x1 < x0) x1 = x0;
+	if (y1 < y0) y1 = y0;
+	w = x1 - x0 + 1;
+	h = y1 - y0 + 1;
+	if (w == f->maxwidth && h == f->maxheight)
+		return;
+
+	for(i = 0; i < f->nglyphs; i++) {
+		p = f->glyphs[i].pixels;
+		np = xalloc(w * h);
+		for(y = 0; y < h; y++)
+			memcpy(np + y * w, p + (y + y0) * f->maxwidth + x0, w);
+		free(p);
+		f->glyphs[i].pixels = np;
+	}
+	f->maxwidth = w;
+	f->maxheight = h;
+	f->baselinex -= x0;
+	f->baseliney -= y0;
+
+	/* The dictionary entries are pixel strings for the old box size */
+	dictClear(f);
+}
+
+void fontSetFlags(fontdata *f) {
+	unsigned	i, j, sz;
+
+	sz = f->maxwidth * f->maxheight;
+	f->flags = FLAG_MONOSPACE|FLAG_BW;
+	for(i = 0; i < f->nglyphs; i++) {
+		if (f->glyphs[i].width != f->glyphs[0].width)
+			f->flags &= ~FLAG_MONOSPACE;
+		for(j = 0; j < sz; j++) {
+			if (f->glyphs[i].pixels[j] != 0 && f->glyphs[i].pixels[j] != 15) {
+				f->flags &= ~FLAG_BW;
+				break;
+			}
+		}
+	}
+}
+
+/* Parse a character range such as "32-127", "0x20-0x39" or "65" */
+int fontParseRange(const char *s, unsigned *first, unsigned *last) {
+	char	*e;
+
+	*first = *last = strtoul(s, &e, 0);
+	if (e == s)
+		return 0;
+	if (*e == '-') {
+		s = e+1;
+		*last = strtoul(s, &e, 0);
+		if (e == s)
+			return 0;
+	}
+	return !*e && *first <= *last;
+}
+
+void fontFilter(fontdata *f, int nranges, char **ranges) {
+	unsigned	*first, *last;
+	unsigned	i, j, k, n;
+	int			r;
+	fontglyph	*g;
+
+	first = xalloc(nranges * sizeof(unsigned));
+	last = xalloc(nranges * sizeof(unsigned));
+	for(r = 0; r < nranges; r++) {
+		if (!fontParseRange(ranges[r], &first[r], &last[r]))
+			fatal("Bad character range '%s'", ranges[r]);
+	}
+
+	/* Drop the characters outside the ranges and then any unused glyphs */
+	for(i = 0, n = 0; i < f->nglyphs; i++) {
+		g = &f->glyphs[i];
+		for(j = 0, k = 0; j < g->nchars; j++) {
+			for(r = 0; r < nranges; r++) {
+				if (g->chars[j] >= first[r] && g->chars[j] <= last[r]) {
+					g->chars[k++] = g->chars[j];
+					break;
+				}
+			}
+		}
+		g->nchars = k;
+		if (!k) {
+			free(g->chars);
+			free(g->pixels);
+			continue;
+		}
+		f->glyphs[n++] = *g;
+	}
+	f->nglyphs = n;
+	free(first);
+	free(last);
+
+	fontCrop(f);
+}
+
+/**
+ * Group the characters of the font into ranges. Gaps of up to maxgap
+ * missing characters are kept inside a range.
+ */
+unsigned fontCharRanges(const fontdata *f, charrange **pranges, unsigned maxgap) {
+	unsigned	i, j, n, nr, *chars, t;
+	charrange	*r;
+
+	for(i = 0, n = 0; i < f->nglyphs; i++)
+		n += f->glyphs[i].nchars;
+	chars = xalloc(n * sizeof(unsigned));
+	for(i = 0, n = 0; i < f->nglyphs; i++) {
+		for(j = 0; j < f->glyphs[i].nchars; j++)
+			chars[n++] = f->glyphs[i].chars[j];
+	}
+
+	/* Insertion sort - fonts are small and mostly already in order */
+	for(i = 1; i < n; i++) {
+		t = chars[i];
+		for(j = i; j && chars[j-1] > t; j--)
+			chars[j] = chars[j-1];
+		chars[j] = t;
+	}
+
+	r = xalloc((n+1) * sizeof(charrange));
+	for(i = 0, nr = 0; i < n; i++) {
+		if (nr && chars[i] - (r[nr-1].first + r[nr-1].count) <= maxgap)
+			r[nr-1].count = chars[i] - r[nr-1].first + 1;
+		else {
+			r[nr].first = chars[i];
+			r[nr].count = 1;
+			nr++;
+		}
+	}
+	free(chars);
+	*pranges = r;
+	return nr;
+}
+
+/* Read a line of any length. Returns NULL at the end of the file. */
+static char *readline(FILE *fp) {
+	static char		*buf;
+	static size_t	bufsz;
+	size_t			len;
+
+	if (!buf)
+		buf = xalloc(bufsz = 4096);
+	len = 0;
+	while (fgets(buf + len, bufsz - len, fp)) {
+		len += strlen(buf + len);
+		if (len && buf[len-1] == '\n') {
+			buf[--len] = 0;
+			if (len && buf[len-1] == '\r')
+				buf[--len] = 0;
+			return buf;
+		}
+		buf = xrealloc(buf, bufsz *= 2);
+	}
+	return len ? buf : 0;
+}
+
+static uint8_t *readPixels(const char *hex, unsigned sz, const char *fname) {
+	uint8_t		*p;
+	unsigned	i;
+
+	if (strlen(hex) != sz)
+		fatal("%s: Bad pixel data length", fname);
+	p = xalloc(sz);
+	for(i = 0; i < sz; i++) {
+		if (!isxdigit((unsigned char)hex[i]))
+			fatal("%s: Bad pixel data", fname);
+		p[i] = isdigit((unsigned char)hex[i]) ? hex[i] - '0' : (toupper((unsigned char)hex[i]) - 'A' + 10);
+	}
+	return p;
+}
+
+fontdata *fontLoad(const char *fname) {
+	FILE		*fp;
+	fontdata	*f;
+	fontglyph	*g;
+	fontdict	*d;
+	char		*line, *p, *chars;
+	uint8_t		*px;
+	unsigned	ch, sz;
+	int			width;
+
+	if (!(fp = fopen(fname, "r")))
+		fatal("Can't open %s", fname);
+	f = fontNew();
+	sz = 0;
+
+	while ((line = readline(fp))) {
+		if ((p = strchr(line, ' ')))
+			*p++ = 0;
+		else
+			p = line + strlen(line);
+
+		if (!strcmp(line, "Version")) {
+			if (atoi(p) != 1)
+				fatal("%s: Unsupported version", fname);
+		} else if (!strcmp(line, "FontName")) {
+			sprintf(f->name, "%.255s", p);
+		} else if (!strcmp(line, "MaxWidth")) {
+			f->maxwidth = atoi(p);
+		} else if (!strcmp(line, "MaxHeight")) {
+			f->maxheight = atoi(p);
+		} else if (!strcmp(line, "BaselineX")) {
+			f->baselinex = atoi(p);
+		} else if (!strcmp(line, "BaselineY")) {
+			f->baseliney = atoi(p);
+		} else if (!strcmp(line, "LineHeight")) {
+			f->lineheight = atoi(p);
+		} else if (!strcmp(line, "Flags")) {
+			f->flags = atoi(p);
+		} else if (!strcmp(line, "RandomSeed")) {
+			f->seed = strtoul(p, 0, 0);
+		} else if (!strcmp(line, "DictEntry")) {
+			if (f->ndict >= DICT_MAX)
+				fatal("%s: Too many dictionary entries", fname);
+			d = &f->dict[f->ndict];
+			d->score = strtoul(p, &p, 10);
+			d->refencode = strtoul(p, &p, 10);
+			while (*p == ' ') p++;
+			d->len = strlen(p);
+			if (!d->len)
+				fatal("%s: Empty dictionary entry", fname);
+			d->pixels = readPixels(p, d->len, fname);
+			f->ndict++;
+		} else if (!strcmp(line, "Glyph")) {
+			if (!sz && !(sz = f->maxwidth * f->maxheight))
+				fatal("%s: Glyph before the font size", fname);
+			chars = p;
+			if (!(p = strchr(p, ' ')))
+				fatal("%s: Bad glyph", fname);
+			*p++ = 0;
+			width = strtol(p, &p, 10);
+			while (*p == ' ') p++;
+			g = 0;
+			px = readPixels(p, sz, fname);
+			for(; *chars; chars++) {
+				ch = strtoul(chars, &chars, 0);
+				if (!g)
+					g = fontAddGlyph(f, ch, width, px);
+				else {
+					g->chars = xrealloc(g->chars, (g->nchars+1) * sizeof(uint16_t));
+					g->chars[g->nchars++] = ch;
+				}
+				if (*chars != ',')
+					break;
+			}
+		} else if (*line)
+			fatal("%s: Unknown line '%s'", fname, line);
+	}
+	fclose(fp);
+	return f;
+}
+
+static void writePixels(FILE *fp, const uint8_t *p, unsigned sz) {
+	while (sz--)
+		fputc("0123456789abcdef"[*p++ & 15], fp);
+	fputc('\n', fp);
+}
+
+void fontSave(const fontdata *f, const char *fname) {
+	FILE		*fp;
+	unsigned	i, j;
+
+	if (!(fp = fopen(fname, "w")))
+		fatal("Can't create %s", fname);
+	fprintf(fp, "Version 1\n");
+	fprintf(fp, "FontName %s\n", f->name);
+	fprintf(fp, "MaxWidth %d\n", f->maxwidth);
+	fprintf(fp, "MaxHeight %d\n", f->maxheight);
+	fprintf(fp, "BaselineX %d\n", f->baselinex);
+	fprintf(fp, "BaselineY %d\n", f->baseliney);
+	fprintf(fp, "LineHeight %d\n", f->lineheight);
+	fprintf(fp, "Flags %d\n", f->flags);
+	fprintf(fp, "RandomSeed %u\n", f->seed);
+	for(i = 0; i < f->ndict; i++) {
+		fprintf(fp, "DictEntry %u %d ", f->dict[i].score, f->dict[i].refencode);
+		writePixels(fp, f->dict[i].pixels, f->dict[i].len);
+	}
+	for(i = 0; i < f->nglyphs; i++) {
+		fprintf(fp, "Glyph ");
+		for(j = 0; j < f->glyphs[i].nchars; j++)
+			fprintf(fp, j ? ",%u" : "%u", f->glyphs[i].chars[j]);
+		fprintf(fp, " %d ", f->glyphs[i].width);
+		writePixels(fp, f->glyphs[i].pixels, f->maxwidth * f->maxheight);
+	}
+	if (ferror(fp) | fclose(fp))
+		fatal("Error writing %s", fname);
+}
@@ -0,0 +1,450 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * Write fonts as C source in the format of the files in src/gdisp/fonts
+ */
+
+#include <string.h>
+#include "mcufont.h"
+
+/* Keep missing characters inside a range if that is cheaper than starting a new range */
+#define RLEFONT_MAX_GAP		5
+#define BWFONT_MAX_GAP		6
+
+/* Fonts with at least this many ranges get a direct lookup table for characters 0-255 */
+#define LOOKUP_MIN_RANGES	3
+#define LOOKUP_NONE			0xFF
+
+static FILE *openOutput(const char *fname) {
+	FILE	*fp;
+
+	if (!(fp = fopen(fname, "w")))
+		fatal("Can't create %s", fname);
+	return fp;
+}
+
+static void closeOutput(FILE *fp, const char *fname) {
+	if (ferror(fp) | fclose(fp))
+		fatal("Error writing %s", fname);
+}
+
+static void writeBytes(FILE *fp, const char *kind, const char *name, const char *what, unsigned idx, const uint8_t *data, unsigned n) {
+	unsigned	i;
+
+	if (idx == (unsigned)-1)
+		fprintf(fp, "static const uint8_t mf_%s_%s_%s[%u] = {\n", kind, name, what, n ? n : 1);
+	else
+		fprintf(fp, "static const uint8_t mf_%s_%s_%s_%u[%u] = {\n", kind, name, what, idx, n ? n : 1);
+	for(i = 0; i < n; i++)
+		fprintf(fp, "%s0x%02x, %s", i % 16 ? "" : "    ", data[i], i % 16 == 15 || i == n-1 ? "\n" : "");
+	if (!n)
+		fprintf(fp, "    0x00,\n");
+	fprintf(fp, "};\n\n");
+}
+
+static void writeWords(FILE *fp, const char *kind, const char *name, const char *what, unsigned idx, const uint16_t *data, unsigned n) {
+	unsigned	i;
+
+	if (idx == (unsigned)-1)
+		fprintf(fp, "static const uint16_t mf_%s_%s_%s[%u] = {\n", kind, name, what, n);
+	else
+		fprintf(fp, "static const uint16_t mf_%s_%s_%s_%u[%u] = {\n", kind, name, what, idx, n);
+	for(i = 0; i < n; i++)
+		fprintf(fp, "%s0x%04x, %s", i % 8 ? "" : "    ", data[i], i % 8 == 7 || i == n-1 ? "\n" : "");
+	fprintf(fp, "};\n\n");
+}
+
+static void writeStart(FILE *fp, const char *kind, const char *KIND, const char *name) {
+	fprintf(fp, "\n\n/* Start of automatically generated font definition for %s. */\n\n", name);
+	fprintf(fp, "#ifndef MF_%s_INTERNALS\n", KIND);
+	fprintf(fp, "#define MF_%s_INTERNALS\n", KIND);
+	fprintf(fp, "#endif\n");
+	fprintf(fp, "#include \"mf_%s.h\"\n\n", kind);
+	fprintf(fp, "#ifndef MF_%s_VERSION_4_SUPPORTED\n", KIND);
+	fprintf(fp, "#error The font file is not compatible with this version of mcufont.\n");
+	fprintf(fp, "#endif\n\n");
+}
+
+static void writeFontStruct(FILE *fp, fontdata *f, const char *kind, const char *name, int bw) {
+	unsigned	i;
+	int			minadv, maxadv;
+
+	fontSetFlags(f);
+	if (bw)
+		f->flags |= FLAG_BW;
+	minadv = 255;
+	maxadv = 0;
+	for(i = 0; i < f->nglyphs; i++) {
+		if (f->glyphs[i].width < minadv) minadv = f->glyphs[i].width;
+		if (f->glyphs[i].width > maxadv) maxadv = f->glyphs[i].width;
+	}
+
+	fprintf(fp, "const struct mf_%s_s mf_%s_%s = {\n", kind, kind, name);
+	fprintf(fp, "    {\n");
+	fprintf(fp, "    \"%s\",\n", f->name);
+	fprintf(fp, "    \"%s\",\n", name);
+	fprintf(fp, "    %d, /* width */\n", f->maxwidth);
+	fprintf(fp, "    %d, /* height */\n", f->maxheight);
+	fprintf(fp, "    %d, /* min x advance */\n", minadv);
+	fprintf(fp, "    %d, /* max x advance */\n", maxadv);
+	fprintf(fp, "    %d, /* baseline x */\n", f->baselinex);
+	fprintf(fp, "    %d, /* baseline y */\n", f->baseliney);
+	fprintf(fp, "    %d, /* line height */\n", f->lineheight);
+	fprintf(fp, "    %d, /* flags */\n", f->flags);
+	fprintf(fp, "    %d, /* fallback character */\n", FALLBACK_CHAR);
+	fprintf(fp, "    &mf_%s_character_width,\n", kind);
+	fprintf(fp, "    &mf_%s_render_character,\n", kind);
+	fprintf(fp, "    },\n");
+	fprintf(fp, "    4, /* version */\n");
+}
+
+static void writeEnd(FILE *fp, const char *kind, const char *name) {
+	fprintf(fp, "#ifdef MF_INCLUDED_FONTS\n");
+	fprintf(fp, "/* List entry for searching fonts by name. */\n");
+	fprintf(fp, "static const struct mf_font_list_s mf_%s_%s_listentry = {\n", kind, name);
+	fprintf(fp, "    MF_INCLUDED_FONTS,\n");
+	fprintf(fp, "    (struct mf_font_s*)&mf_%s_%s\n", kind, name);
+	fprintf(fp, "};\n");
+	fprintf(fp, "#undef MF_INCLUDED_FONTS\n");
+	fprintf(fp, "#define MF_INCLUDED_FONTS (&mf_%s_%s_listentry)\n", kind, name);
+	fprintf(fp, "#endif\n\n\n");
+	fprintf(fp, "/* End of automatically generated font definition for %s. */\n\n", name);
+}
+
+static void checkFontSize(const fontdata *f) {
+	if (!f->nglyphs)
+		fatal("The font has no glyphs");
+	if (f->maxwidth > 255 || f->maxheight > 255 || f->baselinex > 255 || f->baseliney > 255 || f->lineheight > 255)
+		fatal("The font is too big - filter it to the characters you need first");
+}
+
+void fontFreeRanges(outrange *r, unsigned n) {
+	unsigned	i;
+
+	for(i = 0; i < n; i++) {
+		free(r[i].offsets);
+		free(r[i].widths);
+		free(r[i].data);
+	}
+	free(r);
+}
+
+/* Build the lookup table of the range holding each character 0-255. Returns NULL if it isn't worthwhile. */
+uint8_t *fontCharLookup(const outrange *r, unsigned n) {
+	uint8_t		*lookup;
+	unsigned	i, c;
+
+	if (n < LOOKUP_MIN_RANGES || r[0].first > 255)
+		return 0;
+	lookup = xalloc(256);
+	memset(lookup, LOOKUP_NONE, 256);
+	for(i = 0; i < n; i++) {
+		for(c = r[i].first; c < r[i].first + r[i].count && c < 256; c++)
+			lookup[c] = i;
+	}
+	return lookup;
+}
+
+static void writeLookup(FILE *fp, const char *kind, const char *name, const uint8_t *lookup) {
+	if (lookup)
+		fprintf(fp, "    mf_%s_%s_char_lookup, /* char lookup */\n", kind, name);
+	else
+		fprintf(fp, "    0, /* char lookup */\n");
+}
+
+/*-------------------------------------------------------------------------
+ * rlefont
+ *-----------------------------------------------------------------------*/
+
+/* Build the rlefont ranges. Characters missing inside a range use the fallback glyph. */
+outrange *rlefontRanges(fontdata *f, rlefont *r, unsigned *pn) {
+	charrange	*cr;
+	outrange	*out, *o;
+	unsigned	ncr, n, i, c, gi, *at, first;
+	int			g, fallback;
+
+	fallback = fontFindGlyph(f, FALLBACK_CHAR);
+	ncr = fontCharRanges(f, &cr, fallback < 0 ? 0 : RLEFONT_MAX_GAP);
+	out = 0;
+	n = 0;
+	at = xalloc(f->nglyphs * sizeof(unsigned));
+	for(i = 0; i < ncr; i++) {
+		for(first = cr[i].first; first < cr[i].first + cr[i].count; ) {
+			out = xrealloc(out, (n+1) * sizeof(outrange));
+			o = &out[n++];
+			memset(o, 0, sizeof(outrange));
+			o->first = first;
+			o->offsets = xalloc(cr[i].count * sizeof(uint16_t));
+			memset(at, 0xFF, f->nglyphs * sizeof(unsigned));
+			for(c = first; c < cr[i].first + cr[i].count; c++) {
+				if ((g = fontFindGlyph(f, c)) < 0)
+					g = fallback;
+				gi = g;
+
+				/* Each glyph is stored once per range - start a new range when the 16 bit offsets run out */
+				if (at[gi] == (unsigned)-1) {
+					if (o->size + r->glyphsize[gi] > 0xFFFF && o->size)
+						break;
+					at[gi] = o->size;
+					o->data = xrealloc(o->data, o->size + r->glyphsize[gi]);
+					memcpy(o->data + o->size, r->glyphdata[gi], r->glyphsize[gi]);
+					o->size += r->glyphsize[gi];
+				}
+				o->offsets[o->count++] = at[gi];
+			}
+			first = c;
+		}
+	}
+	free(at);
+	free(cr);
+	*pn = n;
+	return out;
+}
+
+void rlefontExport(fontdata *f, const char *fname) {
+	FILE		*fp;
+	char		*name;
+	rlefont		r;
+	outrange	*ranges;
+	uint8_t		*lookup;
+	unsigned	nranges, i;
+
+	checkFontSize(f);
+	rlefontEncode(f, &r);
+	ranges = rlefontRanges(f, &r, &nranges);
+	if (nranges > 255)
+		fatal("Too many character ranges");
+	lookup = fontCharLookup(ranges, nranges);
+	name = fontShortName(fname);
+
+	fp = openOutput(fname);
+	writeStart(fp, "rlefont", "RLEFONT", name);
+	writeBytes(fp, "rlefont", name, "dictionary_data", -1, r.dictdata, r.dictoffsets[r.ndict]);
+	writeWords(fp, "rlefont", name, "dictionary_offsets", -1, r.dictoffsets, r.ndict + 1);
+	for(i = 0; i < nranges; i++) {
+		writeBytes(fp, "rlefont", name, "glyph_data", i, ranges[i].data, ranges[i].size);
+		writeWords(fp, "rlefont", name, "glyph_offsets", i, ranges[i].offsets, ranges[i].count);
+	}
+	if (lookup)
+		writeBytes(fp, "rlefont", name, "char_lookup", -1, lookup, 256);
+	fprintf(fp, "static const struct mf_rlefont_char_range_s mf_rlefont_%s_char_ranges[] = {\n", name);
+	for(i = 0; i < nranges; i++)
+		fprintf(fp, "    {%u, %u, mf_rlefont_%s_glyph_offsets_%u, mf_rlefont_%s_glyph_data_%u},\n", ranges[i].first, ranges[i].count, name, i, name, i);
+	fprintf(fp, "};\n\n");
+
+	writeFontStruct(fp, f, "rlefont", name, 0);
+	fprintf(fp, "    mf_rlefont_%s_dictionary_data,\n", name);
+	fprintf(fp, "    mf_rlefont_%s_dictionary_offsets,\n", name);
+	fprintf(fp, "    %u, /* rle dict count */\n", r.nrle);
+	fprintf(fp, "    %u, /* total dict count */\n", r.ndict);
+	fprintf(fp, "    %u, /* char range count */\n", nranges);
+	fprintf(fp, "    mf_rlefont_%s_char_ranges,\n", name);
+	writeLookup(fp, "rlefont", name, lookup);
+	fprintf(fp, "};\n\n");
+	writeEnd(fp, "rlefont", name);
+	closeOutput(fp, fname);
+
+	printf("Wrote %s: %u bytes of font data\n", fname, r.size);
+	free(lookup);
+	fontFreeRanges(ranges, nranges);
+	rlefontFree(&r);
+	free(name);
+}
+
+/*-------------------------------------------------------------------------
+ * bwfont
+ *-----------------------------------------------------------------------*/
+
+/* Get the inked extent of a glyph. Returns FALSE if the glyph is empty. */
+static int glyphExtent(const fontdata *f, const fontglyph *g, int *x0, int *y0, int *x1, int *y1) {
+	int		x, y;
+
+	*x0 = *y0 = 255;
+	*x1 = *y1 = -1;
+	for(y = 0; y < f->maxheight; y++) {
+		for(x = 0; x < f->maxwidth; x++) {
+			if (g->pixels[y * f->maxwidth + x] < 8)
+				continue;
+			if (x < *x0) *x0 = x;
+			if (y < *y0) *y0 = y;
+			if (x > *x1) *x1 = x;
+			if (y > *y1) *y1 = y;
+		}
+	}
+	return *x1 >= 0;
+}
+
+outrange *bwfontRanges(fontdata *f, unsigned *pn) {
+	charrange	*cr;
+	outrange	*out, *o;
+	unsigned	ncr, i, c, cols, col;
+	int			g, x0, y0, x1, y1, minx, miny, maxx, maxy, adv, fixed, x, y;
+	uint8_t		*p;
+
+	ncr = fontCharRanges(f, &cr, BWFONT_MAX_GAP);
+	out = xalloc(ncr * sizeof(outrange));
+	for(i = 0; i < ncr; i++) {
+		o = &out[i];
+		o->first = cr[i].first;
+		o->count = cr[i].count;
+
+		/* The inked box of the whole range and whether it can be stored as fixed width */
+		minx = miny = 255;
+		maxx = maxy = -1;
+		adv = -1;
+		fixed = 1;
+		for(c = o->first; c < o->first + o->count; c++) {
+			if ((g = fontFindGlyph(f, c)) < 0) {
+				fixed = 0;
+				continue;
+			}
+			if (adv < 0)
+				adv = f->glyphs[g].width;
+			else if (adv != f->glyphs[g].width)
+				fixed = 0;
+			if (!glyphExtent(f, &f->glyphs[g], &x0, &y0, &x1, &y1))
+				continue;
+			if (x0 < minx) minx = x0;
+			if (y0 < miny) miny = y0;
+			if (x1 > maxx) maxx = x1;
+			if (y1 > maxy) maxy = y1;
+		}
+		if (maxx < 0)
+			minx = miny = 0;
+		o->offsetx = minx;
+		o->offsety = miny;
+		o->heightpixels = maxy + 1 - miny;
+		o->heightbytes = (o->heightpixels + 7) / 8;
+		/* Fixed width only pays when it is no bigger than cropping each glyph */
+		if (fixed && adv > minx && maxx < adv) {
+			for(c = o->first, cols = 0; c < o->first + o->count; c++) {
+				if (glyphExtent(f, &f->glyphs[fontFindGlyph(f, c)], &x0, &y0, &x1, &y1))
+					cols += x1 + 1 - minx;
+			}
+			if ((adv - minx) * o->count * o->heightbytes <= cols * o->heightbytes + o->count * 3 + 2)
+				o->width = adv - minx;
+		}
+
+		/* The columns */
+		if (!o->width) {
+			o->offsets = xalloc((o->count + 1) * sizeof(uint16_t));
+			o->widths = xalloc(o->count);
+		}
+		for(c = o->first, col = 0; c < o->first + o->count; c++) {
+			g = fontFindGlyph(f, c);
+			if (o->width)
+				cols = o->width;
+			else {
+				cols = 0;
+				if (g >= 0) {
+					o->widths[c - o->first] = f->glyphs[g].width;
+					if (glyphExtent(f, &f->glyphs[g], &x0, &y0, &x1, &y1))
+						cols = x1 + 1 - minx;
+				}
+				o->offsets[c - o->first] = col;
+			}
+			o->data = xrealloc(o->data, (col + cols) * o->heightbytes + 1);
+			memset(o->data + col * o->heightbytes, 0, cols * o->heightbytes);
+			for(x = 0; x < (int)cols; x++) {
+				p = o->data + (col + x) * o->heightbytes;
+				for(y = 0; y < (int)o->heightpixels; y++) {
+					if (g >= 0 && x + minx < f->maxwidth && f->glyphs[g].pixels[(y + miny) * f->maxwidth + x + minx] >= 8)
+						p[y / 8] |= 1 << (y & 7);
+				}
+			}
+			col += cols;
+			if (col > 0xFFFF)
+				fatal("Too much glyph data in one character range");
+		}
+		if (!o->width)
+			o->offsets[o->count] = col;
+		o->size = col * o->heightbytes;
+	}
+	free(cr);
+	*pn = ncr;
+	return out;
+}
+
+unsigned bwfontSize(fontdata *f) {
+	outrange	*ranges;
+	unsigned	nranges, i, sz;
+
+	ranges = bwfontRanges(f, &nranges);
+	for(i = 0, sz = 0; i < nranges; i++) {
+		sz += ranges[i].size;
+		if (!ranges[i].width)
+			sz += ranges[i].count * 3 + 2;
+	}
+	fontFreeRanges(ranges, nranges);
+	return sz;
+}
+
+void bwfontExport(fontdata *f, const char *fname) {
+	FILE		*fp;
+	char		*name;
+	outrange	*ranges, *o;
+	uint8_t		*lookup;
+	unsigned	nranges, i, sz;
+
+	checkFontSize(f);
+	ranges = bwfontRanges(f, &nranges);
+	if (nranges > 255)
+		fatal("Too many character ranges");
+	lookup = fontCharLookup(ranges, nranges);
+	name = fontShortName(fname);
+
+	fp = openOutput(fname);
+	writeStart(fp, "bwfont", "BWFONT", name);
+	for(i = 0, sz = 0; i < nranges; i++) {
+		o = &ranges[i];
+		writeBytes(fp, "bwfont", name, "glyph_data", i, o->data, o->size);
+		sz += o->size;
+		if (!o->width) {
+			writeWords(fp, "bwfont", name, "glyph_offsets", i, o->offsets, o->count + 1);
+			writeBytes(fp, "bwfont", name, "glyph_widths", i, o->widths, o->count);
+			sz += o->count * 3 + 2;
+		}
+	}
+	if (lookup)
+		writeBytes(fp, "bwfont", name, "char_lookup", -1, lookup, 256);
+	fprintf(fp, "static const struct mf_bwfont_char_range_s mf_bwfont_%s_char_ranges[] = {\n", name);
+	for(i = 0; i < nranges; i++) {
+		o = &ranges[i];
+		fprintf(fp, "    {\n");
+		fprintf(fp, "        %u, /* first char */\n", o->first);
+		fprintf(fp, "        %u, /* char count */\n", o->count);
+		fprintf(fp, "        %u, /* offset x */\n", o->offsetx);
+		fprintf(fp, "        %u, /* offset y */\n", o->offsety);
+		fprintf(fp, "        %u, /* height in bytes */\n", o->heightbytes);
+		fprintf(fp, "        %u, /* height in pixels */\n", o->heightpixels);
+		fprintf(fp, "        %u, /* width */\n", o->width);
+		if (o->width) {
+			fprintf(fp, "        0, /* glyph widths */\n");
+			fprintf(fp, "        0, /* glyph offsets */\n");
+		} else {
+			fprintf(fp, "        mf_bwfont_%s_glyph_widths_%u, /* glyph widths */\n", name, i);
+			fprintf(fp, "        mf_bwfont_%s_glyph_offsets_%u, /* glyph offsets */\n", name, i);
+		}
+		fprintf(fp, "        mf_bwfont_%s_glyph_data_%u, /* glyph data */\n", name, i);
+		fprintf(fp, "    },\n");
+	}
+	fprintf(fp, "};\n\n");
+
+	writeFontStruct(fp, f, "bwfont", name, 1);
+	fprintf(fp, "    %u, /* char range count */\n", nranges);
+	fprintf(fp, "    mf_bwfont_%s_char_ranges,\n", name);
+	writeLookup(fp, "bwfont", name, lookup);
+	fprintf(fp, "};\n\n");
+	writeEnd(fp, "bwfont", name);
+	closeOutput(fp, fname);
+
+	printf("Wrote %s: %u bytes of font data\n", fname, sz);
+	free(lookup);
+	fontFreeRanges(ranges, nranges);
+	free(name);
+}
@@ -0,0 +1,29 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * Just enough of the uGFX configuration to build the mcufont decoders
+ * from src/gdisp/mcufont into the font compiler for its speed report.
+ */
+#ifndef _GFX_H
+#define _GFX_H
+
+#include <stdint.h>
+
+#ifndef FALSE
+	#define FALSE		0
+#endif
+#ifndef TRUE
+	#define TRUE		(-1)
+#endif
+
+#define GFX_USE_GDISP				TRUE
+#define GDISP_NEED_TEXT				TRUE
+#define GDISP_NEED_UTF8				TRUE
+#define GDISP_NEED_TEXT_KERNING		FALSE
+
+#endif /* _GFX_H */
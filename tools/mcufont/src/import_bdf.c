@@ -0,0 +1,155 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * Import a BDF (Glyph Bitmap Distribution Format) font.
+ */
+
+#include <string.h>
+#include "mcufont.h"
+
+#define MAX_LINE	1024
+
+typedef struct bdfchar {
+	int			encoding;
+	int			dwidth;
+	int			w, h, xo, yo;			// The BBX
+	uint8_t *	bits;					// h rows of (w+7)/8 bytes
+	} bdfchar;
+
+static int hexval(int c) {
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+static int startsWith(const char *line, const char *key) {
+	size_t	len;
+
+	len = strlen(key);
+	return !strncmp(line, key, len) && (!line[len] || line[len] == ' ' || line[len] == '\t' || line[len] == '\n' || line[len] == '\r');
+}
+
+fontdata *importBDF(const char *fname) {
+	FILE		*fp;
+	fontdata	*f;
+	bdfchar		*chars, *c;
+	unsigned	nchars, i;
+	char		line[MAX_LINE], *p;
+	int			fbw, fbh, fbx, fby, ascent, descent;
+	int			left, right, top, bottom, row, x, y, bpr, hi, lo;
+	uint8_t		*px;
+
+	if (!(fp = fopen(fname, "r")))
+		fatal("Can't open %s", fname);
+
+	f = fontNew();
+	chars = 0;
+	nchars = 0;
+	c = 0;
+	row = -1;
+	fbw = fbh = fbx = fby = 0;
+	ascent = descent = -1;
+
+	while (fgets(line, sizeof(line), fp)) {
+		if ((p = strpbrk(line, "\r\n")))
+			*p = 0;
+
+		/* Bitmap rows */
+		if (row >= 0 && c) {
+			if (startsWith(line, "ENDCHAR")) {
+				row = -1;
+				continue;
+			}
+			if (row < c->h) {
+				bpr = (c->w + 7) / 8;
+				for(x = 0; x < bpr && (hi = hexval(line[x*2])) >= 0 && (lo = hexval(line[x*2+1])) >= 0; x++)
+					c->bits[row * bpr + x] = (hi << 4) | lo;
+				row++;
+			}
+			continue;
+		}
+
+		if (startsWith(line, "FONT")) {
+			for(p = line+4; *p == ' '; p++);
+			sprintf(f->name, "%.255s", p);
+		} else if (startsWith(line, "FONTBOUNDINGBOX")) {
+			sscanf(line+15, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+		} else if (startsWith(line, "FONT_ASCENT")) {
+			ascent = atoi(line+11);
+		} else if (startsWith(line, "FONT_DESCENT")) {
+			descent = atoi(line+12);
+		} else if (startsWith(line, "STARTCHAR")) {
+			if (!(nchars & 255))
+				chars = xrealloc(chars, (nchars+256) * sizeof(bdfchar));
+			c = &chars[nchars++];
+			memset(c, 0, sizeof(bdfchar));
+			c->encoding = -1;
+		} else if (c && startsWith(line, "ENCODING")) {
+			c->encoding = atoi(line+8);
+		} else if (c && startsWith(line, "DWIDTH")) {
+			c->dwidth = atoi(line+6);
+		} else if (c && startsWith(line, "BBX")) {
+			sscanf(line+3, "%d %d %d %d", &c->w, &c->h, &c->xo, &c->yo);
+			if (c->w < 0 || c->h < 0 || c->w > 255 || c->h > 255)
+				fatal("%s: Bad character size", fname);
+		} else if (c && startsWith(line, "BITMAP")) {
+			c->bits = xalloc(c->h * ((c->w + 7) / 8));
+			row = 0;
+		}
+	}
+	fclose(fp);
+
+	if (!fbh)
+		fatal("%s: Not a BDF font", fname);
+
+	/* The glyph box is the font bounding box extended to fit every character */
+	left = fbx < 0 ? fbx : 0;
+	right = fbx + fbw;
+	top = fby + fbh;
+	bottom = fby;
+	for(i = 0; i < nchars; i++) {
+		c = &chars[i];
+		if (c->encoding < 0 || c->encoding > 0xFFFF || !c->bits)
+			continue;
+		if (c->xo < left) left = c->xo;
+		if (c->xo + c->w > right) right = c->xo + c->w;
+		if (c->yo + c->h > top) top = c->yo + c->h;
+		if (c->yo < bottom) bottom = c->yo;
+	}
+	f->maxwidth = right - left;
+	f->maxheight = top - bottom;
+	f->baselinex = -left;
+	f->baseliney = top;
+	f->lineheight = ascent >= 0 && descent >= 0 ? ascent + descent : fbh;
+	if (f->maxwidth < 1 || f->maxheight < 1 || f->maxwidth > 255 || f->maxheight > 255)
+		fatal("%s: Bad font size", fname);
+
+	for(i = 0; i < nchars; i++) {
+		c = &chars[i];
+		if (c->encoding < 0 || c->encoding > 0xFFFF || !c->bits) {
+			free(c->bits);
+			continue;
+		}
+		px = xalloc(f->maxwidth * f->maxheight);
+		bpr = (c->w + 7) / 8;
+		for(y = 0; y < c->h; y++) {
+			for(x = 0; x < c->w; x++) {
+				if (c->bits[y * bpr + x / 8] & (0x80 >> (x & 7)))
+					px[(top - c->yo - c->h + y) * f->maxwidth + c->xo - left + x] = 15;
+			}
+		}
+		free(c->bits);
+		fontAddGlyph(f, c->encoding, c->dwidth, px);
+	}
+	free(chars);
+
+	fontSetFlags(f);
+	fontCrop(f);
+	return f;
+}
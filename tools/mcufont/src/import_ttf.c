@@ -0,0 +1,762 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * Import a TrueType font by rasterizing its outlines at a given pixel size.
+ *
+ * Only what is needed to render the glyph outlines is read from the font:
+ * the head, maxp, hhea, hmtx, cmap (formats 4 and 12), loca, glyf and name tables.
+ * Hinting instructions are ignored. Instead the descender, x-height and cap
+ * height are snapped to whole pixels which keeps the baseline and the tops
+ * of the letters crisp. Coverage is computed exactly using a
+ * signed area accumulation buffer and then quantized to the 16 alpha levels
+ * of an antialiased font, or thresholded for a black and white font.
+ */
+
+#include <string.h>
+#include <math.h>
+#include "mcufont.h"
+
+#define MAX_COMPOSITE_DEPTH	8
+
+/* Black and white dropout control - see thresholdBW() */
+#define DROPOUT_MIN			0.05f
+#define DROPOUT_KEEP		0.2f
+
+typedef struct ttfont {
+	const uint8_t *	data;
+	size_t			size;
+	size_t			head, maxp, hhea, hmtx, cmap, loca, glyf, name;
+	size_t			cmapsub;				// The chosen cmap sub-table
+	unsigned		unitsPerEm;
+	unsigned		numGlyphs;
+	unsigned		numHMetrics;
+	int				longLoca;
+	} ttfont;
+
+/* A flattened outline */
+typedef struct outline {
+	float *			pts;					// x,y pairs in pixels
+	unsigned		npts, maxpts;
+	unsigned *		ends;					// The index after the last point of each contour
+	unsigned		ncontours, maxcontours;
+	} outline;
+
+/* The scaling from font units to pixels */
+typedef struct ttscale {
+	float			scale;
+	float			fy[4], py[4];			// Font unit heights and the whole pixel heights they snap to
+	int				n;
+	} ttscale;
+
+/* The raw on/off curve points of a glyph in font units */
+typedef struct ttpoint {
+	float			x, y;
+	int				on;
+	} ttpoint;
+
+typedef struct ttshape {
+	ttpoint *		pts;
+	unsigned		npts;
+	unsigned *		ends;
+	unsigned		ncontours;
+	} ttshape;
+
+/*-------------------------------------------------------------------------
+ * Table access
+ *-----------------------------------------------------------------------*/
+
+static unsigned u8(const ttfont *t, size_t o) {
+	if (o >= t->size) fatal("Truncated TrueType font");
+	return t->data[o];
+}
+static unsigned u16(const ttfont *t, size_t o) {
+	return (u8(t, o) << 8) | u8(t, o+1);
+}
+static int s16(const ttfont *t, size_t o) {
+	return (int16_t)u16(t, o);
+}
+static uint32_t u32(const ttfont *t, size_t o) {
+	return ((uint32_t)u16(t, o) << 16) | u16(t, o+2);
+}
+
+static size_t findTable(const ttfont *t, const char *tag, int required) {
+	unsigned	i, n;
+
+	n = u16(t, 4);
+	for(i = 0; i < n; i++) {
+		if (!memcmp(t->data + 12 + i * 16, tag, 4))
+			return u32(t, 12 + i * 16 + 8);
+	}
+	if (required)
+		fatal("TrueType font has no %s table", tag);
+	return 0;
+}
+
+static void ttOpen(ttfont *t) {
+	unsigned	i, n, plat, enc, fmt;
+	size_t		sub;
+	int			best, score;
+
+	if (t->size < 12 || (u32(t, 0) != 0x00010000 && memcmp(t->data, "true", 4)))
+		fatal("Not a TrueType outline font");
+	t->head = findTable(t, "head", 1);
+	t->maxp = findTable(t, "maxp", 1);
+	t->hhea = findTable(t, "hhea", 1);
+	t->hmtx = findTable(t, "hmtx", 1);
+	t->cmap = findTable(t, "cmap", 1);
+	t->loca = findTable(t, "loca", 1);
+	t->glyf = findTable(t, "glyf", 1);
+	t->name = findTable(t, "name", 0);
+
+	t->unitsPerEm = u16(t, t->head + 18);
+	t->longLoca = s16(t, t->head + 50);
+	t->numGlyphs = u16(t, t->maxp + 4);
+	t->numHMetrics = u16(t, t->hhea + 34);
+	if (!t->unitsPerEm || !t->numHMetrics)
+		fatal("Bad TrueType font header");
+
+	/* Prefer a full unicode (format 12) cmap, then a BMP unicode (format 4) one */
+	best = 0;
+	n = u16(t, t->cmap + 2);
+	for(i = 0; i < n; i++) {
+		plat = u16(t, t->cmap + 4 + i * 8);
+		enc = u16(t, t->cmap + 4 + i * 8 + 2);
+		sub = t->cmap + u32(t, t->cmap + 4 + i * 8 + 4);
+		fmt = u16(t, sub);
+		score = 0;
+		if (fmt == 12 && (plat == 0 || (plat == 3 && enc == 10)))
+			score = 3;
+		else if (fmt == 4 && (plat == 0 || (plat == 3 && enc == 1)))
+			score = 2;
+		else if (fmt == 4 && plat == 3 && enc == 0)
+			score = 1;
+		if (score > best) {
+			best = score;
+			t->cmapsub = sub;
+		}
+	}
+	if (!best)
+		fatal("TrueType font has no unicode character map");
+}
+
+/* Map a character to a glyph index. Returns 0 (the missing glyph) if it isn't there. */
+static unsigned ttGlyphIndex(const ttfont *t, unsigned ch) {
+	size_t		s, ends, starts, deltas, ranges;
+	unsigned	segs, i, lo, hi, start, end, ro, g;
+
+	s = t->cmapsub;
+	if (u16(t, s) == 12) {
+		lo = 0;
+		hi = u32(t, s + 12);
+		while (lo < hi) {
+			i = (lo + hi) / 2;
+			start = u32(t, s + 16 + i * 12);
+			end = u32(t, s + 16 + i * 12 + 4);
+			if (ch < start)
+				hi = i;
+			else if (ch > end)
+				lo = i + 1;
+			else
+				return u32(t, s + 16 + i * 12 + 8) + ch - start;
+		}
+		return 0;
+	}
+
+	/* Format 4 */
+	if (ch > 0xFFFF)
+		return 0;
+	segs = u16(t, s + 6) / 2;
+	ends = s + 14;
+	starts = ends + segs * 2 + 2;
+	deltas = starts + segs * 2;
+	ranges = deltas + segs * 2;
+	for(i = 0; i < segs; i++) {
+		if (ch > u16(t, ends + i * 2))
+			continue;
+		start = u16(t, starts + i * 2);
+		if (ch < start)
+			return 0;
+		ro = u16(t, ranges + i * 2);
+		if (!ro)
+			return (ch + u16(t, deltas + i * 2)) & 0xFFFF;
+		g = u16(t, ranges + i * 2 + ro + (ch - start) * 2);
+		return g ? (g + u16(t, deltas + i * 2)) & 0xFFFF : 0;
+	}
+	return 0;
+}
+
+static unsigned ttAdvance(const ttfont *t, unsigned gi) {
+	if (gi >= t->numHMetrics)
+		gi = t->numHMetrics - 1;
+	return u16(t, t->hmtx + gi * 4);
+}
+
+/* Get a name table string (converted to ASCII). Returns 0 if it isn't there. */
+static int ttName(const ttfont *t, unsigned id, char *buf, size_t bufsz) {
+	unsigned	i, n, plat, len, j, k;
+	size_t		strs, o;
+
+	if (!t->name)
+		return 0;
+	n = u16(t, t->name + 2);
+	strs = t->name + u16(t, t->name + 4);
+	for(i = 0; i < n; i++) {
+		o = t->name + 6 + i * 12;
+		plat = u16(t, o);
+		if (u16(t, o + 6) != id || (plat != 1 && plat != 3))
+			continue;
+		len = u16(t, o + 8);
+		o = strs + u16(t, o + 10);
+		for(j = k = 0; j < len && k < bufsz-1; j += plat == 3 ? 2 : 1) {
+			if (plat == 3)
+				buf[k++] = u16(t, o + j) < 128 ? u16(t, o + j) : '?';
+			else
+				buf[k++] = u8(t, o + j) < 128 ? u8(t, o + j) : '?';
+		}
+		buf[k] = 0;
+		return 1;
+	}
+	return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Glyph outlines
+ *-----------------------------------------------------------------------*/
+
+static void shapeFree(ttshape *s) {
+	free(s->pts);
+	free(s->ends);
+	memset(s, 0, sizeof(ttshape));
+}
+
+static void ttLoadShape(const ttfont *t, unsigned gi, ttshape *s, int depth);
+
+static void ttLoadSimple(const ttfont *t, size_t g, int ncontours, ttshape *s) {
+	unsigned	i, n, flag, rep;
+	uint8_t		*flags;
+	size_t		p;
+	int			v;
+
+	s->ncontours = ncontours;
+	s->ends = xalloc(ncontours * sizeof(unsigned));
+	for(i = 0, n = 0; i < (unsigned)ncontours; i++) {
+		s->ends[i] = u16(t, g + 10 + i * 2) + 1;
+		if (s->ends[i] < n)
+			fatal("Bad TrueType glyph contour");
+		n = s->ends[i];
+	}
+	s->npts = n;
+	s->pts = xalloc(n * sizeof(ttpoint));
+	flags = xalloc(n);
+
+	p = g + 10 + ncontours * 2;
+	p += 2 + u16(t, p);						// Skip the instructions
+	for(i = 0; i < n; ) {
+		flag = u8(t, p++);
+		flags[i++] = flag;
+		if (flag & 0x08) {
+			for(rep = u8(t, p++); rep && i < n; rep--)
+				flags[i++] = flag;
+		}
+	}
+	for(i = 0, v = 0; i < n; i++) {
+		if (flags[i] & 0x02) {
+			v += flags[i] & 0x10 ? (int)u8(t, p) : -(int)u8(t, p);
+			p++;
+		} else if (!(flags[i] & 0x10)) {
+			v += s16(t, p);
+			p += 2;
+		}
+		s->pts[i].x = v;
+		s->pts[i].on = flags[i] & 0x01;
+	}
+	for(i = 0, v = 0; i < n; i++) {
+		if (flags[i] & 0x04) {
+			v += flags[i] & 0x20 ? (int)u8(t, p) : -(int)u8(t, p);
+			p++;
+		} else if (!(flags[i] & 0x20)) {
+			v += s16(t, p);
+			p += 2;
+		}
+		s->pts[i].y = v;
+	}
+	free(flags);
+}
+
+static void ttLoadComposite(const ttfont *t, size_t g, ttshape *s, int depth) {
+	unsigned	flags, gi, i;
+	size_t		p;
+	float		dx, dy, a, b, c, d, x, y;
+	ttshape		cs;
+
+	p = g + 10;
+	do {
+		flags = u16(t, p);
+		gi = u16(t, p + 2);
+		p += 4;
+		if (flags & 0x0001) {
+			dx = s16(t, p); dy = s16(t, p + 2);
+			p += 4;
+		} else {
+			dx = (int8_t)u8(t, p); dy = (int8_t)u8(t, p + 1);
+			p += 2;
+		}
+		if (!(flags & 0x0002))
+			dx = dy = 0;						// Point matching is not supported
+		a = d = 1; b = c = 0;
+		if (flags & 0x0008) {
+			a = d = s16(t, p) / 16384.0f;
+			p += 2;
+		} else if (flags & 0x0040) {
+			a = s16(t, p) / 16384.0f; d = s16(t, p + 2) / 16384.0f;
+			p += 4;
+		} else if (flags & 0x0080) {
+			a = s16(t, p) / 16384.0f; b = s16(t, p + 2) / 16384.0f;
+			c = s16(t, p + 4) / 16384.0f; d = s16(t, p + 6) / 16384.0f;
+			p += 8;
+		}
+
+		memset(&cs, 0, sizeof(cs));
+		ttLoadShape(t, gi, &cs, depth + 1);
+		if (cs.npts) {
+			s->pts = xrealloc(s->pts, (s->npts + cs.npts) * sizeof(ttpoint));
+			s->ends = xrealloc(s->ends, (s->ncontours + cs.ncontours) * sizeof(unsigned));
+			for(i = 0; i < cs.npts; i++) {
+				x = cs.pts[i].x; y = cs.pts[i].y;
+				s->pts[s->npts + i].x = a * x + c * y + dx;
+				s->pts[s->npts + i].y = b * x + d * y + dy;
+				s->pts[s->npts + i].on = cs.pts[i].on;
+			}
+			for(i = 0; i < cs.ncontours; i++)
+				s->ends[s->ncontours + i] = s->npts + cs.ends[i];
+			s->npts += cs.npts;
+			s->ncontours += cs.ncontours;
+		}
+		shapeFree(&cs);
+	} while (flags & 0x0020);
+}
+
+/* Find a glyph in the glyf table. Returns 0 for an empty glyph eg. space */
+static size_t ttGlyph(const ttfont *t, unsigned gi) {
+	size_t	g, next;
+
+	if (gi >= t->numGlyphs)
+		return 0;
+	if (t->longLoca) {
+		g = u32(t, t->loca + gi * 4);
+		next = u32(t, t->loca + gi * 4 + 4);
+	} else {
+		g = u16(t, t->loca + gi * 2) * 2;
+		next = u16(t, t->loca + gi * 2 + 2) * 2;
+	}
+	return g == next ? 0 : t->glyf + g;
+}
+
+static void ttLoadShape(const ttfont *t, unsigned gi, ttshape *s, int depth) {
+	size_t	g;
+	int		ncontours;
+
+	if (depth > MAX_COMPOSITE_DEPTH || !(g = ttGlyph(t, gi)))
+		return;
+
+	ncontours = s16(t, g);
+	if (ncontours > 0)
+		ttLoadSimple(t, g, ncontours, s);
+	else if (ncontours < 0)
+		ttLoadComposite(t, g, s, depth);
+}
+
+/*-------------------------------------------------------------------------
+ * Scaling
+ *-----------------------------------------------------------------------*/
+
+/* Add a height to snap to. The heights must be added from the bottom up. */
+static void scaleSnap(const ttfont *t, ttscale *sc, unsigned ch, int top) {
+	size_t	g;
+	float	fy, py;
+
+	if (!(g = ttGlyph(t, ttGlyphIndex(t, ch))))
+		return;
+	fy = s16(t, g + (top ? 8 : 4));
+	py = floorf(fy * sc->scale + 0.5f);
+	if (sc->n && (fy <= sc->fy[sc->n-1] || py <= sc->py[sc->n-1]))
+		return;
+	sc->fy[sc->n] = fy;
+	sc->py[sc->n] = py;
+	sc->n++;
+}
+
+static void scaleInit(const ttfont *t, ttscale *sc, int size) {
+	sc->scale = (float)size / t->unitsPerEm;
+	sc->n = 0;
+	scaleSnap(t, sc, 'p', 0);				// The descender
+	if (sc->n && sc->fy[0] >= 0)
+		sc->n = 0;
+	sc->fy[sc->n] = sc->py[sc->n] = 0;		// The baseline
+	sc->n++;
+	scaleSnap(t, sc, 'x', 1);				// The x-height
+	scaleSnap(t, sc, 'H', 1);				// The cap height
+}
+
+/* Scale a height - piecewise linear between the snapped heights */
+static float scaleY(const ttscale *sc, float y) {
+	int		i;
+
+	if (y <= sc->fy[0])
+		return sc->py[0] + (y - sc->fy[0]) * sc->scale;
+	for(i = 1; i < sc->n; i++) {
+		if (y <= sc->fy[i])
+			return sc->py[i-1] + (y - sc->fy[i-1]) * (sc->py[i] - sc->py[i-1]) / (sc->fy[i] - sc->fy[i-1]);
+	}
+	return sc->py[sc->n-1] + (y - sc->fy[sc->n-1]) * sc->scale;
+}
+
+/*-------------------------------------------------------------------------
+ * Flattening
+ *-----------------------------------------------------------------------*/
+
+static void outlinePoint(outline *o, float x, float y) {
+	if (o->npts >= o->maxpts)
+		o->pts = xrealloc(o->pts, (o->maxpts = o->maxpts * 2 + 64) * 2 * sizeof(float));
+	o->pts[o->npts * 2] = x;
+	o->pts[o->npts * 2 + 1] = y;
+	o->npts++;
+}
+
+static void outlineQuad(outline *o, float x0, float y0, float x1, float y1, float x2, float y2) {
+	float		ddx, ddy, t;
+	unsigned	i, n;
+
+	/* Choose the number of segments so the error is well under a pixel */
+	ddx = x0 - 2 * x1 + x2;
+	ddy = y0 - 2 * y1 + y2;
+	n = 1 + (unsigned)sqrtf(sqrtf(ddx * ddx + ddy * ddy) * 4.0f);
+	if (n > 32) n = 32;
+	for(i = 1; i <= n; i++) {
+		t = (float)i / n;
+		outlinePoint(o, (1-t)*(1-t)*x0 + 2*(1-t)*t*x1 + t*t*x2, (1-t)*(1-t)*y0 + 2*(1-t)*t*y1 + t*t*y2);
+	}
+}
+
+/* Convert a shape to pixel coordinates (y down) and flatten the curves */
+static void shapeFlatten(const ttshape *s, const ttscale *sc, float ox, float oy, outline *o) {
+	unsigned	c, i, first, n, k;
+	ttpoint		*p, *q;
+	float		sx, sy, cx, cy, px, py, qx, qy;
+
+	o->npts = o->ncontours = 0;
+	for(c = 0, first = 0; c < s->ncontours; first = s->ends[c++]) {
+		n = s->ends[c] - first;
+		if (n < 2)
+			continue;
+		p = s->pts + first;
+
+		/* Start from an on curve point - or the midpoint of two off curve points */
+		for(k = 0; k < n && !p[k].on; k++);
+		if (k < n) {
+			sx = p[k].x; sy = p[k].y;
+		} else {
+			k = n-1;
+			sx = (p[0].x + p[n-1].x) / 2; sy = (p[0].y + p[n-1].y) / 2;
+		}
+		outlinePoint(o, sx * sc->scale - ox, oy - scaleY(sc, sy));
+		cx = sx; cy = sy;
+		for(i = 1; i <= n; i++) {
+			q = p + (k + i) % n;
+			if (q->on) {
+				outlinePoint(o, q->x * sc->scale - ox, oy - scaleY(sc, q->y));
+				cx = q->x; cy = q->y;
+				continue;
+			}
+			/* An off curve point - the end is the next on curve point or the implied midpoint */
+			px = q->x; py = q->y;
+			q = p + (k + i + 1) % n;
+			if (i == n) {
+				qx = sx; qy = sy;
+			} else if (q->on) {
+				qx = q->x; qy = q->y;
+				i++;
+			} else {
+				qx = (px + q->x) / 2; qy = (py + q->y) / 2;
+			}
+			outlineQuad(o, cx * sc->scale - ox, oy - scaleY(sc, cy), px * sc->scale - ox, oy - scaleY(sc, py), qx * sc->scale - ox, oy - scaleY(sc, qy));
+			cx = qx; cy = qy;
+		}
+
+		if (o->ncontours >= o->maxcontours)
+			o->ends = xrealloc(o->ends, (o->maxcontours = o->maxcontours * 2 + 16) * sizeof(unsigned));
+		o->ends[o->ncontours++] = o->npts;
+	}
+}
+
+/*-------------------------------------------------------------------------
+ * Rasterizing
+ *-----------------------------------------------------------------------*/
+
+/* Accumulate the signed area of a line into the cells it crosses */
+static void rasterLine(float *acc, int w, int h, float x0, float y0, float x1, float y1) {
+	float	dir, dxdy, x, xnext, d, dy, xa, xb, xmf, s, x0f, x1f, a0, a1, a2, am;
+	int		y, yend, x0i, x1i, xi, stride;
+	float	*row;
+
+	if (y0 == y1)
+		return;
+	dir = 1;
+	if (y0 > y1) {
+		dir = -1;
+		x = x0; x0 = x1; x1 = x;
+		x = y0; y0 = y1; y1 = x;
+	}
+	dxdy = (x1 - x0) / (y1 - y0);
+	x = x0;
+	if (y0 < 0) {
+		x -= y0 * dxdy;
+		y0 = 0;
+	}
+	if (y1 > h)
+		y1 = h;
+	stride = w + 2;
+	yend = (int)ceilf(y1);
+	for(y = (int)y0; y < yend; y++) {
+		row = acc + y * stride;
+		dy = (y + 1 < y1 ? y + 1 : y1) - (y > y0 ? y : y0);
+		xnext = x + dxdy * dy;
+		d = dy * dir;
+		if (x < xnext) {
+			xa = x; xb = xnext;
+		} else {
+			xa = xnext; xb = x;
+		}
+		if (xa < 0) xa = 0;
+		if (xb < 0) xb = 0;
+		if (xa > w) xa = w;
+		if (xb > w) xb = w;
+		x0i = (int)floorf(xa);
+		x1i = (int)ceilf(xb);
+		if (x1i <= x0i + 1) {
+			xmf = 0.5f * (xa + xb) - x0i;
+			row[x0i] += d - d * xmf;
+			row[x0i + 1] += d * xmf;
+		} else {
+			s = 1.0f / (xb - xa);
+			x0f = xa - x0i;
+			a0 = 0.5f * s * (1 - x0f) * (1 - x0f);
+			x1f = xb - x1i + 1;
+			am = 0.5f * s * x1f * x1f;
+			row[x0i] += d * a0;
+			if (x1i == x0i + 2)
+				row[x0i + 1] += d * (1 - a0 - am);
+			else {
+				a1 = s * (1.5f - x0f);
+				row[x0i + 1] += d * (a1 - a0);
+				for(xi = x0i + 2; xi < x1i - 1; xi++)
+					row[xi] += d * s;
+				a2 = a1 + (x1i - x0i - 3) * s;
+				row[x1i - 1] += d * (1 - a2 - am);
+			}
+			row[x1i] += d * am;
+		}
+		x = xnext;
+	}
+}
+
+/* Render an outline into a coverage map (0..1) of w x h pixels */
+static void rasterOutline(const outline *o, int w, int h, float *cov) {
+	float		*acc, sum, v;
+	unsigned	c, i, first;
+	int			x, y;
+
+	acc = xalloc((w + 2) * (h + 1) * sizeof(float));
+	for(c = 0, first = 0; c < o->ncontours; first = o->ends[c++]) {
+		for(i = first; i < o->ends[c]; i++) {
+			unsigned j = i + 1 < o->ends[c] ? i + 1 : first;
+			rasterLine(acc, w, h, o->pts[i*2], o->pts[i*2+1], o->pts[j*2], o->pts[j*2+1]);
+		}
+	}
+	for(y = 0; y < h; y++) {
+		for(x = 0, sum = 0; x < w; x++) {
+			sum += acc[y * (w + 2) + x];
+			v = fabsf(sum);
+			cov[y * w + x] = v > 1 ? 1 : v;
+		}
+	}
+	free(acc);
+}
+
+/**
+ * Threshold a coverage map for a black and white font.
+ * Thin strokes can cover less than half of every pixel they cross, so as in
+ * the TrueType dropout control any run of partly covered pixels across a row
+ * or column that would otherwise vanish keeps its most covered pixel.
+ */
+static void thresholdBW(const float *cov, int w, int h, uint8_t *px) {
+	int		i, x, y, n, step, len, start, best, lit;
+
+	for(i = 0; i < w * h; i++)
+		px[i] = cov[i] >= 0.5f ? 15 : 0;
+
+	/* Rows and then columns */
+	for(i = 0; i < 2; i++) {
+		n = i ? w : h;
+		len = i ? h : w;
+		step = i ? w : 1;
+		for(y = 0; y < n; y++) {
+			start = i ? y : y * w;
+			for(x = 0; x < len; ) {
+				if (cov[start + x * step] < DROPOUT_MIN) {
+					x++;
+					continue;
+				}
+				for(best = x, lit = 0; x < len && cov[start + x * step] >= DROPOUT_MIN; x++) {
+					if (px[start + x * step])
+						lit = 1;
+					if (cov[start + x * step] > cov[start + best * step])
+						best = x;
+				}
+				if (!lit && cov[start + best * step] >= DROPOUT_KEEP)
+					px[start + best * step] = 15;
+			}
+		}
+	}
+}
+
+/*-------------------------------------------------------------------------
+ * The importer
+ *-----------------------------------------------------------------------*/
+
+typedef struct ttglyph {
+	unsigned	ch;
+	int			advance;
+	int			x0, y0, w, h;				// The pixel box relative to the origin (y down)
+	uint8_t *	pixels;
+	} ttglyph;
+
+fontdata *importTTF(const char *fname, int size, int bw) {
+	FILE		*fp;
+	ttfont		t;
+	fontdata	*f;
+	ttglyph		*glyphs, *g;
+	ttshape		s;
+	outline		o;
+	ttscale		sc;
+	float		*cov, xmin, ymin, xmax, ymax;
+	unsigned	ch, gi, n, i, maxch;
+	int			x, y, left, right, top, bottom;
+	char		family[100], style[100];
+	uint8_t		*px;
+
+	if (size < 1 || size > 255)
+		fatal("Bad font size %d", size);
+
+	/* Read the whole font into memory */
+	if (!(fp = fopen(fname, "rb")))
+		fatal("Can't open %s", fname);
+	memset(&t, 0, sizeof(t));
+	fseek(fp, 0, SEEK_END);
+	t.size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	t.data = xalloc(t.size);
+	if (fread((void *)t.data, 1, t.size, fp) != t.size)
+		fatal("Can't read %s", fname);
+	fclose(fp);
+	ttOpen(&t);
+
+	f = fontNew();
+	scaleInit(&t, &sc, size);
+	if (!ttName(&t, 1, family, sizeof(family)))
+		strcpy(family, "Unknown");
+	if (!ttName(&t, 2, style, sizeof(style)))
+		strcpy(style, "Regular");
+	snprintf(f->name, sizeof(f->name), "%s %s %d", family, style, size);
+	f->lineheight = (int)floorf((s16(&t, t.hhea + 4) - s16(&t, t.hhea + 6) + s16(&t, t.hhea + 8)) * sc.scale + 0.5f);
+
+	/* Render every mapped character */
+	maxch = u16(&t, t.cmapsub) == 12 ? 0x10FFFF : 0xFFFF;
+	if (maxch > 0xFFFF)
+		maxch = 0xFFFF;						// mcufont characters are 16 bits
+	glyphs = 0;
+	n = 0;
+	memset(&o, 0, sizeof(o));
+	left = right = top = bottom = 0;
+	for(ch = 0; ch <= maxch; ch++) {
+		if (!(gi = ttGlyphIndex(&t, ch)))
+			continue;
+		if (!(n & 255))
+			glyphs = xrealloc(glyphs, (n + 256) * sizeof(ttglyph));
+		g = &glyphs[n++];
+		memset(g, 0, sizeof(ttglyph));
+		g->ch = ch;
+		g->advance = (int)floorf(ttAdvance(&t, gi) * sc.scale + 0.5f);
+
+		memset(&s, 0, sizeof(s));
+		ttLoadShape(&t, gi, &s, 0);
+		if (s.npts) {
+			xmin = xmax = s.pts[0].x;
+			ymin = ymax = s.pts[0].y;
+			for(i = 1; i < s.npts; i++) {
+				if (s.pts[i].x < xmin) xmin = s.pts[i].x;
+				if (s.pts[i].x > xmax) xmax = s.pts[i].x;
+				if (s.pts[i].y < ymin) ymin = s.pts[i].y;
+				if (s.pts[i].y > ymax) ymax = s.pts[i].y;
+			}
+			g->x0 = (int)floorf(xmin * sc.scale);
+			g->y0 = (int)floorf(-scaleY(&sc, ymax));
+			g->w = (int)ceilf(xmax * sc.scale) - g->x0;
+			g->h = (int)ceilf(-scaleY(&sc, ymin)) - g->y0;
+			if (g->w > 0 && g->h > 0 && g->w <= 255 && g->h <= 255) {
+				shapeFlatten(&s, &sc, g->x0, -g->y0, &o);
+				cov = xalloc(g->w * g->h * sizeof(float));
+				rasterOutline(&o, g->w, g->h, cov);
+				g->pixels = xalloc(g->w * g->h);
+				if (bw)
+					thresholdBW(cov, g->w, g->h, g->pixels);
+				else {
+					for(i = 0; i < (unsigned)(g->w * g->h); i++)
+						g->pixels[i] = (uint8_t)(cov[i] * 15 + 0.5f);
+				}
+				free(cov);
+			}
+		}
+		shapeFree(&s);
+		if (!g->pixels)
+			g->w = g->h = 0;
+		else {
+			if (g->x0 < left) left = g->x0;
+			if (g->x0 + g->w > right) right = g->x0 + g->w;
+			if (g->y0 < top) top = g->y0;
+			if (g->y0 + g->h > bottom) bottom = g->y0 + g->h;
+		}
+	}
+	free(o.pts);
+	free(o.ends);
+	free((void *)t.data);
+
+	/* Place every glyph in a common box */
+	f->maxwidth = right - left;
+	f->maxheight = bottom - top;
+	f->baselinex = -left;
+	f->baseliney = -top;
+	if (f->maxwidth < 1) f->maxwidth = 1;
+	if (f->maxheight < 1) f->maxheight = 1;
+	for(i = 0; i < n; i++) {
+		g = &glyphs[i];
+		px = xalloc(f->maxwidth * f->maxheight);
+		for(y = 0; y < g->h; y++) {
+			for(x = 0; x < g->w; x++)
+				px[(g->y0 - top + y) * f->maxwidth + g->x0 - left + x] = g->pixels[y * g->w + x];
+		}
+		free(g->pixels);
+		fontAddGlyph(f, g->ch, g->advance, px);
+	}
+	free(glyphs);
+
+	fontSetFlags(f);
+	if (bw)
+		f->flags |= FLAG_BW;
+	return f;
+}
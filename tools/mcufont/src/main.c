@@ -0,0 +1,171 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+#include <stdarg.h>
+#include <string.h>
+#include "mcufont.h"
+
+void *xalloc(size_t sz) {
+	void *p;
+
+	if (!(p = calloc(1, sz ? sz : 1)))
+		fatal("Out of memory");
+	return p;
+}
+
+void *xrealloc(void *p, size_t sz) {
+	if (!(p = realloc(p, sz ? sz : 1)))
+		fatal("Out of memory");
+	return p;
+}
+
+void fatal(const char *fmt, ...) {
+	va_list	ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "mcufont: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+/* A small xorshift generator so that the optimizer results are repeatable */
+unsigned rnd(unsigned *seed) {
+	unsigned	x;
+
+	x = *seed ? *seed : 1;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*seed = x;
+	return x;
+}
+
+/* Return the file name without its directory or extension */
+static char *basenameof(const char *fname) {
+	const char	*p;
+	char		*s, *e;
+
+	if ((p = strrchr(fname, '/')))
+		fname = p+1;
+	if ((p = strrchr(fname, '\\')))
+		fname = p+1;
+	s = xalloc(strlen(fname)+16);
+	strcpy(s, fname);
+	if ((e = strrchr(s, '.')))
+		*e = 0;
+	return s;
+}
+
+/* Return the dat or output file name with the extension replaced */
+static char *withext(const char *fname, const char *ext) {
+	char	*s, *e;
+
+	s = xalloc(strlen(fname)+strlen(ext)+1);
+	strcpy(s, fname);
+	if ((e = strrchr(s, '.')) && !strchr(e, '/') && !strchr(e, '\\'))
+		*e = 0;
+	strcat(s, ext);
+	return s;
+}
+
+static void usage(void) {
+	fprintf(stderr,
+		"Usage: mcufont <command> [arguments]\n"
+		"\n"
+		"Commands:\n"
+		"  import_ttf <font.ttf> <size> [bw]  Rasterize a TrueType font into <font><size>[bw].dat\n"
+		"  import_bdf <font.bdf>              Import a BDF bitmap font into <font>.dat\n"
+		"  filter <font.dat> <range> ...      Keep only the given characters eg. 32-127 0x20-0x39 65\n"
+		"  rlefont_optimize <font.dat> [n]    Run n iterations of the rlefont dictionary optimizer\n"
+		"  rlefont_export <font.dat> [out.c]  Write an antialiased or bw run length encoded font\n"
+		"  bwfont_export <font.dat> [out.c]   Write an uncompressed black and white font\n"
+		"  size <font.dat>                    Report the encoded size of each format\n"
+		"  speed <font.dat> [loops]           Report the size and decode time of each glyph\n"
+		);
+	exit(1);
+}
+
+int main(int argc, char *argv[]) {
+	fontdata	*f;
+	char		*dat;
+	rlefont		r;
+
+	if (argc < 3)
+		usage();
+
+	if (!strcmp(argv[1], "import_ttf")) {
+		if (argc < 4 || (argc > 4 && strcmp(argv[4], "bw")))
+			usage();
+		f = importTTF(argv[2], atoi(argv[3]), argc > 4);
+		dat = basenameof(argv[2]);
+		strcat(dat, argv[3]);
+		if (argc > 4)
+			strcat(dat, "bw");
+		strcat(dat, ".dat");
+		fontSave(f, dat);
+		printf("Imported %u glyphs into %s\n", f->nglyphs, dat);
+
+	} else if (!strcmp(argv[1], "import_bdf")) {
+		f = importBDF(argv[2]);
+		dat = basenameof(argv[2]);
+		strcat(dat, ".dat");
+		fontSave(f, dat);
+		printf("Imported %u glyphs into %s\n", f->nglyphs, dat);
+
+	} else if (!strcmp(argv[1], "filter")) {
+		if (argc < 4)
+			usage();
+		f = fontLoad(argv[2]);
+		fontFilter(f, argc-3, argv+3);
+		fontSave(f, argv[2]);
+		printf("%u glyphs left in %s\n", f->nglyphs, argv[2]);
+
+	} else if (!strcmp(argv[1], "rlefont_optimize")) {
+		f = fontLoad(argv[2]);
+		rlefontOptimize(f, argc > 3 ? atoi(argv[3]) : 25);
+		fontSave(f, argv[2]);
+
+	} else if (!strcmp(argv[1], "rlefont_export")) {
+		f = fontLoad(argv[2]);
+		rlefontExport(f, argc > 3 ? argv[3] : withext(argv[2], ".c"));
+
+	} else if (!strcmp(argv[1], "bwfont_export")) {
+		f = fontLoad(argv[2]);
+		bwfontExport(f, argc > 3 ? argv[3] : withext(argv[2], ".c"));
+
+	} else if (!strcmp(argv[1], "size")) {
+		f = fontLoad(argv[2]);
+		rlefontEncode(f, &r);
+		printf("Glyphs: %u, dictionary entries: %u (%u rle)\n", f->nglyphs, r.ndict, r.nrle);
+		printf("rlefont size: %u bytes\n", r.size);
+		printf("bwfont size: %u bytes\n", bwfontSize(f));
+		rlefontFree(&r);
+
+	} else if (!strcmp(argv[1], "speed")) {
+		f = fontLoad(argv[2]);
+		fontSpeed(f, argc > 3 ? atoi(argv[3]) : 1000);
+
+	} else
+		usage();
+
+	fontFree(f);
+	return 0;
+}
+
+/* Used by the exporters to name the font after the output file */
+char *fontShortName(const char *fname) {
+	char	*s, *p;
+
+	s = basenameof(fname);
+	for(p = s; *p; p++) {
+		if (!((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || (*p >= '0' && *p <= '9')))
+			*p = '_';
+	}
+	return s;
+}
@@ -0,0 +1,130 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * The mcufont font compiler.
+ *
+ * A font is held as a set of glyphs, each of which is a MaxWidth x MaxHeight
+ * array of 4 bit alpha values (0 = background, 15 = fully set), plus an
+ * optional dictionary used by the rlefont encoder. The same structure is
+ * saved to and loaded from the text based .dat files.
+ */
+#ifndef _MCUFONT_H
+#define _MCUFONT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* Font flags - these match the values in mf_font.h */
+#define FLAG_MONOSPACE		0x01
+#define FLAG_BW				0x02
+
+/* The character to use for missing glyphs */
+#define FALLBACK_CHAR		63
+
+/* The largest number of dictionary entries an rlefont can hold (256 - 24 reserved codes) */
+#define DICT_MAX			232
+
+typedef struct fontglyph {
+	uint16_t *	chars;				// The characters that use this glyph
+	unsigned	nchars;
+	int			width;				// The advance width in pixels
+	uint8_t *	pixels;				// maxwidth * maxheight alpha values (0..15)
+	} fontglyph;
+
+typedef struct fontdict {
+	uint8_t *	pixels;				// The pixel string this entry represents
+	unsigned	len;
+	int			refencode;			// TRUE to ref encode the entry, FALSE to RLE encode it
+	unsigned	score;				// How often the entry was used in the last encoding
+	} fontdict;
+
+typedef struct fontdata {
+	char		name[256];
+	int			maxwidth, maxheight;
+	int			baselinex, baseliney;
+	int			lineheight;
+	int			flags;
+	unsigned	seed;
+	fontdict	dict[DICT_MAX];
+	unsigned	ndict;
+	fontglyph *	glyphs;
+	unsigned	nglyphs;
+	} fontdata;
+
+/* An encoded rlefont */
+typedef struct rlefont {
+	unsigned	nrle;				// The number of RLE encoded dictionary entries (these come first)
+	unsigned	ndict;				// The total number of dictionary entries
+	uint8_t *	dictdata;
+	uint16_t	dictoffsets[DICT_MAX+1];
+	unsigned	nglyphs;
+	uint8_t **	glyphdata;			// Per glyph: the width byte followed by the codes
+	unsigned *	glyphsize;
+	unsigned	size;				// The total data size in bytes
+	} rlefont;
+
+/* A character range in an exported font */
+typedef struct charrange {
+	unsigned	first;
+	unsigned	count;
+	} charrange;
+
+/* A character range ready to be written */
+typedef struct outrange {
+	unsigned	first, count;
+	uint16_t *	offsets;
+	uint8_t *	widths;				// bwfont only
+	uint8_t *	data;
+	unsigned	size;
+	unsigned	offsetx, offsety;	// bwfont only
+	unsigned	heightbytes, heightpixels, width;
+	} outrange;
+
+/* Utilities - main.c */
+void *xalloc(size_t sz);
+void *xrealloc(void *p, size_t sz);
+void fatal(const char *fmt, ...);
+unsigned rnd(unsigned *seed);
+char *fontShortName(const char *fname);
+
+/* Font data - datafile.c */
+fontdata *fontNew(void);
+void fontFree(fontdata *f);
+fontglyph *fontAddGlyph(fontdata *f, unsigned ch, int width, uint8_t *pixels);
+int fontFindGlyph(const fontdata *f, unsigned ch);
+void fontCrop(fontdata *f);
+void fontSetFlags(fontdata *f);
+int fontParseRange(const char *s, unsigned *first, unsigned *last);
+void fontFilter(fontdata *f, int nranges, char **ranges);
+unsigned fontCharRanges(const fontdata *f, charrange **pranges, unsigned maxgap);
+fontdata *fontLoad(const char *fname);
+void fontSave(const fontdata *f, const char *fname);
+
+/* Importers - import_ttf.c, import_bdf.c */
+fontdata *importTTF(const char *fname, int size, int bw);
+fontdata *importBDF(const char *fname);
+
+/* The rlefont encoder - rlefont.c */
+void rlefontEncode(fontdata *f, rlefont *r);
+void rlefontFree(rlefont *r);
+void rlefontOptimize(fontdata *f, int iterations);
+
+/* Exporters - export.c */
+void rlefontExport(fontdata *f, const char *fname);
+void bwfontExport(fontdata *f, const char *fname);
+unsigned bwfontSize(fontdata *f);
+outrange *rlefontRanges(fontdata *f, rlefont *r, unsigned *pn);
+outrange *bwfontRanges(fontdata *f, unsigned *pn);
+void fontFreeRanges(outrange *r, unsigned n);
+uint8_t *fontCharLookup(const outrange *r, unsigned n);
+
+/* Size and speed reports - speed.c */
+void fontSpeed(fontdata *f, int loops);
+
+#endif /* _MCUFONT_H */
@@ -0,0 +1,513 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * The rlefont encoder and dictionary optimizer.
+ *
+ * An rlefont glyph is a string of one byte codes that each expand to a run
+ * of pixels: a single pixel of any alpha, a "fill" code holding 2 to 7 black
+ * or white pixels as bits, or a dictionary entry. Dictionary entries are either
+ * RLE encoded, or are themselves code strings (ref encoded) that may use the
+ * RLE entries. Every dictionary entry uses up one of the fill codes so the
+ * dictionary only pays for itself if its entries are used often.
+ *
+ * Glyphs and ref encoded entries are encoded optimally for a given dictionary
+ * by a shortest path search over the pixel string. The optimizer then makes
+ * random changes to the dictionary and keeps those that shrink the font.
+ * The code values must match src/gdisp/mcufont/mf_rlefont.c
+ */
+
+#include <string.h>
+#include "mcufont.h"
+
+/* Number of reserved codes before the dictionary entries. */
+#define DICT_START		24
+
+/* Special reference to mean "fill with zeros to the end of the glyph" */
+#define REF_FILLZEROS	16
+
+/* RLE codes */
+#define RLE_ZEROS		0x00
+#define RLE_64ZEROS		0x40
+#define RLE_ONES		0x80
+#define RLE_SHADE		0xC0
+
+/* Dictionary "fill entries" for encoding bits directly. */
+#define DICT_START7BIT	4
+#define DICT_START6BIT	132
+#define DICT_START5BIT	196
+#define DICT_START4BIT	228
+#define DICT_START3BIT	244
+#define DICT_START2BIT	252
+
+/* The number of random changes tried in each optimizer iteration */
+#define TRIALS_PER_ITERATION	100
+
+/* The longest random dictionary entry the optimizer will create */
+#define MAX_NEW_ENTRY			48
+
+static const uint8_t fillStart[8] = { 0, 0, DICT_START2BIT, DICT_START3BIT, DICT_START4BIT, DICT_START5BIT, DICT_START6BIT, DICT_START7BIT };
+
+/* A trie of the dictionary pixel strings so matches can be found quickly */
+typedef struct trienode {
+	int			next[16];
+	int			entry;					// The code index of the entry ending here, or -1
+	} trienode;
+
+typedef struct encoder {
+	trienode *	trie;
+	unsigned	ntrie, maxtrie;
+	unsigned	nrle, ndict;
+	int			code[DICT_MAX];			// f->dict index to code index
+	int			order[DICT_MAX];		// code index to f->dict index
+	unsigned	maxlen;
+	int *		cost;					// Per position: the fewest codes to the end
+	uint8_t *	choice;					// Per position: the code to use
+	unsigned *	next;					// Per position: the position after the code
+	unsigned *	bwrun;					// Per position: the number of following 0 or 15 pixels
+	} encoder;
+
+static void trieAdd(encoder *e, const uint8_t *px, unsigned len, int entry) {
+	int			n;
+	unsigned	i;
+
+	for(n = 0, i = 0; i < len; i++) {
+		if (e->trie[n].next[px[i]] < 0) {
+			if (e->ntrie >= e->maxtrie)
+				e->trie = xrealloc(e->trie, (e->maxtrie = e->maxtrie * 2 + 256) * sizeof(trienode));
+			memset(&e->trie[e->ntrie], 0xFF, sizeof(trienode));
+			e->trie[n].next[px[i]] = e->ntrie++;
+		}
+		n = e->trie[n].next[px[i]];
+	}
+
+	/* Identical entries can't both be reached - the first one wins */
+	if (e->trie[n].entry < 0)
+		e->trie[n].entry = entry;
+}
+
+static void encoderInit(encoder *e, fontdata *f) {
+	unsigned	i, pass;
+
+	memset(e, 0, sizeof(encoder));
+	e->maxtrie = 1024;
+	e->trie = xalloc(e->maxtrie * sizeof(trienode));
+	memset(e->trie, 0xFF, sizeof(trienode));
+	e->ntrie = 1;
+
+	/* The RLE entries get the first codes */
+	for(pass = 0; pass < 2; pass++) {
+		for(i = 0; i < f->ndict; i++) {
+			if (f->dict[i].refencode != (int)pass)
+				continue;
+			e->code[i] = e->ndict;
+			e->order[e->ndict++] = i;
+			if (!pass)
+				e->nrle++;
+			trieAdd(e, f->dict[i].pixels, f->dict[i].len, e->code[i]);
+			if (f->dict[i].len > e->maxlen)
+				e->maxlen = f->dict[i].len;
+		}
+	}
+
+	i = f->maxwidth * f->maxheight;
+	if (e->maxlen > i)
+		i = e->maxlen;
+	e->cost = xalloc((i+1) * sizeof(int));
+	e->choice = xalloc(i+1);
+	e->next = xalloc((i+1) * sizeof(unsigned));
+	e->bwrun = xalloc((i+1) * sizeof(unsigned));
+}
+
+static void encoderFree(encoder *e) {
+	free(e->trie);
+	free(e->cost);
+	free(e->choice);
+	free(e->next);
+	free(e->bwrun);
+}
+
+/* RLE encode a pixel string. Returns the number of bytes. */
+static unsigned encodeRLE(const uint8_t *px, unsigned n, uint8_t *out) {
+	unsigned	i, run, k, len;
+	uint8_t		v;
+
+	for(i = 0, len = 0; i < n; i += run) {
+		v = px[i];
+		for(run = 1; i + run < n && px[i + run] == v; run++);
+		if (!v) {
+			for(k = run; k >= 64; k -= (k / 64 > 64 ? 64 : k / 64) * 64) {
+				if (out) out[len] = RLE_64ZEROS | ((k / 64 > 64 ? 64 : k / 64) - 1);
+				len++;
+			}
+			if (k) {
+				if (out) out[len] = RLE_ZEROS | k;
+				len++;
+			}
+		} else if (v == 15) {
+			for(k = run; k; k -= k > 64 ? 64 : k) {
+				if (out) out[len] = RLE_ONES | ((k > 64 ? 64 : k) - 1);
+				len++;
+			}
+		} else {
+			for(k = run; k; k -= k > 4 ? 4 : k) {
+				if (out) out[len] = RLE_SHADE | (((k > 4 ? 4 : k) - 1) << 4) | v;
+				len++;
+			}
+		}
+	}
+	return len;
+}
+
+/**
+ * Encode a pixel string as codes using the fewest codes possible.
+ * Glyphs can use every dictionary entry and the fill-to-end code, ref encoded
+ * dictionary entries can only use the RLE entries.
+ * Returns the number of codes.
+ */
+static unsigned encodeRef(encoder *e, const uint8_t *px, unsigned n, int glyph, uint8_t *out, unsigned *usage) {
+	unsigned	i, j, b, bits, zt, fillmin, len;
+	int			node, c;
+
+	fillmin = DICT_START + (glyph ? e->ndict : e->nrle);
+
+	/* Everything after the last set pixel can be filled with a single code */
+	for(zt = n; zt && !px[zt-1]; zt--);
+
+	e->cost[n] = 0;
+	e->bwrun[n] = 0;
+	for(i = n; i-- > 0; ) {
+		e->bwrun[i] = px[i] == 0 || px[i] == 15 ? e->bwrun[i+1] + 1 : 0;
+
+		if (glyph && i >= zt) {
+			e->cost[i] = 1;
+			e->choice[i] = REF_FILLZEROS;
+			e->next[i] = n;
+			continue;
+		}
+
+		/* A single pixel */
+		e->cost[i] = e->cost[i+1] + 1;
+		e->choice[i] = px[i];
+		e->next[i] = i+1;
+
+		/* The fill codes that aren't taken by the dictionary */
+		for(b = 2, bits = 0; b <= 7 && b <= e->bwrun[i]; b++) {
+			if (e->cost[i+b] + 1 >= e->cost[i])
+				continue;
+			for(j = 0, bits = 0; j < b; j++) {
+				if (px[i+j])
+					bits |= 1 << j;
+			}
+			c = fillStart[b] + bits;
+			if (c < (int)fillmin)
+				continue;
+			e->cost[i] = e->cost[i+b] + 1;
+			e->choice[i] = c;
+			e->next[i] = i+b;
+		}
+
+		/* The dictionary entries */
+		for(node = 0, j = i; j < n; j++) {
+			if ((node = e->trie[node].next[px[j]]) < 0)
+				break;
+			c = e->trie[node].entry;
+			if (c < 0 || (!glyph && c >= (int)e->nrle))
+				continue;
+			if (e->cost[j+1] + 1 < e->cost[i]) {
+				e->cost[i] = e->cost[j+1] + 1;
+				e->choice[i] = DICT_START + c;
+				e->next[i] = j+1;
+			}
+		}
+	}
+
+	for(i = 0, len = 0; i < n; i = e->next[i], len++) {
+		if (out)
+			out[len] = e->choice[i];
+		if (usage && e->choice[i] >= DICT_START && e->choice[i] < fillmin)
+			usage[e->choice[i] - DICT_START]++;
+	}
+	return len;
+}
+
+void rlefontEncode(fontdata *f, rlefont *r) {
+	encoder		e;
+	unsigned	i, j, sz, len, maxsz;
+	unsigned	usage[DICT_MAX];
+	uint8_t		*buf;
+	fontdict	*d;
+
+	encoderInit(&e, f);
+	memset(r, 0, sizeof(rlefont));
+	memset(usage, 0, sizeof(usage));
+	r->nrle = e.nrle;
+	r->ndict = e.ndict;
+
+	/* The dictionary - a code can never expand to less than one pixel */
+	maxsz = 0;
+	for(i = 0; i < e.ndict; i++)
+		maxsz += f->dict[e.order[i]].len;
+	r->dictdata = xalloc(maxsz * 2 + 1);
+	for(i = 0, len = 0; i < e.ndict; i++) {
+		d = &f->dict[e.order[i]];
+		r->dictoffsets[i] = len;
+		if (i < e.nrle)
+			len += encodeRLE(d->pixels, d->len, r->dictdata + len);
+		else
+			len += encodeRef(&e, d->pixels, d->len, 0, r->dictdata + len, usage);
+		if (len > 0xFFFF)
+			fatal("The rlefont dictionary is too big");
+	}
+	r->dictoffsets[i] = len;
+	r->size = len + (e.ndict + 1) * 2;
+
+	/* The glyphs */
+	sz = f->maxwidth * f->maxheight;
+	buf = xalloc(sz + 1);
+	r->glyphdata = xalloc(f->nglyphs * sizeof(uint8_t *));
+	r->glyphsize = xalloc(f->nglyphs * sizeof(unsigned));
+	r->nglyphs = f->nglyphs;
+	for(i = 0; i < f->nglyphs; i++) {
+		buf[0] = f->glyphs[i].width;
+		len = 1 + encodeRef(&e, f->glyphs[i].pixels, sz, 1, buf + 1, usage);
+		r->glyphdata[i] = xalloc(len);
+		memcpy(r->glyphdata[i], buf, len);
+		r->glyphsize[i] = len;
+		r->size += len + 2 * f->glyphs[i].nchars;
+	}
+	free(buf);
+
+	for(j = 0; j < f->ndict; j++)
+		f->dict[j].score = usage[e.code[j]];
+	encoderFree(&e);
+}
+
+void rlefontFree(rlefont *r) {
+	unsigned	i;
+
+	for(i = 0; i < r->nglyphs; i++)
+		free(r->glyphdata[i]);
+	free(r->glyphdata);
+	free(r->glyphsize);
+	free(r->dictdata);
+	memset(r, 0, sizeof(rlefont));
+}
+
+/*-------------------------------------------------------------------------
+ * The optimizer
+ *-----------------------------------------------------------------------*/
+
+static unsigned fontSize(fontdata *f) {
+	rlefont		r;
+	unsigned	sz;
+
+	rlefontEncode(f, &r);
+	sz = r.size;
+	rlefontFree(&r);
+	return sz;
+}
+
+/* Make a dictionary entry from a pixel string */
+static void setEntry(fontdict *d, const uint8_t *px, unsigned len) {
+	d->pixels = xalloc(len);
+	memcpy(d->pixels, px, len);
+	d->len = len;
+	d->score = 0;
+
+	/* Short runs are cheapest RLE encoded, anything else is a guess the optimizer can change */
+	d->refencode = encodeRLE(px, len, 0) > 2;
+}
+
+/* Pick a random piece of a random glyph */
+static void randomPiece(fontdata *f, fontdict *d) {
+	fontglyph	*g;
+	unsigned	sz, zt, pos, len;
+
+	sz = f->maxwidth * f->maxheight;
+	g = &f->glyphs[rnd(&f->seed) % f->nglyphs];
+	for(zt = sz; zt && !g->pixels[zt-1]; zt--);
+	pos = zt ? rnd(&f->seed) % zt : 0;
+	len = 2 + rnd(&f->seed) % (2 + rnd(&f->seed) % (MAX_NEW_ENTRY - 3));
+	if (pos + len > sz)
+		len = sz - pos;
+	setEntry(d, g->pixels + pos, len);
+}
+
+/* Join a few consecutive codes of a random glyph's current encoding */
+static void randomCodes(fontdata *f, fontdict *d) {
+	encoder		e;
+	fontglyph	*g;
+	unsigned	sz, ncodes, k, m, pos, end;
+
+	sz = f->maxwidth * f->maxheight;
+	g = &f->glyphs[rnd(&f->seed) % f->nglyphs];
+	encoderInit(&e, f);
+	ncodes = encodeRef(&e, g->pixels, sz, 1, 0, 0);
+	if (ncodes > 1)
+		ncodes--;							// Never the fill to the end
+	k = rnd(&f->seed) % ncodes;
+	m = 2 + rnd(&f->seed) % 3;
+	for(pos = 0; k; k--)
+		pos = e.next[pos];
+	for(end = pos; m && end < sz && e.choice[end] != REF_FILLZEROS; m--)
+		end = e.next[end];
+	if (end - pos < 2)
+		end = pos + 2 <= sz ? pos + 2 : sz;
+	setEntry(d, g->pixels + pos, end - pos);
+	encoderFree(&e);
+}
+
+/* Find the entry with the lowest score */
+static unsigned worstEntry(fontdata *f) {
+	unsigned	i, w;
+
+	for(i = 1, w = 0; i < f->ndict; i++) {
+		if (f->dict[i].score < f->dict[w].score)
+			w = i;
+	}
+	return w;
+}
+
+/* Grow or shrink an entry using the pixels around one of its uses */
+static int resizeEntry(fontdata *f, fontdict *d) {
+	fontglyph	*g;
+	unsigned	sz, i, n, pos, before, after;
+
+	sz = f->maxwidth * f->maxheight;
+	if (d->len > 2 && (rnd(&f->seed) & 3) == 0) {
+		/* Shrink */
+		n = 1 + rnd(&f->seed) % (d->len - 2);
+		if (n > 2) n = 2;
+		pos = rnd(&f->seed) & 1 ? n : 0;
+		memmove(d->pixels, d->pixels + pos, d->len - n);
+		d->len -= n;
+		return 1;
+	}
+
+	/* Find the entry in a glyph, starting from a random glyph */
+	for(i = 0, n = rnd(&f->seed) % f->nglyphs; i < f->nglyphs; i++, n = (n + 1) % f->nglyphs) {
+		g = &f->glyphs[n];
+		for(pos = rnd(&f->seed) % sz; pos + d->len <= sz; pos++) {
+			if (memcmp(g->pixels + pos, d->pixels, d->len))
+				continue;
+			before = rnd(&f->seed) % 3;
+			after = rnd(&f->seed) % 3;
+			if (!before && !after)
+				after = 1;
+			if (before > pos) before = pos;
+			if (pos + d->len + after > sz) after = sz - pos - d->len;
+			if (!before && !after)
+				return 0;
+			d->pixels = xrealloc(d->pixels, d->len + before + after);
+			memcpy(d->pixels, g->pixels + pos - before, d->len + before + after);
+			d->len += before + after;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* Drop the entries that aren't used - that can only make the other codes cheaper */
+static void dropUnused(fontdata *f) {
+	unsigned	i, n;
+
+	for(i = 0, n = 0; i < f->ndict; i++) {
+		if (f->dict[i].score)
+			f->dict[n++] = f->dict[i];
+		else
+			free(f->dict[i].pixels);
+	}
+	f->ndict = n;
+}
+
+void rlefontOptimize(fontdata *f, int iterations) {
+	fontdict	saved[DICT_MAX], nd;
+	unsigned	nsaved, i, j, idx, size, newsize, start;
+	int			it, trial, ok;
+
+	if (!f->nglyphs)
+		fatal("The font has no glyphs");
+
+	start = size = fontSize(f);
+	dropUnused(f);
+	printf("Starting size: %u bytes, %u dictionary entries\n", size, f->ndict);
+
+	for(it = 1; it <= iterations; it++) {
+		for(trial = 0; trial < TRIALS_PER_ITERATION; trial++) {
+			memcpy(saved, f->dict, f->ndict * sizeof(fontdict));
+			nsaved = f->ndict;
+
+			/* Make a random change */
+			ok = 1;
+			switch(rnd(&f->seed) % 8) {
+			case 0: case 1: case 2:				// Add a new entry (or replace the worst if full)
+				// Make the entry first - randomCodes() encodes with the current dictionary
+				if (rnd(&f->seed) & 1)
+					randomPiece(f, &nd);
+				else
+					randomCodes(f, &nd);
+				if (f->ndict < DICT_MAX)
+					idx = f->ndict++;
+				else
+					idx = worstEntry(f);
+				f->dict[idx] = nd;
+				break;
+			case 3:								// Replace the worst entry
+				if (!f->ndict) { ok = 0; break; }
+				idx = worstEntry(f);
+				randomPiece(f, &f->dict[idx]);
+				break;
+			case 4: case 5:						// Grow or shrink an entry
+				if (!f->ndict) { ok = 0; break; }
+				idx = rnd(&f->seed) % f->ndict;
+				f->dict[idx].pixels = (uint8_t *)memcpy(xalloc(f->dict[idx].len), f->dict[idx].pixels, f->dict[idx].len);
+				ok = resizeEntry(f, &f->dict[idx]);
+				break;
+			case 6:								// Swap between RLE and ref encoding
+				if (!f->ndict) { ok = 0; break; }
+				idx = rnd(&f->seed) % f->ndict;
+				f->dict[idx].refencode = !f->dict[idx].refencode;
+				break;
+			case 7:								// Remove a rarely used entry
+				if (!f->ndict) { ok = 0; break; }
+				idx = worstEntry(f);
+				if (rnd(&f->seed) & 1)
+					idx = rnd(&f->seed) % f->ndict;
+				f->dict[idx] = f->dict[--f->ndict];
+				break;
+			}
+
+			newsize = ok ? fontSize(f) : size + 1;
+			if (newsize < size || (newsize == size && (rnd(&f->seed) & 1))) {
+				/* Keep it - free the pixels that are no longer used */
+				for(i = 0; i < nsaved; i++) {
+					for(j = 0; j < f->ndict && f->dict[j].pixels != saved[i].pixels; j++);
+					if (j == f->ndict)
+						free(saved[i].pixels);
+				}
+				size = newsize;
+				dropUnused(f);
+			} else {
+				/* Put it back */
+				for(j = 0; j < f->ndict; j++) {
+					for(i = 0; i < nsaved && f->dict[j].pixels != saved[i].pixels; i++);
+					if (i == nsaved)
+						free(f->dict[j].pixels);
+				}
+				memcpy(f->dict, saved, nsaved * sizeof(fontdict));
+				f->ndict = nsaved;
+			}
+		}
+		printf("Iteration %d: %u bytes, %u dictionary entries\n", it, size, f->ndict);
+	}
+
+	/* Leave the scores up to date for the dat file */
+	size = fontSize(f);
+	dropUnused(f);
+	printf("Optimized from %u to %u bytes\n", start, size);
+}
@@ -0,0 +1,178 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.org/license.html
+ */
+
+/**
+ * Report the size and decode time of each glyph in both font formats.
+ *
+ * The fonts are decoded by the real mcufont renderers from src/gdisp/mcufont
+ * so the times show the decoder cost of the chosen encoding (rather than
+ * the cost of drawing the pixels). Every glyph is also checked against the
+ * source bitmap so that this doubles as a test of the encoders.
+ */
+
+#include <string.h>
+#include <time.h>
+#include "mcufont.h"
+
+#define MF_RLEFONT_INTERNALS
+#define MF_BWFONT_INTERNALS
+#include "mf_rlefont.h"
+#include "mf_bwfont.h"
+
+typedef struct renderbuf {
+	uint8_t *	pixels;
+	int			width, height;
+	} renderbuf;
+
+static void renderPixels(int16_t x, int16_t y, uint8_t count, uint8_t alpha, void *state) {
+	renderbuf	*rb;
+
+	rb = (renderbuf *)state;
+	if (y < 0 || y >= rb->height || x < 0 || x + count > rb->width)
+		fatal("Decoded pixels outside the glyph box");
+	memset(rb->pixels + y * rb->width + x, alpha, count);
+}
+
+/* Render a character repeatedly. Returns the time per render in nanoseconds. */
+static double timeRender(const struct mf_font_s *font, unsigned ch, int loops, renderbuf *rb) {
+	clock_t		start;
+	int			i;
+
+	start = clock();
+	for(i = 0; i < loops; i++)
+		font->render_character(font, 0, 0, ch, renderPixels, rb);
+	return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+}
+
+/* Check a rendered glyph against the source bitmap */
+static void checkRender(fontdata *f, const struct mf_font_s *font, unsigned ch, int g, renderbuf *rb, int bw) {
+	unsigned	i, sz, expect;
+	const char	*kind;
+
+	sz = f->maxwidth * f->maxheight;
+	memset(rb->pixels, 0, sz);
+	kind = bw ? "bwfont" : "rlefont";
+	if (font->render_character(font, 0, 0, ch, renderPixels, rb) != f->glyphs[g].width)
+		fatal("%s: Wrong width decoded for character %u", kind, ch);
+	for(i = 0; i < sz; i++) {
+		expect = bw ? (f->glyphs[g].pixels[i] >= 8 ? 255 : 0) : f->glyphs[g].pixels[i] * 0x11;
+		if (rb->pixels[i] != expect)
+			fatal("%s: Wrong pixels decoded for character %u", kind, ch);
+	}
+}
+
+/* Check that characters outside the ranges are not found */
+static void checkMissing(const struct mf_font_s *font, const outrange *o, unsigned n, const char *kind) {
+	unsigned	ch, i;
+
+	for(ch = 0, i = 0; ch <= o[n-1].first + o[n-1].count; ch++) {
+		if (i < n && ch >= o[i].first + o[i].count)
+			i++;
+		if ((i >= n || ch < o[i].first) && font->character_width(font, ch))
+			fatal("%s: Found character %u which is not in the font", kind, ch);
+	}
+}
+
+void fontSpeed(fontdata *f, int loops) {
+	rlefont		r;
+	outrange	*rr, *br;
+	uint8_t		*rlookup, *blookup;
+	unsigned	nrr, nbr, i, j, ch, bsize, rtotal, btotal, n;
+	int			g;
+	double		rt, bt, rtsum, btsum;
+	renderbuf	rb;
+	struct mf_rlefont_char_range_s	*rranges;
+	struct mf_bwfont_char_range_s	*branges;
+
+	if (!f->nglyphs)
+		fatal("The font has no glyphs");
+	if (loops < 1)
+		loops = 1;
+
+	/* Build both fonts in memory just as they would be exported */
+	rlefontEncode(f, &r);
+	rr = rlefontRanges(f, &r, &nrr);
+	br = bwfontRanges(f, &nbr);
+	rlookup = fontCharLookup(rr, nrr);
+	blookup = fontCharLookup(br, nbr);
+	rranges = xalloc(nrr * sizeof(*rranges));
+	for(i = 0; i < nrr; i++) {
+		rranges[i].first_char = rr[i].first;
+		rranges[i].char_count = rr[i].count;
+		rranges[i].glyph_offsets = rr[i].offsets;
+		rranges[i].glyph_data = rr[i].data;
+	}
+	branges = xalloc(nbr * sizeof(*branges));
+	for(i = 0; i < nbr; i++) {
+		branges[i].first_char = br[i].first;
+		branges[i].char_count = br[i].count;
+		branges[i].offset_x = br[i].offsetx;
+		branges[i].offset_y = br[i].offsety;
+		branges[i].height_bytes = br[i].heightbytes;
+		branges[i].height_pixels = br[i].heightpixels;
+		branges[i].width = br[i].width;
+		branges[i].glyph_widths = br[i].widths;
+		branges[i].glyph_offsets = br[i].offsets;
+		branges[i].glyph_data = br[i].data;
+	}
+
+	{
+		struct mf_rlefont_s rfont = {
+			{ f->name, "rlefont", f->maxwidth, f->maxheight, 0, 255, f->baselinex, f->baseliney, f->lineheight, 0, FALLBACK_CHAR,
+				&mf_rlefont_character_width, &mf_rlefont_render_character },
+			4, r.dictdata, r.dictoffsets, r.nrle, r.ndict, nrr, rranges, rlookup };
+		struct mf_bwfont_s bfont = {
+			{ f->name, "bwfont", f->maxwidth, f->maxheight, 0, 255, f->baselinex, f->baseliney, f->lineheight, FLAG_BW, FALLBACK_CHAR,
+				&mf_bwfont_character_width, &mf_bwfont_render_character },
+			4, nbr, branges, blookup };
+
+		checkMissing(&rfont.font, rr, nrr, "rlefont");
+		checkMissing(&bfont.font, br, nbr, "bwfont");
+
+		rb.width = f->maxwidth;
+		rb.height = f->maxheight;
+		rb.pixels = xalloc(rb.width * rb.height);
+
+		printf("Char   rlefont bytes     ns   bwfont bytes     ns\n");
+		rtsum = btsum = 0;
+		rtotal = btotal = n = 0;
+		for(i = 0; i < nbr; i++) {
+			for(j = 0; j < br[i].count; j++) {
+				ch = br[i].first + j;
+				if ((g = fontFindGlyph(f, ch)) < 0)
+					continue;
+				checkRender(f, &rfont.font, ch, g, &rb, 0);
+				checkRender(f, &bfont.font, ch, g, &rb, 1);
+				rt = timeRender(&rfont.font, ch, loops, &rb);
+				bt = timeRender(&bfont.font, ch, loops, &rb);
+				bsize = br[i].width ? br[i].width * br[i].heightbytes : (br[i].offsets[j+1] - br[i].offsets[j]) * br[i].heightbytes + 3;
+				if (ch >= 32 && ch < 127)
+					printf("%4u '%c' %10u %8.0f %12u %8.0f\n", ch, ch, r.glyphsize[g], rt, bsize, bt);
+				else
+					printf("%4u     %10u %8.0f %12u %8.0f\n", ch, r.glyphsize[g], rt, bsize, bt);
+				rtsum += rt;
+				btsum += bt;
+				rtotal += r.glyphsize[g];
+				btotal += bsize;
+				n++;
+			}
+		}
+		printf("\n");
+		printf("rlefont: %u bytes in total (%u glyph + %u dictionary), average %.0f ns per glyph\n",
+			r.size, rtotal, r.dictoffsets[r.ndict] + (r.ndict + 1) * 2, rtsum / n);
+		printf("bwfont:  %u bytes in total, average %.0f ns per glyph\n", bwfontSize(f), btsum / n);
+		free(rb.pixels);
+	}
+
+	free(rranges);
+	free(branges);
+	free(rlookup);
+	free(blookup);
+	fontFreeRanges(rr, nrr);
+	fontFreeRanges(br, nbr);
+	rlefontFree(&r);
+}